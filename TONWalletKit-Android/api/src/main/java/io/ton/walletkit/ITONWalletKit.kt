@@ -36,11 +36,15 @@ import io.ton.walletkit.config.TONWalletKitConfiguration
 import io.ton.walletkit.internal.TONWalletKitFactory
 import io.ton.walletkit.listener.TONBridgeEventsHandler
 import io.ton.walletkit.model.KeyPair
+import io.ton.walletkit.model.TONBridgeMetrics
 import io.ton.walletkit.model.TONWalletAdapter
+import io.ton.walletkit.model.TONWalletImportProgress
+import io.ton.walletkit.model.TONWalletImportRequest
 import io.ton.walletkit.model.WalletSigner
 import io.ton.walletkit.model.WalletSignerInfo
 import io.ton.walletkit.request.TONWalletConnectionRequest
 import io.ton.walletkit.session.TONConnectSession
+import io.ton.walletkit.session.TONConnectSessionChange
 import io.ton.walletkit.staking.ITONStakingManager
 import io.ton.walletkit.staking.tonstakers.TONTonStakersStakingProvider
 import io.ton.walletkit.streaming.ITONStreamingManager
@@ -48,6 +52,8 @@ import io.ton.walletkit.streaming.ITONStreamingProvider
 import io.ton.walletkit.swap.ITONSwapManager
 import io.ton.walletkit.swap.dedust.TONDeDustSwapProvider
 import io.ton.walletkit.swap.omniston.TONOmnistonSwapProvider
+import kotlinx.coroutines.CoroutineDispatcher
+import kotlinx.coroutines.flow.Flow
 
 /**
  * TON Wallet Kit SDK for managing wallets and TON Connect.
@@ -58,6 +64,22 @@ interface ITONWalletKit {
             context: Context,
             config: TONWalletKitConfiguration,
         ): ITONWalletKit = TONWalletKitFactory.create(context, config)
+
+        /**
+         * Start loading the WalletKit engine before the configuration is known, e.g. from
+         * `Application.onCreate`. WebView creation and bundle loading then overlap with the rest
+         * of app startup, and the next [initialize] picks up the prewarmed engine.
+         *
+         * Returns immediately; the WebView is then created on the main thread, after any engine
+         * creation already in progress has finished. Pass the same
+         * [TONWalletKitConfiguration.EngineOptions.batching] you will initialize with, or the
+         * prewarmed WebView is discarded. Phase timings are reported in
+         * [io.ton.walletkit.model.TONBridgeMetrics.startup].
+         */
+        fun prewarm(
+            context: Context,
+            engineOptions: TONWalletKitConfiguration.EngineOptions = TONWalletKitConfiguration.EngineOptions(),
+        ) = TONWalletKitFactory.prewarm(context, engineOptions)
     }
 
     /**
@@ -65,6 +87,15 @@ interface ITONWalletKit {
      */
     suspend fun addEventsHandler(eventsHandler: TONBridgeEventsHandler)
 
+    /**
+     * Add event handler that receives events on [dispatcher] instead of the main thread.
+     *
+     * Each handler gets events in the order they were emitted, and a slow handler does not
+     * hold up the others. Streaming updates are delivered separately, so their order relative
+     * to these events is not guaranteed.
+     */
+    suspend fun addEventsHandler(eventsHandler: TONBridgeEventsHandler, dispatcher: CoroutineDispatcher)
+
     suspend fun removeEventsHandler(eventsHandler: TONBridgeEventsHandler)
 
     suspend fun destroy()
@@ -126,6 +157,16 @@ interface ITONWalletKit {
      */
     suspend fun addWallet(adapter: TONWalletAdapter): ITONWallet
 
+    /**
+     * Restore many wallets at once.
+     *
+     * Keys are derived in parallel across cores, and wallets are created and added in batched
+     * bridge calls rather than one signer/adapter/addWallet round trip sequence per wallet.
+     * The flow emits one [TONWalletImportProgress] per wallet and completes when the whole batch
+     * has been processed; collecting it starts the import.
+     */
+    fun addWallets(batch: List<TONWalletImportRequest>): Flow<TONWalletImportProgress>
+
     suspend fun getWallets(): List<ITONWallet>
 
     /**
@@ -175,6 +216,13 @@ interface ITONWalletKit {
 
     suspend fun disconnectSession(sessionId: String)
 
+    /**
+     * Session creations, replacements and removals as they happen. Requires
+     * [TONWalletKitConfiguration.EngineOptions.nativeSessionStore]; otherwise the flow never emits.
+     * A collector that falls more than 64 changes behind misses the changes that do not fit.
+     */
+    fun sessionChanges(): Flow<TONConnectSessionChange>
+
     /**
      * Create WebView TON Connect injector.
      */
@@ -234,6 +282,16 @@ interface ITONWalletKit {
     suspend fun createStreamingProvider(
         config: TONTonApiStreamingProviderConfig,
     ): ITONStreamingProvider
+
+    /**
+     * Snapshot of bridge call counters for this SDK instance.
+     */
+    fun bridgeMetrics(): TONBridgeMetrics
+
+    /**
+     * Emits [bridgeMetrics] snapshots every [intervalMillis] while collected.
+     */
+    fun bridgeMetricsUpdates(intervalMillis: Long = 5_000): Flow<TONBridgeMetrics>
 }
 
 interface WebViewTonConnectInjector {
@@ -45,6 +45,7 @@ import kotlinx.serialization.Transient
  * @property storageType Storage configuration
  * @property sessionManager Custom session manager implementation (optional)
  * @property dev Development options for testing
+ * @property engineOptions Tuning for the internal JavaScript bridge
  */
 @Serializable
 data class TONWalletKitConfiguration(
@@ -72,6 +73,8 @@ data class TONWalletKitConfiguration(
      */
     @Transient
     val fetchManifest: (suspend (manifestUrl: String) -> TONManifestFetchResult)? = null,
+    @Transient
+    val engineOptions: EngineOptions = EngineOptions(),
 ) {
     /**
      * Returns the primary network (first in the set).
@@ -251,6 +254,144 @@ data class TONWalletKitConfiguration(
         val disableNetworkSend: Boolean = false,
     )
 
+    /**
+     * Tuning for the Kotlin ↔ JavaScript bridge that backs the SDK.
+     * The defaults preserve the one-message-per-call behaviour.
+     *
+     * @property batching Coalesce bridge envelopes into framed port messages. Disabled when null.
+     * @property callDeadlines Per-call deadlines for bridge RPCs, by method class
+     * @property recordMetrics Record per-method latency histograms and sizes for [io.ton.walletkit.ITONWalletKit.bridgeMetrics].
+     * Off by default; the plain counters are kept either way.
+     * @property shareAcrossNetworks Serve every network from one WebView and JS context. A kit
+     * initialized for another network joins the running engine: its network configurations are
+     * added to it and calls are routed by chainId, instead of starting a second WebView. The engine
+     * is torn down once every kit sharing it is destroyed. Both kits must opt in, with the same
+     * storage type, session manager and engine options. Each kit still sees only the wallets added
+     * for its own networks and the events of those wallets.
+     * @property nativeCrypto Create TON mnemonics, derive their keys and sign in Kotlin instead of
+     * the JS bundle, so mnemonic work no longer holds up other bridge calls. Keys and signatures are
+     * identical either way. Generated mnemonics have 24 words on both paths as used by
+     * [io.ton.walletkit.ITONWalletKit.createTonMnemonic]; only the native path can also produce
+     * 12-word ones. BIP-39 mnemonics are always derived in JS.
+     * @property storageWriteBehind Cache SDK storage in memory and coalesce writes to the storage
+     * adapter. Off by default: when null, every read and write goes straight to the adapter. When
+     * set, writes still pending when the process is killed are lost, sessions and wallets included.
+     * @property nativeSessionStore Keep TON Connect sessions in a native store indexed by wallet,
+     * domain and JS-bridge flag, persisted one session per storage key, instead of the bundle's
+     * single session list. Enables [io.ton.walletkit.ITONWalletKit.sessionChanges]. Existing
+     * sessions are imported on first use. Ignored when [TONWalletKitConfiguration.sessionManager] is set.
+     */
+    data class EngineOptions(
+        val batching: BatchingOptions? = null,
+        val callDeadlines: CallDeadlines = CallDeadlines(),
+        val recordMetrics: Boolean = false,
+        val shareAcrossNetworks: Boolean = false,
+        val nativeCrypto: Boolean = true,
+        val storageWriteBehind: StorageWriteBehind? = null,
+        val nativeSessionStore: Boolean = false,
+    )
+
+    /**
+     * Write-behind caching for SDK storage.
+     *
+     * Reads are served from memory after the first one per key. Writes update memory at once and
+     * reach the storage adapter later, keeping only the last value per key. Pending writes are
+     * flushed once writes pause for [flushDelayMillis], at most [maxFlushDelayMillis] after the
+     * first of them, as soon as [maxPendingKeys] keys are pending, when the app goes to the
+     * background, and when the kit is destroyed. Clearing storage is never deferred. Writes the
+     * storage adapter rejects stay pending and are retried [maxFlushDelayMillis] later. Pending
+     * writes do not survive the process being killed, so enable this only where losing up to
+     * [maxFlushDelayMillis] of writes is acceptable.
+     *
+     * @property flushDelayMillis Quiet period after the last write before pending writes are flushed
+     * @property maxFlushDelayMillis Longest a write may stay pending while writes keep arriving
+     * @property maxPendingKeys Number of keys with pending writes that triggers an immediate flush
+     */
+    data class StorageWriteBehind(
+        val flushDelayMillis: Long = 1_000,
+        val maxFlushDelayMillis: Long = 5_000,
+        val maxPendingKeys: Int = 16,
+    ) {
+        init {
+            require(flushDelayMillis >= 0) { "flushDelayMillis must not be negative" }
+            require(maxFlushDelayMillis >= flushDelayMillis) { "maxFlushDelayMillis must be at least flushDelayMillis" }
+            require(maxPendingKeys > 0) { "maxPendingKeys must be positive" }
+        }
+    }
+
+    /**
+     * Deadlines for calls into the JavaScript bridge, in milliseconds.
+     *
+     * A call that misses its deadline fails with [io.ton.walletkit.WalletKitBridgeException] and
+     * is cancelled on the JavaScript side, as is a call whose coroutine is cancelled.
+     * A null value disables the deadline for that class.
+     *
+     * @property localMillis Key derivation, signing and wallet registry calls that never leave the device
+     * @property networkMillis Calls that may hit the network, including approvals and balance reads
+     * @property emulationMillis Transaction previews, which fetch state and emulate the transaction
+     */
+    data class CallDeadlines(
+        val localMillis: Long? = 30_000,
+        val networkMillis: Long? = 60_000,
+        val emulationMillis: Long? = 90_000,
+    ) {
+        init {
+            listOf(localMillis, networkMillis, emulationMillis).forEach { millis ->
+                require(millis == null || millis > 0) { "Call deadlines must be positive" }
+            }
+        }
+    }
+
+    /**
+     * Envelope batching for the bridge message port.
+     *
+     * Envelopes queued within one main-looper turn (or one JS task on the other side) are sent
+     * as a single framed message. A frame is closed early once it would exceed [maxBatchBytes].
+     *
+     * @property maxBatchBytes Upper bound for a single frame, in UTF-16 code units
+     * @property onFlush Receives per-flush statistics on the main thread; use it to tune [maxBatchBytes]
+     */
+    data class BatchingOptions(
+        val maxBatchBytes: Int = DEFAULT_MAX_BATCH_BYTES,
+        val onFlush: ((BatchFlushStats) -> Unit)? = null,
+    ) {
+        init {
+            require(maxBatchBytes > 0) { "maxBatchBytes must be positive" }
+        }
+
+        companion object {
+            const val DEFAULT_MAX_BATCH_BYTES: Int = 64 * 1024
+        }
+    }
+
+    /**
+     * Statistics for one batching flush.
+     *
+     * @property direction [BatchDirection.OUTBOUND] for Kotlin → JS flushes, [BatchDirection.INBOUND] for frames received from JS
+     * @property envelopes Envelopes carried by this flush
+     * @property messages Port messages posted (or received) for them
+     * @property bytes Total payload size in UTF-16 code units
+     * @property totalFlushes Flushes seen so far in this direction
+     * @property totalEnvelopes Envelopes seen so far in this direction
+     */
+    data class BatchFlushStats(
+        val direction: BatchDirection,
+        val envelopes: Int,
+        val messages: Int,
+        val bytes: Int,
+        val totalFlushes: Long,
+        val totalEnvelopes: Long,
+    ) {
+        /** Average envelopes per flush in this direction. */
+        val averageBatchSize: Double
+            get() = if (totalFlushes == 0L) 0.0 else totalEnvelopes.toDouble() / totalFlushes
+    }
+
+    enum class BatchDirection {
+        OUTBOUND,
+        INBOUND,
+    }
+
     /**
      * Base interface for wallet features.
      * Implement this to define supported wallet capabilities.
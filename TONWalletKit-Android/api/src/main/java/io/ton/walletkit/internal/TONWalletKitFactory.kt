@@ -67,4 +67,22 @@ internal object TONWalletKitFactory {
             }
         }
     }
+
+    fun prewarm(
+        context: Context,
+        engineOptions: TONWalletKitConfiguration.EngineOptions,
+    ) {
+        val implClass = Class.forName("io.ton.walletkit.core.TONWalletKit")
+        val companionField = implClass.getDeclaredField("Companion")
+        companionField.isAccessible = true
+        val companion = companionField.get(null)
+
+        val method = companion.javaClass.getDeclaredMethod(
+            "prewarm",
+            Context::class.java,
+            TONWalletKitConfiguration.EngineOptions::class.java,
+        )
+        method.isAccessible = true
+        method.invoke(companion, context, engineOptions)
+    }
 }
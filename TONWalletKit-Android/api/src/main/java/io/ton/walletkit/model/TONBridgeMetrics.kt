@@ -0,0 +1,90 @@
+/*
+ * Copyright (c) 2025 TonTech
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+package io.ton.walletkit.model
+
+/**
+ * Counters for calls made into the JavaScript bridge since the engine was created.
+ *
+ * The counters and gauges are always kept. [methods] and [reverseMethods] are filled only when
+ * [io.ton.walletkit.config.TONWalletKitConfiguration.EngineOptions.recordMetrics] is enabled.
+ *
+ * @property callsStarted Calls sent to JavaScript
+ * @property deadlinesExceeded Calls that failed because they missed their deadline
+ * @property callsCancelled Calls abandoned because the calling coroutine was cancelled
+ * @property cancelsSent Cancel messages sent to JavaScript for abandoned calls
+ * @property inFlight Calls sent to JavaScript that have not completed yet
+ * @property outboundQueueDepth Messages waiting to be posted to the bridge port
+ * @property contextLosses Times the JavaScript context was recreated
+ * @property callsReplayed In-flight calls re-sent to a recreated JavaScript context
+ * @property callsFailedOnContextLoss In-flight calls failed with [io.ton.walletkit.WalletKitContextLostException]
+ * @property lastRecoveryMillis Time from the last context loss until init, listeners and replay were done; null if none yet
+ * @property reverseInFlight JavaScript → Kotlin requests whose native handler is running
+ * @property reverseQueued JavaScript → Kotlin requests waiting for their method's concurrency limit
+ * @property reverseQueuedPeak Highest [reverseQueued] seen so far
+ * @property reverseRejected JavaScript → Kotlin requests refused because too many were pending; JavaScript retries them
+ * @property startup Time to each phase of the engine's startup
+ * @property methods Per-method statistics for Kotlin → JavaScript calls
+ * @property reverseMethods Per-method statistics for JavaScript → Kotlin requests, measured around the native handler
+ */
+data class TONBridgeMetrics(
+    val callsStarted: Long = 0,
+    val deadlinesExceeded: Long = 0,
+    val callsCancelled: Long = 0,
+    val cancelsSent: Long = 0,
+    val inFlight: Int = 0,
+    val outboundQueueDepth: Int = 0,
+    val contextLosses: Long = 0,
+    val callsReplayed: Long = 0,
+    val callsFailedOnContextLoss: Long = 0,
+    val lastRecoveryMillis: Long? = null,
+    val reverseInFlight: Int = 0,
+    val reverseQueued: Int = 0,
+    val reverseQueuedPeak: Int = 0,
+    val reverseRejected: Long = 0,
+    val startup: TONStartupTimings = TONStartupTimings(),
+    val methods: Map<String, TONBridgeMethodMetrics> = emptyMap(),
+    val reverseMethods: Map<String, TONBridgeMethodMetrics> = emptyMap(),
+)
+
+/**
+ * Statistics for one bridge method.
+ *
+ * Latency percentiles come from a log-scale histogram and are accurate to within 25%.
+ * Sizes are envelope lengths in UTF-16 code units plus any binary attachment bytes.
+ *
+ * @property calls Completed calls, including failures
+ * @property failures Calls that completed with an error, missed their deadline or were cancelled
+ * @property p50Millis Median latency
+ * @property p95Millis 95th percentile latency
+ * @property p99Millis 99th percentile latency
+ * @property requestBytes Total size of requests sent
+ * @property responseBytes Total size of responses received
+ */
+data class TONBridgeMethodMetrics(
+    val calls: Long,
+    val failures: Long,
+    val p50Millis: Double,
+    val p95Millis: Double,
+    val p99Millis: Double,
+    val requestBytes: Long,
+    val responseBytes: Long,
+)
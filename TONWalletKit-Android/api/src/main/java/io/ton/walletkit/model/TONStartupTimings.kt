@@ -0,0 +1,46 @@
+/*
+ * Copyright (c) 2025 TonTech
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+package io.ton.walletkit.model
+
+/**
+ * Time to each startup phase of the engine, in milliseconds since its WebView began loading.
+ *
+ * That start is the call to [io.ton.walletkit.ITONWalletKit.prewarm] when the engine adopted a
+ * prewarmed WebView, and engine creation otherwise. A phase is null until it has been reached.
+ *
+ * @property prewarmed Whether the engine started from a prewarmed WebView
+ * @property webViewCreatedMillis The WebView instance was created
+ * @property pageFinishedMillis The bridge page and bundle finished loading
+ * @property portReadyMillis The message port was handed to JavaScript
+ * @property configBoundMillis The configuration was attached to the WebView
+ * @property jsReadyMillis JavaScript reported that the bridge is ready
+ * @property initDoneMillis WalletKit initialization finished
+ */
+data class TONStartupTimings(
+    val prewarmed: Boolean = false,
+    val webViewCreatedMillis: Long? = null,
+    val pageFinishedMillis: Long? = null,
+    val portReadyMillis: Long? = null,
+    val configBoundMillis: Long? = null,
+    val jsReadyMillis: Long? = null,
+    val initDoneMillis: Long? = null,
+)
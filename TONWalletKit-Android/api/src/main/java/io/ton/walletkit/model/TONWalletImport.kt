@@ -0,0 +1,82 @@
+/*
+ * Copyright (c) 2025 TonTech
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+package io.ton.walletkit.model
+
+import io.ton.walletkit.ITONWallet
+import io.ton.walletkit.WalletKitBridgeException
+import io.ton.walletkit.WalletKitConstants
+import io.ton.walletkit.api.MAINNET
+import io.ton.walletkit.api.WalletVersions
+import io.ton.walletkit.api.generated.TONNetwork
+import io.ton.walletkit.api.generated.TONSignatureDomain
+
+/**
+ * One wallet to restore with [io.ton.walletkit.ITONWalletKit.addWallets].
+ *
+ * @property mnemonic Mnemonic phrase as a list of words
+ * @property mnemonicType Mnemonic type ("ton" or "bip39")
+ * @property version Wallet contract version, [WalletVersions.V5R1] or [WalletVersions.V4R2]
+ * @property network Network the wallet belongs to
+ * @property workchain Workchain of the wallet contract
+ * @property walletId Wallet ID; null picks the default for [version]
+ * @property domain Optional signature domain for L2 chains (e.g. Tetra)
+ */
+data class TONWalletImportRequest(
+    val mnemonic: List<String>,
+    val mnemonicType: String = "ton",
+    val version: String = WalletVersions.V5R1,
+    val network: TONNetwork = TONNetwork.MAINNET,
+    val workchain: Int = WalletKitConstants.DEFAULT_WORKCHAIN,
+    val walletId: Long? = null,
+    val domain: TONSignatureDomain? = null,
+)
+
+/**
+ * Progress of [io.ton.walletkit.ITONWalletKit.addWallets], emitted once per wallet as it finishes.
+ *
+ * Updates arrive in batch order; a failed wallet does not stop the rest of the batch.
+ *
+ * @property index Position of the wallet in the submitted batch
+ * @property completed Wallets finished so far, added or failed
+ * @property total Wallets in the batch
+ */
+sealed class TONWalletImportProgress {
+    abstract val index: Int
+    abstract val completed: Int
+    abstract val total: Int
+
+    /** The wallet was derived and added. */
+    data class Added(
+        override val index: Int,
+        override val completed: Int,
+        override val total: Int,
+        val wallet: ITONWallet,
+    ) : TONWalletImportProgress()
+
+    /** The wallet could not be added, e.g. because its mnemonic is invalid. */
+    data class Failed(
+        override val index: Int,
+        override val completed: Int,
+        override val total: Int,
+        val error: WalletKitBridgeException,
+    ) : TONWalletImportProgress()
+}
@@ -0,0 +1,36 @@
+/*
+ * Copyright (c) 2025 TonTech
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+package io.ton.walletkit.session
+
+/**
+ * A change to the set of TON Connect sessions, as reported by [io.ton.walletkit.ITONWalletKit.sessionChanges].
+ */
+sealed interface TONConnectSessionChange {
+    /** [session] was created. */
+    data class Created(val session: TONConnectSession) : TONConnectSessionChange
+
+    /** [session] was created again under an existing id and replaced the stored session. */
+    data class Replaced(val session: TONConnectSession) : TONConnectSessionChange
+
+    /** The sessions with [sessionIds] were removed. */
+    data class Removed(val sessionIds: List<String>) : TONConnectSessionChange
+}
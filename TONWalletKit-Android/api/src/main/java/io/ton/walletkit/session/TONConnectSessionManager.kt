@@ -22,6 +22,7 @@
 package io.ton.walletkit.session
 
 import io.ton.walletkit.api.generated.TONDAppInfo
+import java.net.URI
 
 /**
  * Abstraction for session management in TONConnect protocol.
@@ -89,9 +90,41 @@ interface TONConnectSessionManager {
 
 /**
  * Filter for querying sessions.
+ *
+ * Unset criteria match every session. [domain] may be a dApp URL or a bare domain; see [matches].
  */
 data class SessionFilter(
     val walletId: String? = null,
     val domain: String? = null,
     val isJsBridge: Boolean? = null,
-)
+) {
+    /**
+     * Whether [session] meets every criterion, with the semantics of the bundle's own session
+     * manager: empty strings are unset, and a URL [domain] is compared by its host.
+     */
+    fun matches(session: TONConnectSession): Boolean =
+        (walletId.isNullOrEmpty() || session.walletId == walletId) &&
+            (domain.isNullOrEmpty() || session.domain == normalizedDomain()) &&
+            (isJsBridge == null || session.isJsBridge == isJsBridge)
+
+    /** [domain] as stored in [TONConnectSession.domain], or null when unset. */
+    fun normalizedDomain(): String? = domain?.takeIf { it.isNotEmpty() }?.let { domainOf(it) ?: it }
+
+    companion object {
+        /**
+         * The session domain for a dApp [url]: its host, with the port when it is not the
+         * scheme's default. Returns null when [url] is not an absolute URL.
+         */
+        fun domainOf(url: String): String? {
+            val uri = runCatching { URI(url) }.getOrNull() ?: return null
+            val host = uri.host?.lowercase() ?: return null
+            if (uri.scheme == null) return null
+            val defaultPort = when (uri.scheme.lowercase()) {
+                "http", "ws" -> 80
+                "https", "wss" -> 443
+                else -> -1
+            }
+            return if (uri.port == -1 || uri.port == defaultPort) host else "$host:${uri.port}"
+        }
+    }
+}
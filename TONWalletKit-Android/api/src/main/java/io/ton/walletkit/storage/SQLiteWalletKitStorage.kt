@@ -0,0 +1,179 @@
+/*
+ * Copyright (c) 2025 TonTech
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+package io.ton.walletkit.storage
+
+import android.content.Context
+import android.database.sqlite.SQLiteDatabase
+import android.database.sqlite.SQLiteOpenHelper
+import kotlinx.coroutines.Dispatchers
+import kotlinx.coroutines.withContext
+
+/**
+ * Reference [TONWalletKitStorage] on a framework SQLite database.
+ *
+ * Multi-key calls run in a single transaction, so [setMany] and [removeMany] cost one commit
+ * however many keys they touch. Use it directly, or as a template for storing SDK data in a
+ * database your app already has:
+ *
+ * ```kotlin
+ * val configuration = TONWalletKitConfiguration(
+ *     // ...
+ *     storageType = TONWalletKitStorageType.Custom(SQLiteWalletKitStorage(context)),
+ * )
+ * ```
+ *
+ * Values are stored as given. Session data includes private keys, so keep the database on
+ * storage encrypted at rest (or use an encrypting SQLite build) when that matters.
+ *
+ * @param context Any context; the application context is retained
+ * @param databaseName Database file name, or null for an in-memory database
+ */
+class SQLiteWalletKitStorage(
+    context: Context,
+    databaseName: String? = DEFAULT_DATABASE_NAME,
+) : TONWalletKitStorage {
+    private val helper = object : SQLiteOpenHelper(context.applicationContext, databaseName, null, DATABASE_VERSION) {
+        override fun onConfigure(db: SQLiteDatabase) {
+            db.enableWriteAheadLogging()
+        }
+
+        override fun onCreate(db: SQLiteDatabase) {
+            db.execSQL("CREATE TABLE $TABLE ($COLUMN_KEY TEXT PRIMARY KEY NOT NULL, $COLUMN_VALUE TEXT NOT NULL) WITHOUT ROWID")
+        }
+
+        override fun onUpgrade(db: SQLiteDatabase, oldVersion: Int, newVersion: Int) = Unit
+    }
+
+    override suspend fun get(key: String): String? = io(StorageOperation.GET, key) {
+        helper.readableDatabase
+            .rawQuery("SELECT $COLUMN_VALUE FROM $TABLE WHERE $COLUMN_KEY = ?", arrayOf(key))
+            .use { cursor -> if (cursor.moveToFirst()) cursor.getString(0) else null }
+    }
+
+    override suspend fun set(key: String, value: String) {
+        io(StorageOperation.SET, key) {
+            helper.writableDatabase.execSQL(UPSERT, arrayOf(key, value))
+        }
+    }
+
+    override suspend fun remove(key: String) {
+        io(StorageOperation.REMOVE, key) {
+            helper.writableDatabase.execSQL("DELETE FROM $TABLE WHERE $COLUMN_KEY = ?", arrayOf(key))
+        }
+    }
+
+    override suspend fun clear() {
+        io(StorageOperation.CLEAR, null) {
+            helper.writableDatabase.execSQL("DELETE FROM $TABLE")
+        }
+    }
+
+    override suspend fun getMany(keys: Collection<String>): Map<String, String> = io(StorageOperation.GET, null) {
+        val result = HashMap<String, String>(keys.size)
+        val db = helper.readableDatabase
+        for (chunk in keys.distinct().chunked(MAX_BOUND_KEYS)) {
+            val placeholders = chunk.joinToString(",") { "?" }
+            db.rawQuery(
+                "SELECT $COLUMN_KEY, $COLUMN_VALUE FROM $TABLE WHERE $COLUMN_KEY IN ($placeholders)",
+                chunk.toTypedArray(),
+            ).use { cursor ->
+                while (cursor.moveToNext()) result[cursor.getString(0)] = cursor.getString(1)
+            }
+        }
+        result
+    }
+
+    override suspend fun setMany(values: Map<String, String>) {
+        io(StorageOperation.SET, null) {
+            transaction { db ->
+                db.compileStatement(UPSERT).use { statement ->
+                    for ((key, value) in values) {
+                        statement.bindString(1, key)
+                        statement.bindString(2, value)
+                        statement.executeInsert()
+                    }
+                }
+            }
+        }
+    }
+
+    override suspend fun removeMany(keys: Collection<String>) {
+        io(StorageOperation.REMOVE, null) {
+            transaction { db ->
+                db.compileStatement("DELETE FROM $TABLE WHERE $COLUMN_KEY = ?").use { statement ->
+                    for (key in keys) {
+                        statement.bindString(1, key)
+                        statement.executeUpdateDelete()
+                    }
+                }
+            }
+        }
+    }
+
+    override suspend fun getByPrefix(prefix: String): Map<String, String> = io(StorageOperation.GET, null) {
+        helper.readableDatabase.rawQuery(
+            "SELECT $COLUMN_KEY, $COLUMN_VALUE FROM $TABLE WHERE substr($COLUMN_KEY, 1, length(?1)) = ?1",
+            arrayOf(prefix),
+        ).use { cursor ->
+            buildMap { while (cursor.moveToNext()) put(cursor.getString(0), cursor.getString(1)) }
+        }
+    }
+
+    /** Closes the database; the storage reopens it on next use. */
+    fun close() {
+        helper.close()
+    }
+
+    private inline fun transaction(block: (SQLiteDatabase) -> Unit) {
+        val db = helper.writableDatabase
+        db.beginTransaction()
+        try {
+            block(db)
+            db.setTransactionSuccessful()
+        } finally {
+            db.endTransaction()
+        }
+    }
+
+    private suspend fun <T> io(operation: StorageOperation, key: String?, block: () -> T): T =
+        withContext(Dispatchers.IO) {
+            try {
+                block()
+            } catch (e: Exception) {
+                throw WalletKitStorageException(operation, key, e)
+            }
+        }
+
+    companion object {
+        /** Database file used when none is named. */
+        const val DEFAULT_DATABASE_NAME = "walletkit_storage.db"
+
+        private const val DATABASE_VERSION = 1
+        private const val TABLE = "walletkit_storage"
+        private const val COLUMN_KEY = "storage_key"
+        private const val COLUMN_VALUE = "storage_value"
+        private const val UPSERT = "INSERT OR REPLACE INTO $TABLE ($COLUMN_KEY, $COLUMN_VALUE) VALUES (?, ?)"
+
+        // Stays below SQLITE_MAX_VARIABLE_NUMBER on every supported API level.
+        private const val MAX_BOUND_KEYS = 500
+    }
+}
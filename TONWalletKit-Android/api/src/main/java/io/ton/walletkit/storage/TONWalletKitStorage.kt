@@ -64,4 +64,54 @@ interface TONWalletKitStorage {
      * @throws WalletKitStorageException if storage clear fails
      */
     suspend fun clear()
+
+    /**
+     * Get several values at once.
+     *
+     * The default reads keys one by one; override it to read them in one query.
+     *
+     * @param keys The storage keys
+     * @return Values of the keys that exist; missing keys are left out
+     * @throws WalletKitStorageException if storage access fails
+     */
+    suspend fun getMany(keys: Collection<String>): Map<String, String> =
+        buildMap { for (key in keys) get(key)?.let { put(key, it) } }
+
+    /**
+     * Set several values at once.
+     *
+     * The SDK uses this whenever it writes more than one key together. The default writes keys
+     * one by one; override it to write them in one transaction.
+     *
+     * @param values Keys and the values to store
+     * @throws WalletKitStorageException if storage write fails
+     */
+    suspend fun setMany(values: Map<String, String>) {
+        for ((key, value) in values) set(key, value)
+    }
+
+    /**
+     * Remove several values at once.
+     *
+     * The default removes keys one by one; override it to remove them in one transaction.
+     *
+     * @param keys The storage keys to remove
+     * @throws WalletKitStorageException if storage delete fails
+     */
+    suspend fun removeMany(keys: Collection<String>) {
+        for (key in keys) remove(key)
+    }
+
+    /**
+     * Get every value whose key starts with [prefix].
+     *
+     * Key-value stores that cannot enumerate keys may leave the default, which throws
+     * [UnsupportedOperationException]; the SDK never requires it.
+     *
+     * @param prefix Key prefix to match; an empty prefix matches every key
+     * @return Matching keys and their values
+     * @throws WalletKitStorageException if storage access fails
+     */
+    suspend fun getByPrefix(prefix: String): Map<String, String> =
+        throw UnsupportedOperationException("Prefix scans are not supported by this storage")
 }
@@ -39,6 +39,16 @@ sealed class TONWalletKitStorageType {
      */
     data object Encrypted : TONWalletKitStorageType()
 
+    /**
+     * Encrypted persistent storage in an append-only journal.
+     *
+     * Each write appends one AES-256-GCM encrypted record instead of re-encrypting the whole
+     * store, so writes stay cheap as sessions and events accumulate. The journal is compacted
+     * in the background of writes. Data stored by [Encrypted] is copied over the first time
+     * the journal is created.
+     */
+    data object Journaled : TONWalletKitStorageType()
+
     /**
      * Custom storage implementation.
      *
@@ -130,6 +130,9 @@ val walletKitDistDir: File =
         .toFile()
 val walletKitAssetsDir: File = layout.projectDirectory.dir("src/main/assets/walletkit").asFile
 
+// Android-side bundle changes not yet in the monorepo; re-applied after every sync.
+val walletKitBridgePatch: File = layout.projectDirectory.file("bridge-patches/walletkit-android-bridge.patch").asFile
+
 // Task to copy WebView bundle
 val syncWalletKitWebViewAssets =
     tasks.register<Copy>("syncWalletKitWebViewAssets") {
@@ -179,14 +182,47 @@ val syncWalletKitWebViewAssets =
         }
     }
 
-// Ensure the WebView bundle is copied before assembling the AAR (but not for tests).
+// Task to re-apply the Android-side changes to a freshly synced bundle
+val applyWalletKitBridgePatch =
+    tasks.register<Exec>("applyWalletKitBridgePatch") {
+        group = "walletkit"
+        description = "Apply bridge-patches/walletkit-android-bridge.patch to the synced WebView bundle."
+        dependsOn(syncWalletKitWebViewAssets)
+
+        // Without dist-android nothing was synced, and the committed bundle is already patched.
+        onlyIf { walletKitDistDir.exists() && walletKitBridgePatch.exists() }
+        workingDir = walletKitAssetsDir
+        commandLine("patch", "-p1", "--forward", "--batch", "-i", walletKitBridgePatch.absolutePath)
+        isIgnoreExitValue = true
+
+        doLast {
+            if (executionResult.get().exitValue != 0) {
+                throw GradleException(
+                    """
+                    ❌ ${walletKitBridgePatch.name} no longer applies to the synced bundle.
+
+                    Drop the hunks the monorepo already ships, or rebase the rest onto the new
+                    bundle, then run syncWalletKitWebViewAssets again. Packaging the bundle
+                    without them would fail the bridge protocol check at startup.
+                    """.trimIndent(),
+                )
+            }
+            // The upstream source map describes the unpatched bundle.
+            walletKitAssetsDir.resolve("walletkit-android-bridge.mjs.map").delete()
+            logger.lifecycle("✅ Applied ${walletKitBridgePatch.name}")
+        }
+    }
+
+syncWalletKitWebViewAssets.configure { finalizedBy(applyWalletKitBridgePatch) }
+
+// Ensure the WebView bundle is copied and patched before assembling the AAR (but not for tests).
 tasks.matching { it.name.contains("assemble") && !it.name.contains("Test") }.configureEach {
-    dependsOn(syncWalletKitWebViewAssets)
+    dependsOn(applyWalletKitBridgePatch)
 }
 
 // Fix implicit dependency warnings by explicitly declaring dependencies on merge tasks.
 tasks.matching { it.name.contains("merge") && it.name.contains("Assets") }.configureEach {
-    dependsOn(syncWalletKitWebViewAssets)
+    dependsOn(applyWalletKitBridgePatch)
 }
 
 dependencies {
@@ -197,6 +233,7 @@ dependencies {
 
     implementation(libs.androidxCoreKtx)
     implementation(libs.androidxLifecycleRuntimeKtx)
+    implementation(libs.androidxLifecycleProcess)
     implementation(libs.kotlinxCoroutinesAndroid)
     implementation(libs.kotlinxSerializationJson)
     implementation(libs.androidxWebkit)
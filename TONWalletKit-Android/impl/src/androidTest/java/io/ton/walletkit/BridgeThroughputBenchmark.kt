@@ -0,0 +1,112 @@
+/*
+ * Copyright (c) 2025 TonTech
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+package io.ton.walletkit
+
+import android.content.Context
+import android.util.Log
+import androidx.test.ext.junit.runners.AndroidJUnit4
+import androidx.test.platform.app.InstrumentationRegistry
+import io.ton.walletkit.api.MAINNET
+import io.ton.walletkit.api.generated.TONNetwork
+import io.ton.walletkit.config.TONWalletKitConfiguration
+import io.ton.walletkit.engine.WalletKitEngine
+import io.ton.walletkit.engine.WebViewWalletKitEngine
+import io.ton.walletkit.storage.TONWalletKitStorageType
+import kotlinx.coroutines.Dispatchers
+import kotlinx.coroutines.async
+import kotlinx.coroutines.awaitAll
+import kotlinx.coroutines.runBlocking
+import kotlinx.coroutines.withContext
+import kotlinx.coroutines.withTimeout
+import org.junit.Assert.assertEquals
+import org.junit.Test
+import org.junit.runner.RunWith
+
+/**
+ * Bridge call throughput of the WebView engine.
+ *
+ * Initializes an engine, warms it up, then fires [CALLS] `createTonMnemonic` calls
+ * [CONCURRENCY] at a time and reports calls per second to logcat under [TAG]. Native crypto is
+ * off so every call crosses the bridge. It asks for [WORD_COUNT] words, the only length the
+ * bundle's helper produces.
+ */
+@RunWith(AndroidJUnit4::class)
+class BridgeThroughputBenchmark {
+
+    private val context: Context
+        get() = InstrumentationRegistry.getInstrumentation().targetContext
+
+    @Test
+    fun webViewEngineThroughput() = runBlocking {
+        val engine = withContext(Dispatchers.Main) { WebViewWalletKitEngine.createUncached(context, configuration) }
+        measure("webview", engine)
+    }
+
+    private suspend fun measure(label: String, engine: WalletKitEngine) {
+        try {
+            withTimeout(TIMEOUT_MILLIS) {
+                engine.init(configuration)
+                repeat(WARMUP_CALLS) { engine.createTonMnemonic(WORD_COUNT) }
+
+                val started = System.nanoTime()
+                repeat(CALLS / CONCURRENCY) {
+                    val batch = (1..CONCURRENCY).map { async(Dispatchers.Default) { engine.createTonMnemonic(WORD_COUNT) } }
+                    batch.awaitAll().forEach { assertEquals(WORD_COUNT, it.size) }
+                }
+                val elapsedMillis = (System.nanoTime() - started) / 1_000_000.0
+                Log.i(TAG, "$label: $CALLS calls in ${"%.1f".format(elapsedMillis)}ms, ${"%.0f".format(CALLS * 1000 / elapsedMillis)} calls/s")
+            }
+        } finally {
+            withContext(Dispatchers.Main) { engine.destroy() }
+        }
+    }
+
+    private val configuration = TONWalletKitConfiguration(
+        networkConfigurations = setOf(
+            TONWalletKitConfiguration.NetworkConfiguration(
+                network = TONNetwork.MAINNET,
+                apiClientConfiguration = TONWalletKitConfiguration.APIClientConfiguration(key = ""),
+            ),
+        ),
+        walletManifest = TONWalletKitConfiguration.Manifest(
+            name = "Benchmark Wallet",
+            appName = "Wallet",
+            imageUrl = "https://example.com/icon.png",
+            aboutUrl = "https://example.com",
+            universalLink = "https://example.com/tc",
+            bridgeUrl = "https://bridge.tonapi.io/bridge",
+        ),
+        bridge = TONWalletKitConfiguration.Bridge(bridgeUrl = "https://bridge.tonapi.io/bridge"),
+        features = listOf(TONWalletKitConfiguration.SendTransactionFeature(maxMessages = 4)),
+        storageType = TONWalletKitStorageType.Memory,
+        engineOptions = TONWalletKitConfiguration.EngineOptions(nativeCrypto = false),
+    )
+
+    private companion object {
+        private const val TAG = "BridgeThroughputBenchmark"
+        private const val WARMUP_CALLS = 20
+        private const val CALLS = 500
+        private const val CONCURRENCY = 10
+        private const val WORD_COUNT = 24
+        private const val TIMEOUT_MILLIS = 120_000L
+    }
+}
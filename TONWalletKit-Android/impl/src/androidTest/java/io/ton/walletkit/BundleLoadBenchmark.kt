@@ -0,0 +1,114 @@
+/*
+ * Copyright (c) 2025 TonTech
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+package io.ton.walletkit
+
+import android.content.Context
+import android.util.Log
+import android.webkit.WebView
+import androidx.test.ext.junit.runners.AndroidJUnit4
+import androidx.test.platform.app.InstrumentationRegistry
+import io.ton.walletkit.config.TONWalletKitConfiguration
+import io.ton.walletkit.engine.infrastructure.StartupPhase
+import io.ton.walletkit.engine.infrastructure.StartupTimeline
+import io.ton.walletkit.engine.infrastructure.WebViewManager
+import io.ton.walletkit.internal.constants.WebViewConstants
+import kotlinx.coroutines.CompletableDeferred
+import kotlinx.coroutines.Dispatchers
+import kotlinx.coroutines.delay
+import kotlinx.coroutines.runBlocking
+import kotlinx.coroutines.withContext
+import kotlinx.coroutines.withTimeout
+import kotlinx.serialization.json.Json
+import org.junit.Assert.assertNotNull
+import org.junit.Test
+import org.junit.runner.RunWith
+
+/**
+ * Cold vs. warm load of the bridge bundle.
+ *
+ * The cold run starts from an empty WebView cache; the warm runs reuse what the previous load
+ * left behind, including V8's code cache for the content-hashed bundle URL. Each run reports the
+ * time from navigation start until the bundle finished evaluating, plus the page-finished phase.
+ * Results go to logcat under [TAG]; the test only fails if the bundle never evaluates.
+ */
+@RunWith(AndroidJUnit4::class)
+class BundleLoadBenchmark {
+
+    @Test
+    fun coldVsWarmBundleLoad() = runBlocking {
+        val context = InstrumentationRegistry.getInstrumentation().targetContext
+        withContext(Dispatchers.Main) { WebView(context).apply { clearCache(true) }.destroy() }
+
+        val cold = loadOnce(context)
+        val warm = (1..WARM_RUNS).map { loadOnce(context) }.sortedBy { it.evaluatedMillis }
+
+        val median = warm[warm.size / 2]
+        Log.i(TAG, "cold: $cold")
+        Log.i(TAG, "warm (median of $WARM_RUNS): $median")
+        Log.i(TAG, "compile delta: ${cold.evaluatedMillis - median.evaluatedMillis}ms")
+    }
+
+    private suspend fun loadOnce(context: Context): LoadResult {
+        val timeline = StartupTimeline()
+        val manager = withContext(Dispatchers.Main) {
+            WebViewManager(
+                context = context,
+                assetPath = WebViewConstants.DEFAULT_ASSET_PATH,
+                json = Json,
+                engineOptions = TONWalletKitConfiguration.EngineOptions(),
+                startupTimeline = timeline,
+            )
+        }
+        try {
+            val evaluated = withTimeout(LOAD_TIMEOUT_MILLIS) {
+                var value: Double? = null
+                while (value == null) {
+                    delay(POLL_MILLIS)
+                    value = readEvaluatedMillis(manager)
+                }
+                value
+            }
+            val pageFinished = timeline.elapsedMillis(StartupPhase.PAGE_FINISHED)
+            assertNotNull(pageFinished)
+            return LoadResult(evaluated, pageFinished!!)
+        } finally {
+            withContext(Dispatchers.Main) { manager.destroy() }
+        }
+    }
+
+    private suspend fun readEvaluatedMillis(manager: WebViewManager): Double? {
+        val result = CompletableDeferred<String?>()
+        withContext(Dispatchers.Main) {
+            manager.asView().evaluateJavascript("window.__WALLETKIT_BUNDLE_EVALUATED_MS__ ?? null") { result.complete(it) }
+        }
+        return result.await()?.toDoubleOrNull()
+    }
+
+    private data class LoadResult(val evaluatedMillis: Double, val pageFinishedMillis: Long)
+
+    private companion object {
+        private const val TAG = "BundleLoadBenchmark"
+        private const val WARM_RUNS = 5
+        private const val LOAD_TIMEOUT_MILLIS = 30_000L
+        private const val POLL_MILLIS = 20L
+    }
+}
@@ -0,0 +1,110 @@
+/*
+ * Copyright (c) 2025 TonTech
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+package io.ton.walletkit
+
+import android.content.Context
+import androidx.test.ext.junit.runners.AndroidJUnit4
+import androidx.test.platform.app.InstrumentationRegistry
+import io.ton.walletkit.api.MAINNET
+import io.ton.walletkit.api.generated.TONNetwork
+import io.ton.walletkit.config.TONWalletKitConfiguration
+import io.ton.walletkit.engine.WebViewWalletKitEngine
+import io.ton.walletkit.engine.infrastructure.WebViewManager
+import io.ton.walletkit.internal.constants.WebViewConstants
+import io.ton.walletkit.storage.TONWalletKitStorageType
+import kotlinx.coroutines.CoroutineStart
+import kotlinx.coroutines.Dispatchers
+import kotlinx.coroutines.async
+import kotlinx.coroutines.runBlocking
+import kotlinx.coroutines.withContext
+import kotlinx.coroutines.withTimeout
+import org.junit.Assert.assertEquals
+import org.junit.Assert.assertTrue
+import org.junit.Test
+import org.junit.runner.RunWith
+
+/**
+ * Recovery from a reloaded bridge page: calls in flight across the reload, and calls made right
+ * after it, must complete in the fresh JS context.
+ */
+@RunWith(AndroidJUnit4::class)
+class ContextRecoveryTest {
+
+    private val context: Context
+        get() = InstrumentationRegistry.getInstrumentation().targetContext
+
+    @Test
+    fun callInFlightDuringReload_completesInFreshContext() = runBlocking {
+        val webViewManager = withContext(Dispatchers.Main) {
+            WebViewManager(
+                context = context,
+                assetPath = WebViewConstants.DEFAULT_ASSET_PATH,
+                json = WebViewWalletKitEngine.bridgeJson,
+            )
+        }
+        val engine = withContext(Dispatchers.Main) { WebViewWalletKitEngine.createUncached(context, configuration, webViewManager) }
+        try {
+            withTimeout(TIMEOUT_MILLIS) {
+                engine.init(configuration)
+
+                val wallets = withContext(Dispatchers.Main) {
+                    // Undispatched, so the call is queued on the bridge before the reload starts.
+                    val call = async(start = CoroutineStart.UNDISPATCHED) { engine.getWallets() }
+                    webViewManager.asView().reload()
+                    call
+                }
+
+                assertTrue(wallets.await().isEmpty())
+                assertEquals(WORD_COUNT, engine.createTonMnemonic(WORD_COUNT).size)
+            }
+        } finally {
+            withContext(Dispatchers.Main) { engine.destroy() }
+        }
+    }
+
+    private val configuration = TONWalletKitConfiguration(
+        networkConfigurations = setOf(
+            TONWalletKitConfiguration.NetworkConfiguration(
+                network = TONNetwork.MAINNET,
+                apiClientConfiguration = TONWalletKitConfiguration.APIClientConfiguration(key = ""),
+            ),
+        ),
+        walletManifest = TONWalletKitConfiguration.Manifest(
+            name = "Test Wallet",
+            appName = "Wallet",
+            imageUrl = "https://example.com/icon.png",
+            aboutUrl = "https://example.com",
+            universalLink = "https://example.com/tc",
+            bridgeUrl = "https://bridge.tonapi.io/bridge",
+        ),
+        bridge = TONWalletKitConfiguration.Bridge(bridgeUrl = "https://bridge.tonapi.io/bridge"),
+        features = listOf(TONWalletKitConfiguration.SendTransactionFeature(maxMessages = 4)),
+        storageType = TONWalletKitStorageType.Memory,
+        // Mnemonics then come from the fresh JS context rather than native code.
+        engineOptions = TONWalletKitConfiguration.EngineOptions(nativeCrypto = false),
+    )
+
+    private companion object {
+        private const val WORD_COUNT = 24
+        private const val TIMEOUT_MILLIS = 60_000L
+    }
+}
@@ -0,0 +1,128 @@
+/*
+ * Copyright (c) 2025 TonTech
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+package io.ton.walletkit
+
+import android.util.Log
+import androidx.test.ext.junit.runners.AndroidJUnit4
+import androidx.test.platform.app.InstrumentationRegistry
+import io.ton.walletkit.api.MAINNET
+import io.ton.walletkit.api.generated.TONNetwork
+import io.ton.walletkit.config.TONWalletKitConfiguration
+import io.ton.walletkit.engine.WalletKitEngine
+import io.ton.walletkit.engine.WebViewWalletKitEngine
+import io.ton.walletkit.storage.TONWalletKitStorageType
+import kotlinx.coroutines.Dispatchers
+import kotlinx.coroutines.runBlocking
+import kotlinx.coroutines.withContext
+import kotlinx.coroutines.withTimeout
+import org.junit.Assert.assertArrayEquals
+import org.junit.Assert.assertEquals
+import org.junit.Test
+import org.junit.runner.RunWith
+
+/**
+ * Native crypto against the JS bundle on the same device.
+ *
+ * Runs mnemonic generation, key derivation and signing on one engine with
+ * [TONWalletKitConfiguration.EngineOptions.nativeCrypto] and one without, checks that keys and
+ * signatures agree, and reports the median time of each operation to logcat under [TAG].
+ */
+@RunWith(AndroidJUnit4::class)
+class NativeCryptoBenchmark {
+
+    @Test
+    fun nativeVsJsCrypto() = runBlocking {
+        val native = engine(nativeCrypto = true)
+        val js = engine(nativeCrypto = false)
+        try {
+            withTimeout(TIMEOUT_MILLIS) {
+                val mnemonic = js.createTonMnemonic(24)
+                val jsKeys = js.mnemonicToKeyPair(mnemonic)
+                val nativeKeys = native.mnemonicToKeyPair(mnemonic)
+                assertArrayEquals(jsKeys.secretKey, nativeKeys.secretKey)
+                assertArrayEquals(jsKeys.publicKey, nativeKeys.publicKey)
+
+                val message = "walletkit".encodeToByteArray()
+                assertArrayEquals(js.sign(message, jsKeys.secretKey), native.sign(message, nativeKeys.secretKey))
+                assertEquals(24, native.createTonMnemonic(24).size)
+
+                report("createTonMnemonic", { js.createTonMnemonic(24) }, { native.createTonMnemonic(24) })
+                report("mnemonicToKeyPair", { js.mnemonicToKeyPair(mnemonic) }, { native.mnemonicToKeyPair(mnemonic) })
+                report("sign", { js.sign(message, jsKeys.secretKey) }, { native.sign(message, nativeKeys.secretKey) })
+            }
+        } finally {
+            withContext(Dispatchers.Main) {
+                native.destroy()
+                js.destroy()
+            }
+        }
+    }
+
+    private suspend fun report(operation: String, js: suspend () -> Any, native: suspend () -> Any) {
+        val jsMillis = medianMillis(js)
+        val nativeMillis = medianMillis(native)
+        Log.i(TAG, "$operation: js ${"%.2f".format(jsMillis)}ms, native ${"%.2f".format(nativeMillis)}ms, ${"%.1f".format(jsMillis / nativeMillis)}x")
+    }
+
+    private suspend fun medianMillis(block: suspend () -> Any): Double {
+        block()
+        val samples = (1..RUNS).map {
+            val started = System.nanoTime()
+            block()
+            (System.nanoTime() - started) / 1_000_000.0
+        }
+        return samples.sorted()[RUNS / 2]
+    }
+
+    private suspend fun engine(nativeCrypto: Boolean): WalletKitEngine {
+        val context = InstrumentationRegistry.getInstrumentation().targetContext
+        val configuration = TONWalletKitConfiguration(
+            networkConfigurations = setOf(
+                TONWalletKitConfiguration.NetworkConfiguration(
+                    network = TONNetwork.MAINNET,
+                    apiClientConfiguration = TONWalletKitConfiguration.APIClientConfiguration(key = ""),
+                ),
+            ),
+            walletManifest = TONWalletKitConfiguration.Manifest(
+                name = "Benchmark Wallet",
+                appName = "Wallet",
+                imageUrl = "https://example.com/icon.png",
+                aboutUrl = "https://example.com",
+                universalLink = "https://example.com/tc",
+                bridgeUrl = "https://bridge.tonapi.io/bridge",
+            ),
+            bridge = TONWalletKitConfiguration.Bridge(bridgeUrl = "https://bridge.tonapi.io/bridge"),
+            features = listOf(TONWalletKitConfiguration.SendTransactionFeature(maxMessages = 4)),
+            storageType = TONWalletKitStorageType.Memory,
+            engineOptions = TONWalletKitConfiguration.EngineOptions(nativeCrypto = nativeCrypto),
+        )
+        val engine = withContext(Dispatchers.Main) { WebViewWalletKitEngine.createUncached(context, configuration) }
+        engine.init(configuration)
+        return engine
+    }
+
+    private companion object {
+        private const val TAG = "NativeCryptoBenchmark"
+        private const val RUNS = 9
+        private const val TIMEOUT_MILLIS = 300_000L
+    }
+}
@@ -0,0 +1,156 @@
+/*
+ * Copyright (c) 2025 TonTech
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+package io.ton.walletkit
+
+import android.util.Log
+import androidx.test.ext.junit.runners.AndroidJUnit4
+import androidx.test.platform.app.InstrumentationRegistry
+import io.ton.walletkit.api.MAINNET
+import io.ton.walletkit.api.generated.TONNetwork
+import io.ton.walletkit.config.TONWalletKitConfiguration
+import io.ton.walletkit.engine.WalletKitEngine
+import io.ton.walletkit.engine.WebViewWalletKitEngine
+import io.ton.walletkit.engine.operations.requests.CreateMnemonicRequest
+import io.ton.walletkit.internal.constants.BridgeMethodConstants
+import io.ton.walletkit.model.TONWalletImportRequest
+import io.ton.walletkit.storage.TONWalletKitStorage
+import io.ton.walletkit.storage.TONWalletKitStorageType
+import kotlinx.coroutines.Dispatchers
+import kotlinx.coroutines.async
+import kotlinx.coroutines.flow.toList
+import kotlinx.coroutines.runBlocking
+import kotlinx.coroutines.withContext
+import kotlinx.coroutines.withTimeout
+import org.junit.Test
+import org.junit.runner.RunWith
+import java.util.concurrent.ConcurrentHashMap
+
+/**
+ * How long storage traffic stalls the JS event loop.
+ *
+ * The engine runs on a storage whose every operation blocks for [STORAGE_LATENCY_MILLIS], like an
+ * `EncryptedSharedPreferences` commit. A probe times back-to-back `createTonMnemonic` bridge calls,
+ * first on an idle engine, then while [WALLETS] imported wallets are being persisted. Each probe
+ * goes to JS even with native crypto on, which keeps deriving the imported keys off the JS loop,
+ * so the extra latency under load is the stall storage causes; p50 and max of both
+ * runs are reported to logcat under [TAG]. Run it on builds with and without the asynchronous
+ * storage protocol to compare them.
+ */
+@RunWith(AndroidJUnit4::class)
+class StorageStallBenchmark {
+
+    @Test
+    fun jsLoopStallDuringStorageTraffic() = runBlocking {
+        val engine = engine()
+        try {
+            withTimeout(TIMEOUT_MILLIS) {
+                val mnemonics = List(WALLETS) { engine.createTonMnemonic(24) }
+                val idle = probe(engine) { true }
+
+                val import = async(Dispatchers.Default) {
+                    engine.addWallets(mnemonics.map { TONWalletImportRequest(mnemonic = it) }).toList()
+                }
+                val busy = probe(engine) { !import.isCompleted }
+                import.await()
+
+                Log.i(TAG, "idle: ${summary(idle)}; during storage traffic: ${summary(busy)}")
+            }
+        } finally {
+            withContext(Dispatchers.Main) { engine.destroy() }
+        }
+    }
+
+    private suspend fun probe(engine: WalletKitEngine, active: () -> Boolean): List<Long> {
+        val latencies = mutableListOf<Long>()
+        while (latencies.size < PROBES && active()) {
+            val started = System.nanoTime()
+            engine.callBridgeMethod(BridgeMethodConstants.METHOD_CREATE_TON_MNEMONIC, CreateMnemonicRequest(count = 24))
+            latencies += (System.nanoTime() - started) / 1_000
+        }
+        return latencies
+    }
+
+    private fun summary(micros: List<Long>): String {
+        if (micros.isEmpty()) return "no samples"
+        val sorted = micros.sorted()
+        return "${sorted.size} probes, p50 ${sorted[sorted.size / 2] / 1000.0}ms, max ${sorted.last() / 1000.0}ms"
+    }
+
+    private suspend fun engine(): WalletKitEngine {
+        val context = InstrumentationRegistry.getInstrumentation().targetContext
+        val configuration = TONWalletKitConfiguration(
+            networkConfigurations = setOf(
+                TONWalletKitConfiguration.NetworkConfiguration(
+                    network = TONNetwork.MAINNET,
+                    apiClientConfiguration = TONWalletKitConfiguration.APIClientConfiguration(key = ""),
+                ),
+            ),
+            walletManifest = TONWalletKitConfiguration.Manifest(
+                name = "Benchmark Wallet",
+                appName = "Wallet",
+                imageUrl = "https://example.com/icon.png",
+                aboutUrl = "https://example.com",
+                universalLink = "https://example.com/tc",
+                bridgeUrl = "https://bridge.tonapi.io/bridge",
+            ),
+            bridge = TONWalletKitConfiguration.Bridge(bridgeUrl = "https://bridge.tonapi.io/bridge"),
+            features = listOf(TONWalletKitConfiguration.SendTransactionFeature(maxMessages = 4)),
+            storageType = TONWalletKitStorageType.Custom(SlowStorage()),
+        )
+        val engine = withContext(Dispatchers.Main) { WebViewWalletKitEngine.createUncached(context, configuration) }
+        engine.init(configuration)
+        return engine
+    }
+
+    /** In-memory storage that blocks its calling thread on every operation. */
+    private class SlowStorage : TONWalletKitStorage {
+        private val values = ConcurrentHashMap<String, String>()
+
+        override suspend fun get(key: String): String? {
+            Thread.sleep(STORAGE_LATENCY_MILLIS)
+            return values[key]
+        }
+
+        override suspend fun set(key: String, value: String) {
+            Thread.sleep(STORAGE_LATENCY_MILLIS)
+            values[key] = value
+        }
+
+        override suspend fun remove(key: String) {
+            Thread.sleep(STORAGE_LATENCY_MILLIS)
+            values.remove(key)
+        }
+
+        override suspend fun clear() {
+            Thread.sleep(STORAGE_LATENCY_MILLIS)
+            values.clear()
+        }
+    }
+
+    private companion object {
+        private const val TAG = "StorageStallBenchmark"
+        private const val WALLETS = 20
+        private const val PROBES = 200
+        private const val STORAGE_LATENCY_MILLIS = 15L
+        private const val TIMEOUT_MILLIS = 300_000L
+    }
+}
@@ -0,0 +1,127 @@
+/*
+ * Copyright (c) 2025 TonTech
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+package io.ton.walletkit
+
+import android.util.Log
+import androidx.test.ext.junit.runners.AndroidJUnit4
+import androidx.test.platform.app.InstrumentationRegistry
+import io.ton.walletkit.api.MAINNET
+import io.ton.walletkit.api.WalletVersions
+import io.ton.walletkit.api.generated.TONNetwork
+import io.ton.walletkit.config.TONWalletKitConfiguration
+import io.ton.walletkit.engine.WalletKitEngine
+import io.ton.walletkit.engine.WebViewWalletKitEngine
+import io.ton.walletkit.engine.model.WalletImportResult
+import io.ton.walletkit.model.TONWalletImportRequest
+import io.ton.walletkit.storage.TONWalletKitStorageType
+import kotlinx.coroutines.Dispatchers
+import kotlinx.coroutines.flow.toList
+import kotlinx.coroutines.runBlocking
+import kotlinx.coroutines.withContext
+import kotlinx.coroutines.withTimeout
+import org.junit.Assert.assertEquals
+import org.junit.Assert.assertTrue
+import org.junit.Test
+import org.junit.runner.RunWith
+
+/**
+ * Restoring [WALLETS] wallets one by one against [WalletKitEngine.addWallets].
+ *
+ * The serial path is what apps did before: createSignerFromMnemonic, createAdapter and addWallet
+ * per wallet, each a bridge round trip plus the getWalletAddress lookup inside addWallet. Both
+ * paths run on fresh engines with distinct mnemonics, and the wall time of each is reported to
+ * logcat under [TAG].
+ */
+@RunWith(AndroidJUnit4::class)
+class WalletImportBenchmark {
+
+    @Test
+    fun serialVsBatchImport() = runBlocking {
+        val serial = engine()
+        val batch = engine()
+        try {
+            withTimeout(TIMEOUT_MILLIS) {
+                val serialMnemonics = List(WALLETS) { batch.createTonMnemonic(24) }
+                val batchMnemonics = List(WALLETS) { batch.createTonMnemonic(24) }
+
+                val serialStarted = System.nanoTime()
+                serialMnemonics.forEach { mnemonic ->
+                    val signer = serial.createSignerFromMnemonic(mnemonic)
+                    val adapter = serial.createAdapter(
+                        signerId = signer.signerId,
+                        publicKey = signer.publicKey,
+                        version = WalletVersions.V5R1,
+                        network = TONNetwork.MAINNET,
+                    )
+                    serial.addWallet(adapter)
+                }
+                val serialMillis = (System.nanoTime() - serialStarted) / 1_000_000
+
+                val batchStarted = System.nanoTime()
+                val results = batch.addWallets(batchMnemonics.map { TONWalletImportRequest(mnemonic = it) }).toList()
+                val batchMillis = (System.nanoTime() - batchStarted) / 1_000_000
+
+                assertEquals((0 until WALLETS).toList(), results.map { it.index })
+                assertTrue(results.all { it is WalletImportResult.Added })
+                assertEquals(WALLETS, batch.getWallets().size)
+                Log.i(TAG, "$WALLETS wallets: serial ${serialMillis}ms, addWallets ${batchMillis}ms")
+            }
+        } finally {
+            withContext(Dispatchers.Main) {
+                serial.destroy()
+                batch.destroy()
+            }
+        }
+    }
+
+    private suspend fun engine(): WalletKitEngine {
+        val context = InstrumentationRegistry.getInstrumentation().targetContext
+        val configuration = TONWalletKitConfiguration(
+            networkConfigurations = setOf(
+                TONWalletKitConfiguration.NetworkConfiguration(
+                    network = TONNetwork.MAINNET,
+                    apiClientConfiguration = TONWalletKitConfiguration.APIClientConfiguration(key = ""),
+                ),
+            ),
+            walletManifest = TONWalletKitConfiguration.Manifest(
+                name = "Benchmark Wallet",
+                appName = "Wallet",
+                imageUrl = "https://example.com/icon.png",
+                aboutUrl = "https://example.com",
+                universalLink = "https://example.com/tc",
+                bridgeUrl = "https://bridge.tonapi.io/bridge",
+            ),
+            bridge = TONWalletKitConfiguration.Bridge(bridgeUrl = "https://bridge.tonapi.io/bridge"),
+            features = listOf(TONWalletKitConfiguration.SendTransactionFeature(maxMessages = 4)),
+            storageType = TONWalletKitStorageType.Memory,
+        )
+        val engine = withContext(Dispatchers.Main) { WebViewWalletKitEngine.createUncached(context, configuration) }
+        engine.init(configuration)
+        return engine
+    }
+
+    private companion object {
+        private const val TAG = "WalletImportBenchmark"
+        private const val WALLETS = 50
+        private const val TIMEOUT_MILLIS = 600_000L
+    }
+}
@@ -0,0 +1,80 @@
+/*
+ * Copyright (c) 2025 TonTech
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+package io.ton.walletkit.storage
+
+import android.util.Log
+import androidx.test.ext.junit.runners.AndroidJUnit4
+import androidx.test.platform.app.InstrumentationRegistry
+import kotlinx.coroutines.runBlocking
+import org.junit.Assert.assertEquals
+import org.junit.Test
+import org.junit.runner.RunWith
+
+/**
+ * [SecureBridgeStorageAdapter] against [JournaledBridgeStorageAdapter] on the bridge's write
+ * pattern.
+ *
+ * Each adapter is seeded with [SEEDED_KEYS] stored values of [VALUE_BYTES], then takes
+ * [WRITES] rewrites of a few hot keys (sessions, last event id), [READS] reads, and a clear.
+ * Per-operation times are reported to logcat under [TAG].
+ */
+@RunWith(AndroidJUnit4::class)
+class JournaledStorageBenchmark {
+
+    private val context = InstrumentationRegistry.getInstrumentation().targetContext
+
+    @Test
+    fun encryptedPreferencesVsJournal() = runBlocking {
+        measure("encrypted-prefs", SecureBridgeStorageAdapter(context))
+        measure("journal", JournaledBridgeStorageAdapter(context))
+    }
+
+    private suspend fun measure(label: String, adapter: BridgeStorageAdapter) {
+        adapter.clear()
+        val value = "x".repeat(VALUE_BYTES)
+        repeat(SEEDED_KEYS) { adapter.set("seed_$it", value) }
+
+        val writesStarted = System.nanoTime()
+        repeat(WRITES) { adapter.set(HOT_KEYS[it % HOT_KEYS.size], "$value-$it") }
+        val writeMicros = (System.nanoTime() - writesStarted) / 1_000 / WRITES
+
+        val readsStarted = System.nanoTime()
+        repeat(READS) { adapter.get(HOT_KEYS[it % HOT_KEYS.size]) }
+        val readMicros = (System.nanoTime() - readsStarted) / 1_000 / READS
+        assertEquals("$value-${WRITES - 1}", adapter.get(HOT_KEYS[(WRITES - 1) % HOT_KEYS.size]))
+
+        val clearStarted = System.nanoTime()
+        adapter.clear()
+        val clearMillis = (System.nanoTime() - clearStarted) / 1_000_000
+
+        Log.i(TAG, "$label: set ${writeMicros}us, get ${readMicros}us, clear ${clearMillis}ms with $SEEDED_KEYS keys")
+    }
+
+    private companion object {
+        private const val TAG = "JournaledStorageBenchmark"
+        private const val SEEDED_KEYS = 200
+        private const val VALUE_BYTES = 2_048
+        private const val WRITES = 300
+        private const val READS = 300
+        private val HOT_KEYS = listOf("sessions", "bridge_last_event_id", "durable_events")
+    }
+}
@@ -38873,27 +38873,47 @@ function hasAndroidSessionManager() {
 }
 /**
 * Android adapter for TONConnect session management.
-* Delegates all session operations to the Kotlin implementation via WebViewManager's JavaScript interface.
+* Delegates all session operations to the Kotlin implementation. Calls go to native as ordered
+* reverse-RPC requests, so session lookups on every bridge event no longer block the JS thread
+* and native answers filtered queries from its own indexes. Hosts that don't know the session
+* methods get the synchronous JavascriptInterface calls instead.
 */
 var AndroidTONConnectSessionsManager = class {
 	constructor() {
 		const win = window;
 		if (!win.WalletKitNative?.sessionCreate) throw new Error("Android native session manager bridge not available");
 		this.bridge = win.WalletKitNative;
+		this.asyncSessions = true;
+	}
+	/** Sends a session request, falling back to the synchronous bridge method if native lacks it. */
+	async call(method, params, legacy) {
+		if (this.asyncSessions) try {
+			return await bridgeRequest(method, params);
+		} catch (err) {
+			if (!String(err?.message).startsWith("Unknown reverse-RPC method")) throw err;
+			warn("[AndroidSessionManager] Native has no async sessions, using synchronous calls");
+			this.asyncSessions = false;
+		}
+		return legacy();
 	}
 	async initialize() {}
 	async createSession(sessionId, dAppInfo, wallet, isJsBridge) {
 		try {
 			const walletId = wallet.getWalletId?.() ?? "";
 			const walletAddress = wallet.getAddress?.() ?? "";
-			const dAppInfoJson = JSON.stringify({
+			const info = {
 				name: dAppInfo.name,
 				url: dAppInfo.url,
 				iconUrl: dAppInfo.iconUrl,
 				description: dAppInfo.description
-			});
-			const resultJson = this.bridge.sessionCreate(sessionId, dAppInfoJson, walletId, walletAddress, isJsBridge);
-			return JSON.parse(resultJson);
+			};
+			return await this.call("sessionCreate", {
+				sessionId,
+				dAppInfo: info,
+				walletId,
+				walletAddress,
+				isJsBridge: !!isJsBridge
+			}, () => JSON.parse(this.bridge.sessionCreate(sessionId, JSON.stringify(info), walletId, walletAddress, isJsBridge)));
 		} catch (err) {
 			error("[AndroidSessionManager] Failed to create session:", err);
 			throw err;
@@ -38901,9 +38921,10 @@ var AndroidTONConnectSessionsManager = class {
 	}
 	async getSession(sessionId) {
 		try {
-			const resultJson = this.bridge.sessionGet(sessionId);
-			if (!resultJson) return;
-			return JSON.parse(resultJson);
+			return await this.call("sessionGet", { sessionId }, () => {
+				const resultJson = this.bridge.sessionGet(sessionId);
+				return resultJson ? JSON.parse(resultJson) : null;
+			}) ?? void 0;
 		} catch (err) {
 			warn("[AndroidSessionManager] Failed to get session:", err);
 			return;
@@ -38911,9 +38932,8 @@ var AndroidTONConnectSessionsManager = class {
 	}
 	async getSessions(parameters) {
 		try {
-			const filterJson = JSON.stringify(parameters ?? {});
-			const resultJson = this.bridge.sessionGetFiltered(filterJson);
-			return JSON.parse(resultJson);
+			const filter = parameters ?? {};
+			return await this.call("sessionGetFiltered", filter, () => JSON.parse(this.bridge.sessionGetFiltered(JSON.stringify(filter))));
 		} catch (err) {
 			warn("[AndroidSessionManager] Failed to get sessions:", err);
 			return [];
@@ -38921,7 +38941,7 @@ var AndroidTONConnectSessionsManager = class {
 	}
 	async removeSession(sessionId) {
 		try {
-			this.bridge.sessionRemove(sessionId);
+			await this.call("sessionRemove", { sessionId }, () => this.bridge.sessionRemove(sessionId));
 		} catch (err) {
 			error("[AndroidSessionManager] Failed to remove session:", err);
 			throw err;
@@ -38929,8 +38949,8 @@ var AndroidTONConnectSessionsManager = class {
 	}
 	async removeSessions(parameters) {
 		try {
-			const filterJson = JSON.stringify(parameters ?? {});
-			this.bridge.sessionRemoveFiltered(filterJson);
+			const filter = parameters ?? {};
+			await this.call("sessionRemoveFiltered", filter, () => this.bridge.sessionRemoveFiltered(JSON.stringify(filter)));
 		} catch (err) {
 			error("[AndroidSessionManager] Failed to remove sessions:", err);
 			throw err;
@@ -38938,7 +38958,7 @@ var AndroidTONConnectSessionsManager = class {
 	}
 	async clearSessions() {
 		try {
-			this.bridge.sessionClear();
+			await this.call("sessionClear", {}, () => this.bridge.sessionClear());
 		} catch (err) {
 			error("[AndroidSessionManager] Failed to clear sessions:", err);
 			throw err;
@@ -39095,17 +39115,81 @@ function bigIntReplacer(_key, value) {
 *
 */
 var HANDSHAKE_TAG = "__walletkit_bridge_init";
+/**
+* Wire protocol this bundle speaks, reported to native in the `ready` message. Bump it whenever
+* the envelope format, reverse-RPC methods or call semantics change; native refuses older bundles.
+*/
+var BRIDGE_PROTOCOL_VERSION = 1;
+/**
+* Batched frames: FRAME_MARKER followed by `<length>:<envelope>` records, `length` being the
+* envelope's String.length. Must stay in sync with BridgeFrameCodec on the Kotlin side.
+*/
+var FRAME_MARKER = "\u001E";
+var FRAME_RECORD_OVERHEAD = 8;
 var port = null;
 var inboundCallback = null;
+var binaryCallback = null;
 var pendingOutbound = [];
+var batchQueue = [];
+var batchScheduled = false;
+function batchBudget() {
+	const bytes = Number(window.__WALLETKIT_BRIDGE_BATCH_BYTES__);
+	return Number.isFinite(bytes) && bytes > 0 ? bytes : 0;
+}
+function encodeFrame(envelopes) {
+	let frame = FRAME_MARKER;
+	for (const envelope of envelopes) frame += envelope.length + ":" + envelope;
+	return frame;
+}
+function decodeFrame(frame, onEnvelope) {
+	let offset = 1;
+	while (offset < frame.length) {
+		const separator = frame.indexOf(":", offset);
+		const length = separator > offset ? Number(frame.slice(offset, separator)) : NaN;
+		const start = separator + 1;
+		if (!Number.isInteger(length) || length < 0 || start + length > frame.length) throw new Error(`Malformed bridge frame at ${offset}`);
+		onEnvelope(frame.slice(start, start + length));
+		offset = start + length;
+	}
+}
+function flushBatch() {
+	batchScheduled = false;
+	if (!port || batchQueue.length === 0) return;
+	const budget = batchBudget();
+	const envelopes = batchQueue;
+	batchQueue = [];
+	let group = [];
+	let groupBytes = 1;
+	const emit = () => {
+		if (group.length === 1) port.postMessage(group[0]);
+		else if (group.length > 1) port.postMessage(encodeFrame(group));
+		group = [];
+		groupBytes = 1;
+	};
+	for (const envelope of envelopes) {
+		const recordBytes = envelope.length + FRAME_RECORD_OVERHEAD;
+		if (group.length > 0 && groupBytes + recordBytes > budget) emit();
+		group.push(envelope);
+		groupBytes += recordBytes;
+	}
+	emit();
+}
 function flushPending(p) {
 	while (pendingOutbound.length > 0) {
 		const next = pendingOutbound.shift();
-		p.postMessage(next);
+		sendToNative(next);
 	}
 }
 function sendToNative(json) {
 	if (port) {
+		if (batchBudget() > 0) {
+			batchQueue.push(json);
+			if (!batchScheduled) {
+				batchScheduled = true;
+				queueMicrotask(flushBatch);
+			}
+			return;
+		}
 		port.postMessage(json);
 		return;
 	}
@@ -39114,6 +39198,18 @@ function sendToNative(json) {
 function setInboundCallback(callback) {
 	inboundCallback = callback;
 }
+function setBinaryCallback(callback) {
+	binaryCallback = callback;
+}
+/**
+* Posts an ArrayBuffer on the port, transferring ownership. Returns false before the handshake;
+* binary messages are never queued, callers fall back to JSON instead.
+*/
+function sendBinaryToNative(buffer) {
+	if (!port) return false;
+	port.postMessage(buffer, [buffer]);
+	return true;
+}
 function installPortHandshake() {
 	window.addEventListener("message", (event) => {
 		if (event.data !== HANDSHAKE_TAG) {
@@ -39130,13 +39226,26 @@ function installPortHandshake() {
 			return;
 		}
 		incoming.onmessage = (e) => {
+			if (e.data instanceof ArrayBuffer) {
+				if (binaryCallback) binaryCallback(e.data);
+				else warn("[walletkitBridge] Binary port message arrived before callback was installed");
+				return;
+			}
 			const data = typeof e.data === "string" ? e.data : JSON.stringify(e.data);
 			const cb = inboundCallback;
 			if (!cb) {
 				warn("[walletkitBridge] Inbound port message arrived before callback was installed");
 				return;
 			}
-			cb(data);
+			if (data.charAt(0) !== FRAME_MARKER) {
+				cb(data);
+				return;
+			}
+			try {
+				decodeFrame(data, cb);
+			} catch (err) {
+				error("[walletkitBridge] Dropping malformed bridge frame", err);
+			}
 		};
 		incoming.start();
 		port = incoming;
@@ -39144,6 +39253,87 @@ function installPortHandshake() {
 	});
 }
 //#endregion
+//#region src/transport/binary.ts
+/**
+* ArrayBuffer side channel for byte payloads. One message carries every attachment of one
+* envelope: magic:u8 | idLength:u8 | id:utf8 | count:u8 | length:u32be * count | payloads.
+* Envelopes reference attachments as { __bin: index } and carry a `bin` count. Ids are keyed
+* as strings here: native call ids are numbers in JSON but text in the binary header.
+* Must stay in sync with BridgeBinaryCodec on the Kotlin side.
+*/
+var BINARY_MAGIC = 177;
+var inboundAttachments = /* @__PURE__ */ new Map();
+function encodeAttachments(id, parts) {
+	const idBytes = new TextEncoder().encode(String(id));
+	let offset = 3 + idBytes.length + 4 * parts.length;
+	const buffer = new ArrayBuffer(parts.reduce((total, part) => total + part.length, offset));
+	const view = new DataView(buffer);
+	const bytes = new Uint8Array(buffer);
+	view.setUint8(0, BINARY_MAGIC);
+	view.setUint8(1, idBytes.length);
+	bytes.set(idBytes, 2);
+	view.setUint8(2 + idBytes.length, parts.length);
+	parts.forEach((part, i) => {
+		view.setUint32(3 + idBytes.length + 4 * i, part.length);
+		bytes.set(part, offset);
+		offset += part.length;
+	});
+	return buffer;
+}
+function decodeAttachments(buffer) {
+	const view = new DataView(buffer);
+	if (buffer.byteLength < 3 || view.getUint8(0) !== BINARY_MAGIC) throw new Error("Not a bridge binary message");
+	const idLength = view.getUint8(1);
+	const id = new TextDecoder().decode(new Uint8Array(buffer, 2, idLength));
+	const count = view.getUint8(2 + idLength);
+	let offset = 3 + idLength + 4 * count;
+	const parts = [];
+	for (let i = 0; i < count; i++) {
+		const length = view.getUint32(3 + idLength + 4 * i);
+		if (offset + length > buffer.byteLength) throw new Error("Truncated binary payload");
+		parts.push(new Uint8Array(buffer, offset, length));
+		offset += length;
+	}
+	return {
+		id,
+		parts
+	};
+}
+/** Stores attachments for their envelope, or hands them to a call already waiting on them. */
+function acceptAttachments(buffer) {
+	let decoded;
+	try {
+		decoded = decodeAttachments(buffer);
+	} catch (err) {
+		error("[walletkitBridge] Dropping malformed binary message", err);
+		return;
+	}
+	const waiter = inboundAttachments.get(decoded.id);
+	if (typeof waiter === "function") {
+		inboundAttachments.delete(decoded.id);
+		waiter(decoded.parts);
+		return;
+	}
+	inboundAttachments.set(decoded.id, decoded.parts);
+}
+function takeAttachments(id) {
+	const key = String(id);
+	const parts = inboundAttachments.get(key);
+	if (Array.isArray(parts)) {
+		inboundAttachments.delete(key);
+		return Promise.resolve(parts);
+	}
+	return new Promise((resolve) => inboundAttachments.set(key, resolve));
+}
+function resolveBinaryRefs(value, parts) {
+	if (Array.isArray(value)) return value.map((item) => resolveBinaryRefs(item, parts));
+	if (!value || typeof value !== "object") return value;
+	if (typeof value.__bin === "number") return parts[value.__bin];
+	const resolved = {};
+	for (const [key, item] of Object.entries(value)) resolved[key] = resolveBinaryRefs(item, parts);
+	return resolved;
+}
+//#endregion
 //#region src/transport/nativeBridge.ts
 init_dist();
 var pendingRequests = /* @__PURE__ */ new Map();
@@ -39152,12 +39342,18 @@ function bridgeRequestSync(method, params) {
 	if (!native || typeof native.adapterCallSync !== "function") throw new Error("WalletKitNative.adapterCallSync not available");
 	return native.adapterCallSync(method, JSON.stringify(params));
 }
+/** Native answers with this code when its request executor is saturated; the request is retried. */
+const NATIVE_BUSY_CODE = "busy";
+const NATIVE_BUSY_MAX_RETRIES = 6;
 function bridgeRequest(method, params) {
 	const id = v7();
 	return new Promise((resolve, reject) => {
 		pendingRequests.set(id, {
 			resolve,
-			reject
+			reject,
+			method,
+			params,
+			retries: 0
 		});
 		postToNative({
 			kind: "request",
@@ -39167,6 +39363,20 @@ function bridgeRequest(method, params) {
 		});
 	});
 }
+/** Re-sends a request native refused as busy, backing off exponentially from its hint. */
+function retryBusyRequest(id, entry, retryAfterMs) {
+	entry.retries += 1;
+	const delay = (retryAfterMs ?? 50) * 2 ** (entry.retries - 1);
+	setTimeout(() => {
+		pendingRequests.set(id, entry);
+		postToNative({
+			kind: "request",
+			id,
+			method: entry.method,
+			params: entry.params
+		});
+	}, delay);
+}
 /**
 * Reconstructs a native callback that crossed the bridge as a WrappedFunctionRef into a callable.
 * The function itself can't be serialized, so the returned wrapper forwards its arguments through
@@ -39184,7 +39394,11 @@ function unwrapRef(ref) {
 	});
 	return registry.wrapped_funcs[refId];
 }
-function handleNativeResponse(id, resultJson, errorJson) {
+/**
+* Native embeds reverse-RPC results as structured JSON in the envelope, so the result is
+* already decoded by the time it gets here; strings are plain values, not nested JSON.
+*/
+function handleNativeResponse(id, result, errorJson) {
 	const entry = pendingRequests.get(id);
 	if (!entry) {
 		warn("[walletkitBridge] handleNativeResponse: no pending request for id", id);
@@ -39193,18 +39407,14 @@ function handleNativeResponse(id, resultJson, errorJson) {
 	pendingRequests.delete(id);
 	if (errorJson) {
 		const err = errorJson;
+		if (err.code === NATIVE_BUSY_CODE && entry.retries < NATIVE_BUSY_MAX_RETRIES) {
+			retryBusyRequest(id, entry, err.retryAfterMs);
+			return;
+		}
 		entry.reject(new Error(err.message ?? "Native request failed"));
 		return;
 	}
-	if (resultJson === null || resultJson === void 0) {
-		entry.resolve(void 0);
-		return;
-	}
-	if (typeof resultJson === "string") {
-		entry.resolve(JSON.parse(resultJson));
-		return;
-	}
-	entry.resolve(resultJson);
+	entry.resolve(result ?? void 0);
 }
 function postToNative(payload) {
 	if (payload === null || typeof payload !== "object" && typeof payload !== "function") {
@@ -39221,6 +39431,41 @@ function postToNative(payload) {
 //#region src/core/initialization.ts
 init_JSBridgeInjector();
 /**
+* Builds the API client (or client options) for one entry of `networkConfigurations`.
+*/
+function createNetworkApiClient(netConfig) {
+	const type = netConfig.apiClientType;
+	if (type === "tonapi") return new ApiClientTonApi({
+		endpoint: netConfig.apiClientConfiguration?.url,
+		apiKey: netConfig.apiClientConfiguration?.key,
+		network: netConfig.network
+	});
+	if (type === "toncenter") return new ApiClientToncenter({
+		endpoint: netConfig.apiClientConfiguration?.url,
+		apiKey: netConfig.apiClientConfiguration?.key
+	});
+	return netConfig.apiClientConfiguration;
+}
+/**
+* Adds networks to an initialized WalletKit, so one JS context can serve several networks.
+* Networks that are already configured are left untouched; per-network state stays keyed by chainId.
+*
+* @returns The chainIds that were added.
+*/
+async function addTonWalletKitNetworks(instance, config) {
+	const nativeNetworks = AndroidAPIClientAdapter.isAvailable() ? AndroidAPIClientAdapter.getAvailableNetworks() : [];
+	const added = [];
+	for (const netConfig of config?.networkConfigurations ?? []) {
+		const network = Network.custom(netConfig.network.chainId);
+		if (instance.networkManager.hasNetwork(network)) continue;
+		const apiClient = nativeNetworks.some((n) => n.chainId === network.chainId) ? new AndroidAPIClientAdapter(network) : createNetworkApiClient(netConfig);
+		instance.networkManager.setClient(network, instance.networkManager.createClient(network, apiClient, instance.config ?? {}));
+		instance.jettonsManager?.clearCache(network);
+		added.push(network.chainId);
+	}
+	return { added };
+}
+/**
 * Initializes WalletKit with Android-specific configuration and wiring.
 *
 * @param config - Optional initialization configuration.
@@ -39230,21 +39475,7 @@ async function initTonWalletKit(config, deps) {
 	if (walletKit) return { ok: true };
 	await ensureWalletKitLoaded();
 	const networksConfig = {};
-	if (config?.networkConfigurations && Array.isArray(config.networkConfigurations)) for (const netConfig of config.networkConfigurations) {
-		const type = netConfig.apiClientType;
-		let apiClient;
-		if (type === "tonapi") apiClient = new ApiClientTonApi({
-			endpoint: netConfig.apiClientConfiguration?.url,
-			apiKey: netConfig.apiClientConfiguration?.key,
-			network: netConfig.network
-		});
-		else if (type === "toncenter") apiClient = new ApiClientToncenter({
-			endpoint: netConfig.apiClientConfiguration?.url,
-			apiKey: netConfig.apiClientConfiguration?.key
-		});
-		else apiClient = netConfig.apiClientConfiguration;
-		networksConfig[netConfig.network.chainId] = { apiClient };
-	}
+	if (config?.networkConfigurations && Array.isArray(config.networkConfigurations)) for (const netConfig of config.networkConfigurations) networksConfig[netConfig.network.chainId] = { apiClient: createNetworkApiClient(netConfig) };
 	if (AndroidAPIClientAdapter.isAvailable()) {
 		const availableNetworks = AndroidAPIClientAdapter.getAvailableNetworks();
 		for (const nativeNetwork of availableNetworks) networksConfig[nativeNetwork.chainId] = { apiClient: new AndroidAPIClientAdapter(nativeNetwork) };
@@ -39302,7 +39533,10 @@ async function initTonWalletKit(config, deps) {
 	setWalletKit(new TonWalletKit(kitOptions));
 	if (walletKit?.ensureInitialized) await walletKit?.ensureInitialized?.();
 	deps.emit("ready", {});
-	deps.postToNative({ kind: "ready" });
+	deps.postToNative({
+		kind: "ready",
+		protocolVersion: BRIDGE_PROTOCOL_VERSION
+	});
 	info("[walletkitBridge] WalletKit ready");
 	return { ok: true };
 }
@@ -39360,12 +39594,13 @@ function emit(type, data) {
 		}
 	});
 }
-function respond(id, result, error) {
+function respond(id, result, error, bin) {
 	postToNative({
 		kind: "response",
 		id,
 		result,
-		error
+		error,
+		bin
 	});
 }
 function setBridgeApi(api) {
@@ -39376,21 +39611,89 @@ async function invokeApiMethod(api, method, params, context) {
 	if (typeof fn !== "function") throw new Error(`Unknown method ${String(method)}`);
 	return await fn.call(api, params, context);
 }
-async function handleCall(id, method, params) {
+var inFlightCalls = /* @__PURE__ */ new Map();
+/** Settles with `promise`, or rejects as soon as `signal` aborts. */
+function abortable(promise, signal) {
+	return new Promise((resolve, reject) => {
+		const onAbort = () => reject(signal.reason ?? /* @__PURE__ */ new Error("Call cancelled"));
+		if (signal.aborted) return onAbort();
+		signal.addEventListener("abort", onAbort, { once: true });
+		promise.then(resolve, reject).finally(() => signal.removeEventListener("abort", onAbort));
+	});
+}
+async function handleCall(id, method, params, bin) {
 	if (!apiRef) throw new Error("Bridge API not registered");
+	const controller = new AbortController();
+	inFlightCalls.set(id, controller);
 	try {
-		respond(id, await invokeApiMethod(apiRef, method, params, {
+		const binary = bin > 0;
+		if (binary) params = resolveBinaryRefs(params, await abortable(takeAttachments(id), controller.signal));
+		const result = await abortable(invokeApiMethod(apiRef, method, params, {
 			id,
-			method
-		}));
+			method,
+			binary,
+			signal: controller.signal
+		}), controller.signal);
+		if (binary && result instanceof Uint8Array && sendBinaryToNative(encodeAttachments(id, [result]))) {
+			respond(id, { __bin: 0 }, void 0, 1);
+			return;
+		}
+		respond(id, result);
 	} catch (err) {
+		if (controller.signal.aborted) return;
 		const message = err instanceof Error ? err.message : String(err);
 		error(`[walletkitBridge] handleCall error for ${method}:`, message);
 		respond(id, void 0, { message });
+	} finally {
+		inFlightCalls.delete(id);
 	}
 }
-function handleNativeCall(id, method, params) {
-	handleCall(id, method, params);
+/**
+* Native gave up on a call (deadline or caller cancelled). Stop awaiting it and drop its result;
+* handlers that accept `context.signal` also abort their own work.
+*/
+function handleNativeCancel(id) {
+	if (backgroundQueue.delete(id)) return;
+	const controller = inFlightCalls.get(id);
+	if (!controller) return;
+	inFlightCalls.delete(id);
+	controller.abort();
+}
+/**
+* Calls tagged `priority: "background"` wait while any interactive call is running and run at
+* most BACKGROUND_CONCURRENCY at a time, so a prefetch or streaming burst can't crowd an
+* approval out of the event loop. Untagged (foreground) calls start immediately, as before.
+*/
+var BACKGROUND_CONCURRENCY = 2;
+var backgroundQueue = /* @__PURE__ */ new Map();
+var backgroundRunning = 0;
+var interactiveRunning = 0;
+function pumpBackground() {
+	while (interactiveRunning === 0 && backgroundRunning < BACKGROUND_CONCURRENCY && backgroundQueue.size > 0) {
+		const [id, start] = backgroundQueue.entries().next().value;
+		backgroundQueue.delete(id);
+		backgroundRunning++;
+		start().finally(() => {
+			backgroundRunning--;
+			pumpBackground();
+		});
+	}
+}
+function handleNativeCall(id, method, params, bin, priority) {
+	if (priority === "background") {
+		backgroundQueue.set(id, () => handleCall(id, method, params, bin));
+		pumpBackground();
+		return;
+	}
+	if (priority !== "interactive") {
+		handleCall(id, method, params, bin);
+		return;
+	}
+	interactiveRunning++;
+	handleCall(id, method, params, bin).finally(() => {
+		interactiveRunning--;
+		pumpBackground();
+	});
 }
 //#endregion
 //#region src/api/eventListeners.ts
@@ -39406,17 +39709,88 @@ var eventListeners = {
 //#region src/adapters/AndroidStorageAdapter.ts
 /**
 * Android native storage adapter
-* Uses Android's JavascriptInterface methods for persistent storage
+* Storage calls go to native as reverse-RPC requests over the message port, so a slow
+* decrypt or commit on the native side no longer blocks the JS event loop. Native runs them in
+* arrival order. Hosts that don't know the storage methods get the synchronous
+* JavascriptInterface calls instead.
+*
+* Gets, sets and removes issued within one task are queued, and consecutive operations of one
+* kind (the core loading or persisting several keys together) reach native as a single
+* storageGetMany/storageSetMany/storageRemoveMany request, one transaction for storages that
+* support it.
 */
 var AndroidStorageAdapter = class {
 	constructor() {
 		const androidWindow = window;
 		if (!androidWindow.WalletKitNative) throw new Error("WalletKitNative bridge not available");
 		this.androidBridge = androidWindow.WalletKitNative;
+		this.asyncStorage = true;
+		this.queue = [];
+	}
+	/** Sends a storage request, falling back to the synchronous bridge method if native lacks it. */
+	async call(method, params, legacy) {
+		if (this.asyncStorage) try {
+			return await bridgeRequest(method, params);
+		} catch (err) {
+			if (!String(err?.message).startsWith("Unknown reverse-RPC method")) throw err;
+			warn("[AndroidStorageAdapter] Native has no async storage, using synchronous calls");
+			this.asyncStorage = false;
+		}
+		return legacy();
+	}
+	enqueue(kind, key, value) {
+		return new Promise((resolve, reject) => {
+			this.queue.push({
+				kind,
+				key,
+				value,
+				resolve,
+				reject
+			});
+			if (this.queue.length === 1) queueMicrotask(() => this.flushQueue());
+		});
+	}
+	/** Sends queued operations in order, one request per run of same-kind operations. */
+	flushQueue() {
+		const queue = this.queue;
+		this.queue = [];
+		let start = 0;
+		while (start < queue.length) {
+			let end = start + 1;
+			while (end < queue.length && queue[end].kind === queue[start].kind) end++;
+			this.sendRun(queue.slice(start, end));
+			start = end;
+		}
+	}
+	/** Posts synchronously (call() reaches bridgeRequest before its first await), keeping order. */
+	sendRun(run) {
+		const kind = run[0].kind;
+		const bridge = this.androidBridge;
+		let request;
+		if (run.length === 1) {
+			const { key, value } = run[0];
+			if (kind === "get") request = this.call("storageGet", { key }, () => bridge.storageGet(key));
+			else if (kind === "set") request = this.call("storageSet", {
+				key,
+				value
+			}, () => bridge.storageSet(key, value));
+			else request = this.call("storageRemove", { key }, () => bridge.storageRemove(key));
+		} else {
+			const keys = run.map((op) => op.key);
+			if (kind === "get") request = this.call("storageGetMany", { keys }, () => Object.fromEntries(keys.map((key) => [key, bridge.storageGet(key)])));
+			else if (kind === "set") request = this.call("storageSetMany", { values: Object.fromEntries(run.map((op) => [op.key, op.value])) }, () => run.forEach((op) => bridge.storageSet(op.key, op.value)));
+			else request = this.call("storageRemoveMany", { keys }, () => keys.forEach((key) => bridge.storageRemove(key)));
+		}
+		request.then((result) => {
+			for (const op of run) if (kind === "get") op.resolve((run.length === 1 ? result : result?.[op.key]) ?? null);
+			else op.resolve();
+		}, (err) => {
+			for (const op of run) op.reject(err);
+		});
 	}
 	async get(key) {
 		try {
-			const value = this.androidBridge.storageGet(key);
+			const value = await this.enqueue("get", key);
 			if (!value) return null;
 			return JSON.parse(value);
 		} catch (err) {
@@ -39426,22 +39800,22 @@ var AndroidStorageAdapter = class {
 	}
 	async set(key, value) {
 		try {
-			const serialized = JSON.stringify(value);
-			this.androidBridge.storageSet(key, serialized);
+			await this.enqueue("set", key, JSON.stringify(value));
 		} catch (err) {
 			error("[AndroidStorageAdapter] Failed to set key:", key, err);
 		}
 	}
 	async remove(key) {
 		try {
-			this.androidBridge.storageRemove(key);
+			await this.enqueue("remove", key);
 		} catch (err) {
 			error("[AndroidStorageAdapter] Failed to remove key:", key, err);
 		}
 	}
 	async clear() {
 		try {
-			this.androidBridge.storageClear();
+			this.flushQueue();
+			await this.call("storageClear", {}, () => this.androidBridge.storageClear());
 		} catch (err) {
 			error("[AndroidStorageAdapter] Failed to clear storage:", err);
 		}
@@ -39461,6 +39835,12 @@ async function init(config) {
 	});
 }
 /**
+* Adds network configurations to the running WalletKit (shared multi-network engine).
+*/
+async function addNetworks(config) {
+	return addTonWalletKitNetworks(await getKit(), config);
+}
+/**
 * Registers bridge event listeners, proxying WalletKit events to the native layer.
 */
 async function setEventsListeners(args) {
@@ -39547,9 +39927,10 @@ async function mnemonicToKeyPair(args) {
 	if (!MnemonicToKeyPair) throw new Error("MnemonicToKeyPair module not loaded");
 	return MnemonicToKeyPair(args.mnemonic, args.mnemonicType ?? "ton");
 }
-async function sign(args) {
+async function sign(args, context) {
 	if (!DefaultSignature) throw new Error("DefaultSignature module not loaded");
-	return DefaultSignature(Uint8Array.from(args.data), Uint8Array.from(args.secretKey));
+	const signature = DefaultSignature(Uint8Array.from(args.data), Uint8Array.from(args.secretKey));
+	return context?.binary ? HexToUint8Array(signature) : signature;
 }
 async function createTonMnemonic() {
 	if (!CreateTonMnemonic) throw new Error("CreateTonMnemonic module not loaded");
@@ -39653,12 +40034,24 @@ var ProxyWalletAdapter = class {
 	}
 };
 /**
+* The wallet fields Kotlin reads. Built-in adapters also report their contract parameters so
+* Kotlin can derive the address natively; proxy adapters have none and it asks getWalletAddress.
+*/
+function describeWallet(w) {
+	return {
+		publicKey: w.publicKey,
+		version: w.version,
+		workchain: w.config?.workchain,
+		subwalletId: w.config?.walletId
+	};
+}
+/**
 * Lists all wallets.
 */
 async function getWallets() {
 	return (await kit("getWallets")).map((w) => ({
 		walletId: w.getWalletId?.(),
-		wallet: w
+		wallet: describeWallet(w)
 	}));
 }
 async function getWalletById(args) {
@@ -39666,7 +40059,7 @@ async function getWalletById(args) {
 	if (!w) return null;
 	return {
 		walletId: w.getWalletId?.(),
-		wallet: w
+		wallet: describeWallet(w)
 	};
 }
 async function getWalletAddress(args) {
@@ -39756,7 +40149,7 @@ async function addWallet(args) {
 		if (!w) return null;
 		return {
 			walletId: w.getWalletId?.(),
-			wallet: w
+			wallet: describeWallet(w)
 		};
 	}
 	const proxyAdapter = new ProxyWalletAdapter(args.adapterId, (network) => instance.getApiClient(network));
@@ -39764,7 +40157,42 @@ async function addWallet(args) {
 	if (!w) return null;
 	return {
 		walletId: w.getWalletId?.(),
-		wallet: w
+		wallet: describeWallet(w)
+	};
+}
+/**
+* Adds a batch of wallets in one call. Each entry carries either a `secretKey` seed derived
+* natively or a `mnemonic` to derive here; entries fail independently and report their address
+* so Kotlin needs no getWalletAddress round trip.
+*/
+async function addWallets(args) {
+	const instance = await getKit();
+	const results = [];
+	for (const entry of args.wallets ?? []) try {
+		results.push(await importWallet(instance, entry));
+	} catch (err) {
+		results.push({ error: err instanceof Error ? err.message : String(err) });
+	}
+	return results;
+}
+async function importWallet(instance, entry) {
+	if (!Signer) throw new Error("Signer module not loaded");
+	const signer = entry.secretKey ? await Signer.fromPrivateKey(entry.secretKey) : await Signer.fromMnemonic(entry.mnemonic, { type: entry.mnemonicType ?? "ton" });
+	const Adapter = entry.version === "v4r2" ? WalletV4R2Adapter : WalletV5R1Adapter;
+	if (!Adapter) throw new Error(`Wallet adapter module not loaded for ${entry.version}`);
+	const adapter = await Adapter.create(signer, {
+		client: instance.getApiClient(entry.network),
+		network: entry.network,
+		workchain: entry.workchain ?? 0,
+		walletId: entry.walletId,
+		domain: entry.domain
+	});
+	const w = await instance.addWallet(adapter);
+	if (!w) throw new Error("Failed to add wallet");
+	return {
+		walletId: w.getWalletId?.(),
+		wallet: describeWallet(w),
+		address: adapter.getAddress()
 	};
 }
 /**
@@ -40436,33 +40864,29 @@ var ProxyStakingProvider = class {
 		this.type = "staking";
 	}
 	async getQuote(params) {
-		const resultJson = await bridgeRequest("kotlinStakingProviderGetQuote", {
+		return bridgeRequest("kotlinStakingProviderGetQuote", {
 			providerId: this.providerId,
 			params: JSON.stringify(params)
 		});
-		return JSON.parse(resultJson);
 	}
 	async buildStakeTransaction(params) {
-		const resultJson = await bridgeRequest("kotlinStakingProviderBuildStakeTransaction", {
+		return bridgeRequest("kotlinStakingProviderBuildStakeTransaction", {
 			providerId: this.providerId,
 			params: JSON.stringify(params)
 		});
-		return JSON.parse(resultJson);
 	}
 	async getStakedBalance(userAddress, network) {
-		const resultJson = await bridgeRequest("kotlinStakingProviderGetStakedBalance", {
+		return bridgeRequest("kotlinStakingProviderGetStakedBalance", {
 			providerId: this.providerId,
 			userAddress,
 			networkChainId: network?.chainId ?? null
 		});
-		return JSON.parse(resultJson);
 	}
 	async getStakingProviderInfo(network) {
-		const resultJson = await bridgeRequest("kotlinStakingProviderGetStakingProviderInfo", {
+		return bridgeRequest("kotlinStakingProviderGetStakingProviderInfo", {
 			providerId: this.providerId,
 			networkChainId: network?.chainId ?? null
 		});
-		return JSON.parse(resultJson);
 	}
 	getStakingProviderMetadata(_network) {
 		return this.metadata;
@@ -40721,7 +41145,7 @@ async function registerKotlinStreamingProvider(args) {
 async function kotlinProviderDispatch(args) {
 	const callback = kotlinSubCallbacks.get(args.subscriptionId);
 	if (callback) try {
-		callback(JSON.parse(args.updateJson));
+		callback(args.update);
 	} catch {}
 }
 //#endregion
@@ -44968,18 +45392,16 @@ var ProxySwapProvider = class {
 		return this.supportedNetworks;
 	}
 	async getQuote(params) {
-		const resultJson = await bridgeRequest("kotlinSwapProviderQuote", {
+		return bridgeRequest("kotlinSwapProviderQuote", {
 			providerId: this.providerId,
 			params: JSON.stringify(params)
 		});
-		return JSON.parse(resultJson);
 	}
 	async buildSwapTransaction(params) {
-		const resultJson = await bridgeRequest("kotlinSwapProviderBuildSwapTransaction", {
+		return bridgeRequest("kotlinSwapProviderBuildSwapTransaction", {
 			providerId: this.providerId,
 			params: JSON.stringify(params)
 		});
-		return JSON.parse(resultJson);
 	}
 };
 async function getSwap() {
@@ -45033,6 +45455,7 @@ async function registerKotlinSwapProvider(args) {
 //#region src/api/index.ts
 var api = {
 	init,
+	addNetworks,
 	setEventsListeners,
 	removeEventListeners,
 	mnemonicToKeyPair,
@@ -45044,6 +45467,7 @@ var api = {
 	createV5R1WalletAdapter,
 	createV4R2WalletAdapter,
 	addWallet,
+	addWallets,
 	releaseRef,
 	getWallets,
 	getWallet: getWalletById,
@@ -45118,6 +45542,7 @@ var api = {
 //#region src/bridge.ts
 setBridgeApi(api);
 installPortHandshake();
+setBinaryCallback(acceptAttachments);
 setInboundCallback((json) => {
 	let envelope;
 	try {
@@ -45128,15 +45553,19 @@ setInboundCallback((json) => {
 	}
 	switch (envelope.kind) {
 		case "call":
-			handleNativeCall(envelope.id, envelope.method, envelope.params);
+			handleNativeCall(envelope.id, envelope.method, envelope.params, envelope.bin, envelope.priority);
 			break;
 		case "response":
 			handleNativeResponse(envelope.id, envelope.result, envelope.error);
 			break;
+		case "cancel":
+			handleNativeCancel(envelope.id);
+			break;
 		default: warn("[walletkitBridge] Unknown inbound envelope kind", envelope);
 	}
 });
 window.walletkitBridge = api;
+window.__WALLETKIT_BUNDLE_EVALUATED_MS__ = performance.now();
 //#endregion
 
 //# sourceMappingURL=walletkit-android-bridge.mjs.map
\ No newline at end of file
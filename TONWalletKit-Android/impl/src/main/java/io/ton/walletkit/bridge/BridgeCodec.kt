@@ -43,6 +43,28 @@ internal class BridgeCodec(private val json: Json) {
         else -> encodeSerializable(value)
     }
 
+    /**
+     * Encodes [value] straight to JSON text, or returns null when there is nothing to send.
+     * `@Serializable` values are streamed by the serializer without an intermediate tree.
+     */
+    fun encodeToString(value: Any?): String? = when (value) {
+        null, is JsonNull -> null
+        is JsonElement -> value.toString()
+        is String, is Boolean, is Number, is List<*>, is Map<*, *> -> encode(value).toString()
+        else -> encodeSerializableToString(value)
+    }
+
+    private fun encodeSerializableToString(value: Any): String {
+        val klass = value::class
+        return try {
+            @Suppress("UNCHECKED_CAST")
+            val ks = json.serializersModule.serializer(klass.java) as KSerializer<Any>
+            json.encodeToString(ks, value)
+        } catch (e: Throwable) {
+            throw BridgeConversionError.UnableToEncode(klass, e)
+        }
+    }
+
     private fun encodeSerializable(value: Any): JsonElement {
         val klass = value::class
         return try {
@@ -89,6 +89,52 @@ internal fun decodeDomainType(klass: KClass<*>, raw: JsonElement): Any? {
 inline fun <reified T : Any> Json.decodeFromBridgeOrNull(raw: JsonElement?): T? =
     if (raw == null || raw is JsonNull) null else decodeFromBridge<T>(raw)
 
+/**
+ * Decodes a call result, going straight from the raw result text into [T]'s serializer when
+ * one is available. Domain and primitive types keep the element path and its conversions.
+ */
+internal inline fun <reified T : Any> Json.decodeFromBridge(payload: BridgePayload): T {
+    val klass = T::class
+    val text = payload.text
+    if (text == null || decodesViaElement(klass)) {
+        return decodeFromBridge(payload.element)
+    }
+    if (payload.isNull) {
+        throw BridgeConversionError.UnableToConvertNull(klass)
+    }
+    return try {
+        @Suppress("UNCHECKED_CAST")
+        val ks = serializersModule.serializer<T>() as KSerializer<T>
+        decodeFromString(ks, text)
+    } catch (e: BridgeConversionError) {
+        throw e
+    } catch (e: Throwable) {
+        throw BridgeConversionError.UnableToDecode(klass, e)
+    }
+}
+
+internal inline fun <reified T : Any> Json.decodeFromBridgeOrNull(payload: BridgePayload): T? =
+    if (payload.isNull) null else decodeFromBridge<T>(payload)
+
+@PublishedApi
+internal fun decodesViaElement(klass: KClass<*>): Boolean = klass in ELEMENT_DECODED_TYPES
+
+private val ELEMENT_DECODED_TYPES: Set<KClass<*>> = setOf(
+    TONHex::class,
+    TONBase64::class,
+    TONTokenAmount::class,
+    TONUserFriendlyAddress::class,
+    TONRawAddress::class,
+    String::class,
+    Boolean::class,
+    Int::class,
+    Long::class,
+    Short::class,
+    Byte::class,
+    Float::class,
+    Double::class,
+)
+
 @PublishedApi
 internal fun decodePrimitive(klass: KClass<*>, raw: JsonElement): Any? {
     val primitive = raw as? JsonPrimitive ?: return null
@@ -0,0 +1,176 @@
+/*
+ * Copyright (c) 2025 TonTech
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+package io.ton.walletkit.bridge
+
+import kotlinx.serialization.json.Json
+import kotlinx.serialization.json.JsonElement
+import kotlinx.serialization.json.JsonObject
+import kotlinx.serialization.json.JsonPrimitive
+import kotlinx.serialization.json.contentOrNull
+
+/**
+ * An inbound bridge envelope read header-first.
+ *
+ * [parse] makes one pass over the text to find where each top-level value starts and ends,
+ * without building a tree. `kind`, `id` and `method` are read straight from the text; every
+ * other value stays a raw slice until someone asks for it via [rawValue] or [element].
+ */
+internal class BridgeEnvelope private constructor(
+    val text: String,
+    private val starts: Map<String, Int>,
+    private val ends: Map<String, Int>,
+) {
+    val kind: String? get() = stringValue(KEY_KIND)
+
+    val method: String? get() = stringValue(KEY_METHOD)
+
+    /** Id content, whether it was sent as a number or a string. */
+    val id: String? get() = stringValue(KEY_ID) ?: rawValue(KEY_ID)?.takeUnless { it == NULL_LITERAL }
+
+    /** Numeric call id, or null when the id is missing or not an integer. */
+    val intId: Int? get() = id?.toIntOrNull()
+
+    fun has(key: String): Boolean = starts.containsKey(key)
+
+    /** Raw JSON text of the top-level value under [key]. */
+    fun rawValue(key: String): String? {
+        val start = starts[key] ?: return null
+        return text.substring(start, ends.getValue(key))
+    }
+
+    fun element(key: String, json: Json): JsonElement? = rawValue(key)?.let(json::parseToJsonElement)
+
+    fun toJsonObject(json: Json): JsonObject = json.parseToJsonElement(text) as JsonObject
+
+    private fun stringValue(key: String): String? {
+        val start = starts[key] ?: return null
+        if (text[start] != '"') return null
+        val end = ends.getValue(key)
+        val content = text.substring(start + 1, end - 1)
+        if (content.indexOf('\\') < 0) return content
+        return (Json.parseToJsonElement(text.substring(start, end)) as JsonPrimitive).contentOrNull
+    }
+
+    companion object {
+        private const val KEY_KIND = "kind"
+        private const val KEY_ID = "id"
+        private const val KEY_METHOD = "method"
+        private const val NULL_LITERAL = "null"
+
+        /** @throws IllegalArgumentException when [text] is not a JSON object. */
+        fun parse(text: String): BridgeEnvelope = Scanner(text).readEnvelope()
+    }
+
+    private class Scanner(private val text: String) {
+        private var pos = 0
+
+        fun readEnvelope(): BridgeEnvelope {
+            val starts = HashMap<String, Int>(8)
+            val ends = HashMap<String, Int>(8)
+            skipWhitespace()
+            expect('{')
+            skipWhitespace()
+            if (peek() == '}') {
+                pos++
+            } else {
+                while (true) {
+                    skipWhitespace()
+                    val keyStart = pos
+                    skipString()
+                    val key = text.substring(keyStart + 1, pos - 1)
+                    skipWhitespace()
+                    expect(':')
+                    skipWhitespace()
+                    val valueStart = pos
+                    skipValue()
+                    starts[key] = valueStart
+                    ends[key] = pos
+                    skipWhitespace()
+                    when (next()) {
+                        ',' -> continue
+                        '}' -> break
+                        else -> fail("expected ',' or '}'")
+                    }
+                }
+            }
+            skipWhitespace()
+            if (pos != text.length) fail("trailing characters")
+            return BridgeEnvelope(text, starts, ends)
+        }
+
+        private fun skipValue() {
+            when (peek()) {
+                '"' -> skipString()
+                '{', '[' -> skipContainer()
+                else -> {
+                    val start = pos
+                    while (pos < text.length && text[pos] !in VALUE_TERMINATORS) pos++
+                    if (pos == start) fail("expected a value")
+                }
+            }
+        }
+
+        private fun skipString() {
+            expect('"')
+            while (true) {
+                when (next()) {
+                    '\\' -> next()
+                    '"' -> return
+                }
+            }
+        }
+
+        private fun skipContainer() {
+            var depth = 0
+            do {
+                when (peek()) {
+                    '"' -> {
+                        skipString()
+                        continue
+                    }
+                    '{', '[' -> depth++
+                    '}', ']' -> depth--
+                }
+                pos++
+            } while (depth > 0)
+        }
+
+        private fun skipWhitespace() {
+            while (pos < text.length && text[pos].isWhitespace()) pos++
+        }
+
+        private fun peek(): Char = if (pos < text.length) text[pos] else fail("unexpected end of input")
+
+        private fun next(): Char = peek().also { pos++ }
+
+        private fun expect(ch: Char) {
+            if (next() != ch) fail("expected '$ch'")
+        }
+
+        private fun fail(reason: String): Nothing =
+            throw IllegalArgumentException("Malformed bridge envelope at $pos: $reason")
+
+        private companion object {
+            private const val VALUE_TERMINATORS = ",}] \t\r\n"
+        }
+    }
+}
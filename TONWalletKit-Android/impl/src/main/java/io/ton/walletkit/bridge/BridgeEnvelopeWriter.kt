@@ -0,0 +1,92 @@
+/*
+ * Copyright (c) 2025 TonTech
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+package io.ton.walletkit.bridge
+
+import io.ton.walletkit.bridge.transport.BridgeBinaryCodec
+import io.ton.walletkit.bridge.transport.BridgePriority
+import io.ton.walletkit.internal.constants.ResponseConstants
+
+/**
+ * Writes outbound `call` envelopes as JSON text without building a JsonObject first.
+ *
+ * Each thread reuses one buffer, so the only per-call allocations are the encoded params and
+ * the final string handed to the transport.
+ */
+internal class BridgeEnvelopeWriter(private val codec: BridgeCodec) {
+    private val buffer = ThreadLocal.withInitial { StringBuilder(INITIAL_CAPACITY) }
+
+    fun call(
+        id: Int,
+        method: String,
+        params: Any?,
+        attachmentCount: Int = 0,
+        priority: BridgePriority = BridgePriority.FOREGROUND,
+    ): String {
+        val encodedParams = codec.encodeToString(params)
+        val out = buffer.get()
+        out.setLength(0)
+        out.append("{\"").append(ResponseConstants.KEY_KIND).append("\":\"").append(ResponseConstants.VALUE_KIND_CALL)
+        out.append("\",\"").append(ResponseConstants.KEY_ID).append("\":").append(id)
+        out.append(",\"").append(ResponseConstants.KEY_METHOD).append("\":")
+        appendQuoted(out, method)
+        if (encodedParams != null) {
+            out.append(",\"").append(ResponseConstants.KEY_PARAMS).append("\":").append(encodedParams)
+        }
+        if (attachmentCount > 0) {
+            out.append(",\"").append(BridgeBinaryCodec.KEY_BIN).append("\":").append(attachmentCount)
+        }
+        val priorityName = priority.wireName
+        if (priorityName != null) {
+            out.append(",\"").append(ResponseConstants.KEY_PRIORITY).append("\":")
+            appendQuoted(out, priorityName)
+        }
+        out.append('}')
+        val envelope = out.toString()
+        // Don't let one oversized envelope pin a large buffer to the thread.
+        if (out.capacity() > MAX_RETAINED_CAPACITY) buffer.set(StringBuilder(INITIAL_CAPACITY))
+        return envelope
+    }
+
+    fun cancel(id: Int): String =
+        "{\"" + ResponseConstants.KEY_KIND + "\":\"" + ResponseConstants.VALUE_KIND_CANCEL + "\",\"" +
+            ResponseConstants.KEY_ID + "\":" + id + "}"
+
+    private fun appendQuoted(out: StringBuilder, value: String) {
+        out.append('"')
+        for (ch in value) {
+            when {
+                ch == '"' -> out.append("\\\"")
+                ch == '\\' -> out.append("\\\\")
+                ch < ' ' -> out.append("\\u").append(HEX_DIGITS[0]).append(HEX_DIGITS[0])
+                    .append(HEX_DIGITS[ch.code shr 4]).append(HEX_DIGITS[ch.code and 0xF])
+                else -> out.append(ch)
+            }
+        }
+        out.append('"')
+    }
+
+    private companion object {
+        private const val INITIAL_CAPACITY = 512
+        private const val MAX_RETAINED_CAPACITY = 64 * 1024
+        private const val HEX_DIGITS = "0123456789abcdef"
+    }
+}
@@ -0,0 +1,54 @@
+/*
+ * Copyright (c) 2025 TonTech
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+package io.ton.walletkit.bridge
+
+import kotlinx.serialization.json.Json
+import kotlinx.serialization.json.JsonElement
+import kotlinx.serialization.json.JsonNull
+
+/**
+ * A bridge call result that may still be raw JSON text.
+ *
+ * Results read from a [BridgeEnvelope] keep their text so [decodeFromBridge] can deserialize
+ * straight into the target type; [element] builds the tree only for callers that need one.
+ */
+internal class BridgePayload private constructor(
+    /** Raw JSON text of the result, or null when the payload was built from a tree. */
+    val text: String?,
+    parse: () -> JsonElement,
+) {
+    val element: JsonElement by lazy(parse)
+
+    val isNull: Boolean
+        get() = if (text != null) text == NULL_LITERAL else element is JsonNull
+
+    companion object {
+        private const val NULL_LITERAL = "null"
+
+        val NULL = BridgePayload(null) { JsonNull }
+
+        fun of(element: JsonElement): BridgePayload = BridgePayload(null) { element }
+
+        fun ofText(json: Json, text: String?): BridgePayload =
+            if (text == null) NULL else BridgePayload(text) { json.parseToJsonElement(text) }
+    }
+}
@@ -26,15 +26,19 @@ import kotlinx.serialization.json.JsonElement
 import kotlinx.serialization.serializer
 
 internal class BridgeRequestRegistry(private val json: Json) {
-    private val handlers = HashMap<String, suspend (JsonElement) -> String>()
+    private val handlers = HashMap<String, suspend (JsonElement) -> JsonElement>()
 
-    fun register(method: String, handler: suspend (JsonElement) -> String) {
+    /**
+     * Handlers return the structured result; it is embedded as-is in the response envelope, so
+     * JS receives it without a second parse.
+     */
+    fun register(method: String, handler: suspend (JsonElement) -> JsonElement) {
         require(handlers.put(method, handler) == null) {
             "Duplicate reverse-RPC handler registration for method: $method"
         }
     }
 
-    inline fun <reified T> registerTyped(method: String, crossinline handler: suspend (T) -> String) {
+    inline fun <reified T> registerTyped(method: String, crossinline handler: suspend (T) -> JsonElement) {
         // Hoist serializer to inline call-site: the lambda below isn't inlined, so reified T isn't usable inside it.
         val serializer = json.serializersModule.serializer<T>()
         register(method) { raw -> handler(json.decodeFromJsonElement(serializer, raw)) }
@@ -42,7 +46,7 @@ internal class BridgeRequestRegistry(private val json: Json) {
 
     /**
      * Typed-in, typed-out variant. The handler returns a strongly-typed [Res] which is encoded
-     * to JSON for the wire — callers don't have to think about serialization.
+     * to a [JsonElement] for the wire — callers don't have to think about serialization.
      */
     inline fun <reified Req, reified Res> registerTypedJson(
         method: String,
@@ -52,11 +56,11 @@ internal class BridgeRequestRegistry(private val json: Json) {
         val resSerializer = json.serializersModule.serializer<Res>()
         register(method) { raw ->
             val req = json.decodeFromJsonElement(reqSerializer, raw)
-            json.encodeToString(resSerializer, handler(req))
+            json.encodeToJsonElement(resSerializer, handler(req))
         }
     }
 
-    suspend fun dispatch(method: String, params: JsonElement): String {
+    suspend fun dispatch(method: String, params: JsonElement): JsonElement {
         val handler = handlers[method]
             ?: throw IllegalArgumentException("Unknown reverse-RPC method: $method")
         return handler(params)
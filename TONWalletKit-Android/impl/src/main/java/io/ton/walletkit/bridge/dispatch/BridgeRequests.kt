@@ -21,7 +21,9 @@
  */
 package io.ton.walletkit.bridge.dispatch
 
+import io.ton.walletkit.api.generated.TONDAppInfo
 import io.ton.walletkit.engine.operations.responses.BridgeByteArraySerializer
+import io.ton.walletkit.session.SessionFilter
 import kotlinx.serialization.Serializable
 import kotlinx.serialization.json.JsonArray
 
@@ -94,3 +96,38 @@ internal data class KotlinProviderWatchRequest(
 
 @Serializable
 internal data class KotlinProviderUnwatchRequest(val subscriptionId: String)
+
+@Serializable
+internal data class StorageKeyRequest(val key: String)
+
+@Serializable
+internal data class StorageSetRequest(val key: String, val value: String)
+
+@Serializable
+internal data class StorageKeysRequest(val keys: List<String>)
+
+@Serializable
+internal data class StorageSetManyRequest(val values: Map<String, String>)
+
+@Serializable
+internal data class SessionCreateRequest(
+    val sessionId: String,
+    val dAppInfo: TONDAppInfo = TONDAppInfo(),
+    val walletId: String = "",
+    val walletAddress: String = "",
+    val isJsBridge: Boolean = false,
+)
+
+@Serializable
+internal data class SessionIdRequest(val sessionId: String)
+
+/** A session filter as the bundle sends it; no criteria means every session. */
+@Serializable
+internal data class SessionFilterRequest(
+    val walletId: String? = null,
+    val domain: String? = null,
+    val isJsBridge: Boolean? = null,
+) {
+    fun toFilter(): SessionFilter? =
+        if (walletId == null && domain == null && isJsBridge == null) null else SessionFilter(walletId, domain, isJsBridge)
+}
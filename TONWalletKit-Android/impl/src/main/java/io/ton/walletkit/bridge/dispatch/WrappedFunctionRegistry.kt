@@ -23,6 +23,7 @@ package io.ton.walletkit.bridge.dispatch
 
 import kotlinx.serialization.json.Json
 import kotlinx.serialization.json.JsonArray
+import kotlinx.serialization.json.JsonElement
 import kotlinx.serialization.serializer
 import java.util.UUID
 import java.util.concurrent.ConcurrentHashMap
@@ -39,7 +40,7 @@ import java.util.concurrent.ConcurrentHashMap
 internal class WrappedFunctionRegistry(
     @PublishedApi internal val json: Json,
 ) {
-    private val functions = ConcurrentHashMap<String, suspend (JsonArray) -> String>()
+    private val functions = ConcurrentHashMap<String, suspend (JsonArray) -> JsonElement>()
 
     /**
      * Typed single-argument registration. The JSON in/out marshalling lives here (decode the
@@ -50,15 +51,15 @@ internal class WrappedFunctionRegistry(
         val argSerializer = json.serializersModule.serializer<A>()
         val resSerializer = json.serializersModule.serializer<R>()
         return register { args ->
-            json.encodeToString(resSerializer, fn(json.decodeFromJsonElement(argSerializer, args[0])))
+            json.encodeToJsonElement(resSerializer, fn(json.decodeFromJsonElement(argSerializer, args[0])))
         }
     }
 
     /**
-     * Raw registration escape hatch: [fn] receives the positional args array and must return an
-     * already-JSON-encoded result. Prefer [registerTyped] for the common single-arg case.
+     * Raw registration escape hatch: [fn] receives the positional args array and returns the
+     * result as a [JsonElement]. Prefer [registerTyped] for the common single-arg case.
      */
-    fun register(fn: suspend (JsonArray) -> String): String {
+    fun register(fn: suspend (JsonArray) -> JsonElement): String {
         var id = UUID.randomUUID().toString()
         // Guard against an id collision: putIfAbsent is atomic and returns non-null only if the
         // key was already taken, so regenerate until we claim a free reference.
@@ -68,8 +69,8 @@ internal class WrappedFunctionRegistry(
         return id
     }
 
-    /** Invokes the callback bound to [refId]. The returned String is already JSON-encoded. */
-    suspend fun invoke(refId: String, args: JsonArray): String {
+    /** Invokes the callback bound to [refId] and returns its structured result. */
+    suspend fun invoke(refId: String, args: JsonArray): JsonElement {
         val fn = functions[refId]
             ?: throw IllegalArgumentException("No wrapped function registered for reference: $refId")
         return fn(args)
@@ -0,0 +1,84 @@
+/*
+ * Copyright (c) 2025 TonTech
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+package io.ton.walletkit.bridge.transport
+
+import kotlinx.serialization.SerialName
+import kotlinx.serialization.Serializable
+import java.nio.ByteBuffer
+
+/**
+ * Layout of the ArrayBuffer messages that carry byte payloads next to a JSON envelope.
+ *
+ * One binary message holds every attachment of one envelope:
+ * `magic:u8 | idLength:u8 | id:utf8 | count:u8 | length:u32be * count | payloads`.
+ * The envelope itself still travels as JSON with a `bin` count and references each
+ * attachment as `{"__bin": index}` ([BinaryRef]), so ids and method names never leave JSON.
+ *
+ * Must stay in sync with `encodeAttachments` / `decodeAttachments` in the bundled
+ * `walletkit-android-bridge.mjs`.
+ */
+internal object BridgeBinaryCodec {
+    const val MAGIC: Byte = 0xB1.toByte()
+    const val KEY_BIN = "bin"
+    const val KEY_BIN_REF = "__bin"
+    const val MAX_ATTACHMENTS = 255
+
+    fun encode(id: String, attachments: List<ByteArray>): ByteArray {
+        val idBytes = id.encodeToByteArray()
+        require(idBytes.size <= 255) { "Envelope id too long for a binary header: ${idBytes.size} bytes" }
+        require(attachments.size in 1..MAX_ATTACHMENTS) { "Unsupported attachment count: ${attachments.size}" }
+
+        val headerSize = 3 + idBytes.size + 4 * attachments.size
+        val buffer = ByteBuffer.allocate(headerSize + attachments.sumOf { it.size })
+        buffer.put(MAGIC)
+        buffer.put(idBytes.size.toByte())
+        buffer.put(idBytes)
+        buffer.put(attachments.size.toByte())
+        attachments.forEach { buffer.putInt(it.size) }
+        attachments.forEach { buffer.put(it) }
+        return buffer.array()
+    }
+
+    fun decode(message: ByteArray): Attachments {
+        val buffer = ByteBuffer.wrap(message)
+        require(buffer.remaining() >= 3 && buffer.get() == MAGIC) { "Not a bridge binary message" }
+        val idLength = buffer.get().toInt() and 0xFF
+        require(buffer.remaining() >= idLength + 1) { "Truncated binary header" }
+        val idBytes = ByteArray(idLength).also { buffer.get(it) }
+        val count = buffer.get().toInt() and 0xFF
+        require(buffer.remaining() >= 4 * count) { "Truncated binary header" }
+        val lengths = IntArray(count) { buffer.int }
+        val payloads = lengths.map { length ->
+            require(length >= 0 && buffer.remaining() >= length) { "Truncated binary payload" }
+            ByteArray(length).also { buffer.get(it) }
+        }
+        return Attachments(idBytes.decodeToString(), payloads)
+    }
+
+    class Attachments(val id: String, val payloads: List<ByteArray>)
+}
+
+/** Placeholder for the attachment at [index] inside a binary-lane envelope. */
+@Serializable
+internal data class BinaryRef(
+    @SerialName(BridgeBinaryCodec.KEY_BIN_REF) val index: Int,
+)
@@ -0,0 +1,104 @@
+/*
+ * Copyright (c) 2025 TonTech
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+package io.ton.walletkit.bridge.transport
+
+/**
+ * Framing for batched bridge messages.
+ *
+ * A frame is a single port message carrying several JSON envelopes:
+ * [FRAME_MARKER] followed by `<length>:<envelope>` records, where `length` is the envelope's
+ * UTF-16 length. Envelopes are JSON objects and always start with `{`, so the marker is enough
+ * to tell a frame from a plain envelope. Lengths match JS `String.length`, which lets both sides
+ * slice records out without re-escaping the payload.
+ *
+ * Must stay in sync with `encodeFrame` / `decodeFrame` in the bundled `walletkit-android-bridge.mjs`.
+ */
+internal object BridgeFrameCodec {
+    const val FRAME_MARKER = '\u001E'
+
+    fun isFrame(message: String): Boolean = message.isNotEmpty() && message[0] == FRAME_MARKER
+
+    fun encode(envelopes: List<String>): String {
+        val builder = StringBuilder(1 + envelopes.sumOf { it.length + RECORD_OVERHEAD })
+        builder.append(FRAME_MARKER)
+        for (envelope in envelopes) {
+            builder.append(envelope.length).append(LENGTH_SEPARATOR).append(envelope)
+        }
+        return builder.toString()
+    }
+
+    /** Invokes [onEnvelope] for every record in [frame] and returns the record count. */
+    fun decode(frame: String, onEnvelope: (String) -> Unit): Int {
+        require(isFrame(frame)) { "Not a bridge frame" }
+        var offset = 1
+        var count = 0
+        while (offset < frame.length) {
+            val separator = frame.indexOf(LENGTH_SEPARATOR, offset)
+            require(separator > offset) { "Malformed bridge frame: missing record length at $offset" }
+            val length = frame.substring(offset, separator).toIntOrNull()
+            val start = separator + 1
+            require(length != null && length >= 0 && start + length <= frame.length) {
+                "Malformed bridge frame: bad record length at $offset"
+            }
+            onEnvelope(frame.substring(start, start + length))
+            offset = start + length
+            count++
+        }
+        return count
+    }
+
+    /**
+     * Groups [envelopes] into port messages no larger than [maxBatchBytes] (UTF-16 code units).
+     * Groups of one are sent unframed, so a lone or oversized envelope costs nothing extra.
+     */
+    fun pack(envelopes: List<String>, maxBatchBytes: Int): List<String> {
+        val messages = ArrayList<String>()
+        val group = ArrayList<String>()
+        var groupBytes = 1
+
+        fun emit() {
+            when (group.size) {
+                0 -> return
+                1 -> messages.add(group[0])
+                else -> messages.add(encode(group))
+            }
+            group.clear()
+            groupBytes = 1
+        }
+
+        for (envelope in envelopes) {
+            val recordBytes = envelope.length + RECORD_OVERHEAD
+            if (group.isNotEmpty() && groupBytes + recordBytes > maxBatchBytes) {
+                emit()
+            }
+            group.add(envelope)
+            groupBytes += recordBytes
+        }
+        emit()
+        return messages
+    }
+
+    private const val LENGTH_SEPARATOR = ':'
+
+    /** Length prefix plus separator; generous enough for multi-megabyte envelopes. */
+    private const val RECORD_OVERHEAD = 8
+}
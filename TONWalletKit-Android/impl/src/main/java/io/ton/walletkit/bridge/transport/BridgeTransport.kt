@@ -23,9 +23,22 @@ package io.ton.walletkit.bridge.transport
 
 internal interface BridgeTransport {
     fun send(json: String)
+
+    /** Sends [json] in the [priority] lane; transports without lanes keep plain FIFO order. */
+    fun send(json: String, priority: BridgePriority) = send(json)
     fun setOnMessage(callback: (json: String) -> Unit)
     suspend fun awaitReady()
     val isReady: Boolean
     fun fail(cause: Throwable)
     fun close()
+
+    /** Whether [sendBinary] can carry raw bytes; see [BridgeBinaryCodec]. */
+    val supportsBinary: Boolean
+        get() = false
+
+    fun sendBinary(message: ByteArray) {
+        throw UnsupportedOperationException("Binary messages are not supported by this transport")
+    }
+
+    fun setOnBinaryMessage(callback: (message: ByteArray) -> Unit) = Unit
 }
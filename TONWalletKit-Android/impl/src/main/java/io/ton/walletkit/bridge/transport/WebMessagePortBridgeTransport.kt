@@ -29,53 +29,127 @@ import androidx.webkit.WebMessagePortCompat
 import androidx.webkit.WebViewCompat
 import androidx.webkit.WebViewFeature
 import io.ton.walletkit.WalletKitBridgeException
+import io.ton.walletkit.config.TONWalletKitConfiguration.BatchDirection
+import io.ton.walletkit.config.TONWalletKitConfiguration.BatchFlushStats
+import io.ton.walletkit.config.TONWalletKitConfiguration.BatchingOptions
 import io.ton.walletkit.internal.constants.LogConstants
 import io.ton.walletkit.internal.util.Logger
 import kotlinx.coroutines.CompletableDeferred
 import java.util.concurrent.ConcurrentLinkedQueue
+import java.util.concurrent.atomic.AtomicBoolean
+import java.util.concurrent.atomic.AtomicInteger
+import java.util.concurrent.atomic.AtomicLong
 import java.util.concurrent.atomic.AtomicReference
 
+/**
+ * [BridgeTransport] over a WebMessage channel.
+ *
+ * Outbound envelopes wait in one lane per [BridgePriority] and are flushed on the main looper,
+ * higher lanes first. An [BridgePriority.INTERACTIVE] send flushes at the front of the looper
+ * queue instead of behind whatever else is pending there.
+ *
+ * With [batching] set, each flush packs everything queued into [BridgeFrameCodec] frames of at
+ * most [BatchingOptions.maxBatchBytes]. Without it, a flush posts up to [MAX_POSTS_PER_FLUSH]
+ * messages and reschedules itself, so a burst of background traffic can't hold the looper.
+ * Inbound frames from JS are always unpacked, so the JS side may batch independently.
+ */
 internal class WebMessagePortBridgeTransport(
     private val webView: WebView,
     private val mainHandler: Handler,
     private val callbackHandler: Handler,
+    private val batching: BatchingOptions? = null,
 ) : BridgeTransport {
     private val portRef = AtomicReference<WebMessagePortCompat?>(null)
     private val callbackRef = AtomicReference<((String) -> Unit)?>(null)
-    private val pendingOutbound = ConcurrentLinkedQueue<String>()
+    private val binaryCallbackRef = AtomicReference<((ByteArray) -> Unit)?>(null)
     private val readyGate = CompletableDeferred<Unit>()
 
+    /** Indexed by [BridgePriority.ordinal]; doubles as the pre-handshake queue. */
+    private val lanes = Array(BridgePriority.entries.size) { ConcurrentLinkedQueue<String>() }
+    private val queued = AtomicInteger()
+    private val flushScheduled = AtomicBoolean(false)
+    private val flushRunnable = Runnable { flushOutbound() }
+    private val outboundStats = BatchCounters(BatchDirection.OUTBOUND)
+    private val inboundStats = BatchCounters(BatchDirection.INBOUND)
+
     override val isReady: Boolean
         get() = portRef.get() != null
 
+    /** Messages waiting in the lanes, including those queued before the handshake. */
+    val outboundQueueDepth: Int
+        get() = queued.get()
+
     override suspend fun awaitReady() = readyGate.await()
 
     override fun setOnMessage(callback: (json: String) -> Unit) {
         callbackRef.set(callback)
     }
 
-    override fun send(json: String) {
-        val port = portRef.get()
-        if (port != null) {
-            post(port, json)
-            return
+    override val supportsBinary: Boolean by lazy {
+        WebViewFeature.isFeatureSupported(WebViewFeature.WEB_MESSAGE_ARRAY_BUFFER)
+    }
+
+    override fun setOnBinaryMessage(callback: (message: ByteArray) -> Unit) {
+        binaryCallbackRef.set(callback)
+    }
+
+    /**
+     * Binary messages bypass batching and the pre-handshake queue: callers only use the binary
+     * lane once the port is up, and JS waits for attachments that arrive after their envelope.
+     */
+    override fun sendBinary(message: ByteArray) {
+        val port = portRef.get() ?: throw WalletKitBridgeException("Bridge port is not open")
+        mainHandler.post { port.postMessage(WebMessageCompat(message)) }
+    }
+
+    override fun send(json: String) = send(json, BridgePriority.FOREGROUND)
+
+    override fun send(json: String, priority: BridgePriority) {
+        lanes[priority.ordinal].add(json)
+        queued.incrementAndGet()
+        // Before the handshake the lanes just hold messages; handOffPortToJs schedules the first
+        // flush. If the port is set right after this check, that flush picks the message up.
+        if (portRef.get() == null) return
+        try {
+            if (priority == BridgePriority.INTERACTIVE) {
+                mainHandler.postAtFrontOfQueue(flushRunnable)
+            } else {
+                scheduleFlush()
+            }
+        } catch (e: Throwable) {
+            throw WalletKitBridgeException("Failed to post bridge message: ${e.message}")
         }
-        pendingOutbound.add(json)
-        // If portRef was set between our get and our add, handOffPortToJs's drain
-        // may have already finished and our message would be stranded. Re-check
-        // and drain ourselves so we don't lose it.
-        portRef.get()?.let { drainPending(it) }
     }
 
     override fun fail(cause: Throwable) {
         if (!readyGate.isCompleted) readyGate.completeExceptionally(cause)
         portRef.getAndSet(null)?.close()
-        pendingOutbound.clear()
+        clearLanes()
     }
 
     override fun close() {
         portRef.getAndSet(null)?.close()
-        pendingOutbound.clear()
+        clearLanes()
+    }
+
+    /**
+     * Drops the port when the page reloads; [handOffPortToJs] opens a fresh channel once the new
+     * page has loaded. Returns the envelopes still queued for the old context, which never saw
+     * them, so their calls can be re-sent or failed instead of waiting forever.
+     */
+    fun detachPort(): List<String> {
+        val port = portRef.getAndSet(null) ?: return emptyList()
+        port.close()
+        val undelivered = ArrayList<String>()
+        while (true) {
+            undelivered.add(pollNext() ?: break)
+        }
+        return undelivered
+    }
+
+    private fun clearLanes() {
+        lanes.forEach { it.clear() }
+        queued.set(0)
     }
 
     /** Must be called on the main thread (WebView APIs are main-thread-only). */
@@ -101,12 +175,21 @@ internal class WebMessagePortBridgeTransport(
             callbackHandler,
             object : WebMessagePortCompat.WebMessageCallbackCompat() {
                 override fun onMessage(port: WebMessagePortCompat, message: WebMessageCompat?) {
+                    if (message?.type == WebMessageCompat.TYPE_ARRAY_BUFFER) {
+                        binaryCallbackRef.get()?.invoke(message.arrayBuffer)
+                            ?: Logger.w(TAG, "Binary bridge message arrived before callback was installed")
+                        return
+                    }
                     val data = message?.data ?: return
                     val cb = callbackRef.get() ?: run {
                         Logger.w(TAG, "Bridge port message arrived before callback was installed")
                         return
                     }
-                    cb(data)
+                    if (BridgeFrameCodec.isFrame(data)) {
+                        deliverFrame(data, cb)
+                    } else {
+                        cb(data)
+                    }
                 }
             },
         )
@@ -118,27 +201,95 @@ internal class WebMessagePortBridgeTransport(
         )
 
         portRef.set(kotlinPort)
-        drainPending(kotlinPort)
+        scheduleFlush()
         readyGate.complete(Unit)
     }
 
-    private fun drainPending(port: WebMessagePortCompat) {
+    private fun scheduleFlush() {
+        if (flushScheduled.compareAndSet(false, true)) {
+            mainHandler.post(flushRunnable)
+        }
+    }
+
+    /** Runs on the main thread. Drains the lanes in priority order. */
+    private fun flushOutbound() {
+        // Clear the flag before draining so sends racing with this flush schedule the next one.
+        flushScheduled.set(false)
+        val port = portRef.get() ?: return
+        val options = batching
+        if (options == null) {
+            var posted = 0
+            while (posted < MAX_POSTS_PER_FLUSH) {
+                port.postMessage(WebMessageCompat(pollNext() ?: return))
+                posted++
+            }
+            if (lanes.any { it.isNotEmpty() }) scheduleFlush()
+            return
+        }
+
+        val envelopes = ArrayList<String>()
         while (true) {
-            val next = pendingOutbound.poll() ?: return
-            post(port, next)
+            envelopes.add(pollNext() ?: break)
+        }
+        if (envelopes.isEmpty()) return
+
+        val messages = BridgeFrameCodec.pack(envelopes, options.maxBatchBytes)
+        var bytes = 0
+        for (message in messages) {
+            bytes += message.length
+            port.postMessage(WebMessageCompat(message))
         }
+        report(options, outboundStats.record(envelopes.size, messages.size, bytes))
     }
 
-    private fun post(port: WebMessagePortCompat, json: String) {
+    private fun pollNext(): String? {
+        for (lane in lanes) {
+            val next = lane.poll() ?: continue
+            queued.decrementAndGet()
+            return next
+        }
+        return null
+    }
+
+    private fun deliverFrame(frame: String, callback: (String) -> Unit) {
+        val count = try {
+            BridgeFrameCodec.decode(frame, callback)
+        } catch (e: IllegalArgumentException) {
+            Logger.e(TAG, "Dropping malformed bridge frame", e)
+            return
+        }
+        val options = batching ?: return
+        val stats = inboundStats.record(count, 1, frame.length)
+        mainHandler.post { report(options, stats) }
+    }
+
+    private fun report(options: BatchingOptions, stats: BatchFlushStats) {
+        Logger.d(TAG, "Bridge ${stats.direction} flush: ${stats.envelopes} envelopes in ${stats.messages} messages, ${stats.bytes} chars")
+        val listener = options.onFlush ?: return
         try {
-            mainHandler.post { port.postMessage(WebMessageCompat(json)) }
-        } catch (e: Throwable) {
-            throw WalletKitBridgeException("Failed to post bridge message: ${e.message}")
+            listener(stats)
+        } catch (e: Exception) {
+            Logger.e(TAG, "Batch flush listener threw", e)
         }
     }
 
+    private class BatchCounters(private val direction: BatchDirection) {
+        private val flushes = AtomicLong()
+        private val envelopes = AtomicLong()
+
+        fun record(envelopeCount: Int, messageCount: Int, bytes: Int) = BatchFlushStats(
+            direction = direction,
+            envelopes = envelopeCount,
+            messages = messageCount,
+            bytes = bytes,
+            totalFlushes = flushes.incrementAndGet(),
+            totalEnvelopes = envelopes.addAndGet(envelopeCount.toLong()),
+        )
+    }
+
     private companion object {
         private const val TAG = LogConstants.TAG_WEBVIEW_ENGINE
         const val BRIDGE_HANDSHAKE_TAG = "__walletkit_bridge_init"
+        const val MAX_POSTS_PER_FLUSH = 32
     }
 }
@@ -0,0 +1,53 @@
+/*
+ * Copyright (c) 2025 TonTech
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+package io.ton.walletkit.core
+
+import io.ton.walletkit.api.generated.TONNetwork
+import io.ton.walletkit.event.TONWalletKitEvent
+import io.ton.walletkit.listener.TONBridgeEventsHandler
+
+/**
+ * Passes on only the events of a kit's own networks, for kits sharing one engine.
+ *
+ * An event concerning a wallet of another network is dropped. Events not tied to a wallet, and
+ * those of wallets [networkOf] does not know, reach every kit.
+ */
+internal class NetworkScopedEventsHandler(
+    private val delegate: TONBridgeEventsHandler,
+    private val networks: Set<TONNetwork>,
+    private val networkOf: (walletId: String) -> TONNetwork?,
+) : TONBridgeEventsHandler {
+
+    override fun handle(event: TONWalletKitEvent) {
+        val network = walletIdOf(event)?.let(networkOf)
+        if (network == null || network in networks) delegate.handle(event)
+    }
+
+    private fun walletIdOf(event: TONWalletKitEvent): String? = when (event) {
+        is TONWalletKitEvent.ConnectRequest -> event.request.event.walletId
+        is TONWalletKitEvent.SendTransactionRequest -> event.request.event.walletId
+        is TONWalletKitEvent.SignDataRequest -> event.request.event.walletId
+        is TONWalletKitEvent.SignMessageRequest -> event.request.event.walletId
+        is TONWalletKitEvent.Disconnect -> event.event.walletId
+        is TONWalletKitEvent.RequestError -> null
+    }
+}
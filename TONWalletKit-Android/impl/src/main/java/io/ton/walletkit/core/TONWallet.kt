@@ -27,6 +27,8 @@ import io.ton.walletkit.api.generated.*
 import io.ton.walletkit.client.TONAPIClient
 import io.ton.walletkit.engine.WalletKitEngine
 import io.ton.walletkit.engine.model.WalletAccount
+import io.ton.walletkit.internal.contract.WalletContracts
+import io.ton.walletkit.internal.util.WalletKitUtils
 import io.ton.walletkit.model.KeyPair
 import io.ton.walletkit.model.TONBalance
 import io.ton.walletkit.model.TONUserFriendlyAddress
@@ -242,15 +244,16 @@ internal class TONWallet internal constructor(
     /**
      * Get the state init BOC for this wallet.
      *
-     * The implementation currently returns null until state init retrieval is added to the engine.
+     * Built natively for v4r2 and v5r1 wallets whose contract parameters are known; wallets backed
+     * by a custom adapter return null.
      *
      * @return State init as base64-encoded BOC, or null if not available
-     * @throws io.ton.walletkit.WalletKitBridgeException if state init retrieval fails
      */
     suspend fun stateInit(): String? {
-        // TODO: Implement state init retrieval when available in engine
-        // Reference implementation: wallet.getSateInit()?.toString()
-        return null
+        val version = account.version?.takeIf(WalletContracts::supports) ?: return null
+        val publicKey = account.publicKey?.let(WalletKitUtils::hexToByteArray) ?: return null
+        val walletId = account.subwalletId ?: return null
+        return WalletContracts.stateInitBoc(version, publicKey, walletId).value
     }
 
     /**
@@ -42,15 +42,21 @@ import io.ton.walletkit.core.streaming.TONStreamingManager
 import io.ton.walletkit.core.streaming.TONStreamingProviderImpl
 import io.ton.walletkit.engine.WalletKitEngine
 import io.ton.walletkit.engine.WebViewWalletKitEngine
+import io.ton.walletkit.engine.model.WalletAccount
+import io.ton.walletkit.engine.model.WalletImportResult
 import io.ton.walletkit.internal.constants.BridgeMethodConstants
 import io.ton.walletkit.internal.util.WalletKitUtils
 import io.ton.walletkit.listener.TONBridgeEventsHandler
 import io.ton.walletkit.model.KeyPair
+import io.ton.walletkit.model.TONBridgeMetrics
 import io.ton.walletkit.model.TONWalletAdapter
+import io.ton.walletkit.model.TONWalletImportProgress
+import io.ton.walletkit.model.TONWalletImportRequest
 import io.ton.walletkit.model.WalletSigner
 import io.ton.walletkit.model.WalletSignerInfo
 import io.ton.walletkit.request.TONWalletConnectionRequest
 import io.ton.walletkit.session.TONConnectSession
+import io.ton.walletkit.session.TONConnectSessionChange
 import io.ton.walletkit.staking.BuiltInStakingProvider
 import io.ton.walletkit.staking.ITONStakingManager
 import io.ton.walletkit.staking.TONStakingManager
@@ -65,7 +71,12 @@ import io.ton.walletkit.swap.dedust.TONDeDustSwapProvider
 import io.ton.walletkit.swap.dedust.TONDeDustSwapProviderIdentifier
 import io.ton.walletkit.swap.omniston.TONOmnistonSwapProvider
 import io.ton.walletkit.swap.omniston.TONOmnistonSwapProviderIdentifier
+import kotlinx.coroutines.CoroutineDispatcher
+import kotlinx.coroutines.delay
+import kotlinx.coroutines.flow.Flow
+import kotlinx.coroutines.flow.flow
 import kotlinx.serialization.json.Json
+import java.util.concurrent.ConcurrentHashMap
 
 /**
  * Main entry point for TON Wallet Kit SDK.
@@ -122,6 +133,8 @@ import kotlinx.serialization.json.Json
 internal class TONWalletKit private constructor(
     @JvmSynthetic
     internal val engine: WalletKitEngine,
+    // This kit's networks when it shares its engine with kits of other networks; null otherwise.
+    private val networks: Set<TONNetwork>?,
 ) : ITONWalletKit {
 
     private val swapManager: ITONSwapManager = TONSwapManager(engine)
@@ -138,14 +151,29 @@ internal class TONWalletKit private constructor(
         ): ITONWalletKit {
             // Network-based caching prevents multiple WebView instances per network —
             // multiple WebViews with the same JS bridge interface name conflict, and
-            // mainnet / testnet need their own engine. [init] is idempotent.
+            // mainnet / testnet need their own engine unless EngineOptions.shareAcrossNetworks
+            // is set, in which case [init] adds this kit's networks to the shared engine.
+            // [init] is otherwise idempotent.
             val newEngine = WebViewWalletKitEngine.getOrCreate(
                 context = context,
                 configuration = configuration,
                 eventsHandler = null,
             ).apply { init(configuration) }
 
-            return TONWalletKit(newEngine)
+            val networks = configuration.networkConfigurations.mapTo(mutableSetOf()) { it.network }
+            return TONWalletKit(newEngine, networks.takeIf { configuration.engineOptions.shareAcrossNetworks })
+        }
+
+        /**
+         * Start creating the engine's WebView ahead of [initialize].
+         *
+         * See [io.ton.walletkit.ITONWalletKit.prewarm].
+         */
+        fun prewarm(
+            context: Context,
+            engineOptions: TONWalletKitConfiguration.EngineOptions,
+        ) {
+            WebViewWalletKitEngine.prewarm(context, engineOptions)
         }
     }
 
@@ -155,6 +183,9 @@ internal class TONWalletKit private constructor(
     @Volatile
     private var isDestroyed = false
 
+    // Handlers added through this kit, mapped to the handler the engine holds for each.
+    private val eventsHandlers = ConcurrentHashMap<TONBridgeEventsHandler, TONBridgeEventsHandler>()
+
     @Suppress("PropertyName")
     private val _stakingManager: ITONStakingManager by lazy { TONStakingManager(engine) }
 
@@ -171,7 +202,21 @@ internal class TONWalletKit private constructor(
      */
     override suspend fun addEventsHandler(eventsHandler: TONBridgeEventsHandler) {
         checkNotDestroyed()
-        engine.addEventsHandler(eventsHandler)
+        engine.addEventsHandler(registeredHandler(eventsHandler))
+    }
+
+    /**
+     * Add an event handler whose events are delivered on [dispatcher].
+     *
+     * Use this for handlers that do I/O or heavy work, so they stay off the main thread.
+     *
+     * @param eventsHandler Handler for SDK events
+     * @param dispatcher Dispatcher the handler runs on
+     * @throws IllegalStateException if SDK instance has been destroyed
+     */
+    override suspend fun addEventsHandler(eventsHandler: TONBridgeEventsHandler, dispatcher: CoroutineDispatcher) {
+        checkNotDestroyed()
+        engine.addEventsHandler(registeredHandler(eventsHandler), dispatcher)
     }
 
     /**
@@ -181,9 +226,19 @@ internal class TONWalletKit private constructor(
      */
     override suspend fun removeEventsHandler(eventsHandler: TONBridgeEventsHandler) {
         if (isDestroyed) return
-        engine.removeEventsHandler(eventsHandler)
+        engine.removeEventsHandler(eventsHandlers.remove(eventsHandler) ?: eventsHandler)
     }
 
+    /** The handler to give the engine for [eventsHandler]: scoped to [networks] on a shared engine. */
+    private fun registeredHandler(eventsHandler: TONBridgeEventsHandler): TONBridgeEventsHandler =
+        eventsHandlers.getOrPut(eventsHandler) {
+            networks?.let { NetworkScopedEventsHandler(eventsHandler, it, engine::walletNetwork) } ?: eventsHandler
+        }
+
+    /** Whether [account] belongs to this kit; on a shared engine, wallets of other networks do not. */
+    private fun isOwn(account: WalletAccount): Boolean =
+        networks == null || account.network == null || account.network in networks
+
     override suspend fun createStreamingProvider(
         config: TONTonCenterStreamingProviderConfig,
     ): ITONStreamingProvider {
@@ -200,6 +255,18 @@ internal class TONWalletKit private constructor(
         return TONStreamingProviderImpl(engine = engine, network = config.network, id = result.optString("providerId"))
     }
 
+    override fun bridgeMetrics(): TONBridgeMetrics = engine.bridgeMetrics()
+
+    override fun bridgeMetricsUpdates(intervalMillis: Long): Flow<TONBridgeMetrics> {
+        require(intervalMillis > 0) { "intervalMillis must be positive" }
+        return flow {
+            while (true) {
+                emit(engine.bridgeMetrics())
+                delay(intervalMillis)
+            }
+        }
+    }
+
     override fun streaming(): ITONStreamingManager {
         checkNotDestroyed()
         return streamingManager
@@ -211,6 +278,9 @@ internal class TONWalletKit private constructor(
         isDestroyed = true
 
         try {
+            // A shared engine outlives this kit, so it must stop delivering to this kit's handlers.
+            eventsHandlers.values.forEach { engine.removeEventsHandler(it) }
+            eventsHandlers.clear()
             engine.destroy()
         } catch (e: Exception) {
             // Log but don't throw - cleanup should be best-effort
@@ -303,13 +373,42 @@ internal class TONWalletKit private constructor(
         )
     }
 
+    override fun addWallets(batch: List<TONWalletImportRequest>): Flow<TONWalletImportProgress> = flow {
+        checkNotDestroyed()
+
+        var completed = 0
+        engine.addWallets(batch).collect { result ->
+            completed++
+            val progress = when (result) {
+                is WalletImportResult.Added -> TONWalletImportProgress.Added(
+                    index = result.index,
+                    completed = completed,
+                    total = batch.size,
+                    wallet = TONWallet(
+                        id = result.account.walletId,
+                        address = result.account.address,
+                        engine = engine,
+                        account = result.account,
+                    ),
+                )
+                is WalletImportResult.Failed -> TONWalletImportProgress.Failed(
+                    index = result.index,
+                    completed = completed,
+                    total = batch.size,
+                    error = result.error,
+                )
+            }
+            emit(progress)
+        }
+    }
+
     /**
      * Get all wallets managed by this SDK instance.
      */
     override suspend fun getWallets(): List<ITONWallet> {
         checkNotDestroyed()
 
-        val accounts = engine.getWallets()
+        val accounts = engine.getWallets().filter(::isOwn)
         return accounts.map { account ->
             TONWallet(
                 id = account.walletId,
@@ -325,7 +424,7 @@ internal class TONWalletKit private constructor(
      */
     override suspend fun getWallet(walletId: String): ITONWallet? {
         checkNotDestroyed()
-        val account = engine.getWallet(walletId) ?: return null
+        val account = engine.getWallet(walletId)?.takeIf(::isOwn) ?: return null
         return TONWallet(
             id = account.walletId,
             address = account.address,
@@ -434,6 +533,8 @@ internal class TONWalletKit private constructor(
         return engine.listSessions()
     }
 
+    override fun sessionChanges(): Flow<TONConnectSessionChange> = engine.sessionChanges
+
     /**
      * Handle a TON Connect URL (deep link or QR code scan).
      *
@@ -61,18 +61,24 @@ import io.ton.walletkit.api.generated.TONTransferRequest
 import io.ton.walletkit.config.TONWalletKitConfiguration
 import io.ton.walletkit.core.streaming.StreamingEvent
 import io.ton.walletkit.engine.model.WalletAccount
+import io.ton.walletkit.engine.model.WalletImportResult
 import io.ton.walletkit.engine.state.KotlinStakingProviderManager
 import io.ton.walletkit.engine.state.KotlinStreamingProviderManager
 import io.ton.walletkit.engine.state.KotlinSwapProviderManager
 import io.ton.walletkit.listener.TONBridgeEventsHandler
 import io.ton.walletkit.model.KeyPair
+import io.ton.walletkit.model.TONBridgeMetrics
 import io.ton.walletkit.model.TONHex
 import io.ton.walletkit.model.TONWalletAdapter
+import io.ton.walletkit.model.TONWalletImportRequest
 import io.ton.walletkit.model.WalletSigner
 import io.ton.walletkit.model.WalletSignerInfo
 import io.ton.walletkit.request.RequestHandler
 import io.ton.walletkit.request.TONWalletConnectionRequest
 import io.ton.walletkit.session.TONConnectSession
+import io.ton.walletkit.session.TONConnectSessionChange
+import kotlinx.coroutines.CoroutineDispatcher
+import kotlinx.coroutines.flow.Flow
 import kotlinx.coroutines.flow.SharedFlow
 import kotlinx.serialization.json.JsonElement
 import kotlinx.serialization.json.JsonObject
@@ -139,9 +145,10 @@ internal interface WalletKitEngine : RequestHandler {
     ): ByteArray
 
     /**
-     * Generate a new mnemonic phrase using the WalletKit JS utilities.
+     * Generate a new TON mnemonic phrase.
      *
-     * @param wordCount Number of words to generate (12 or 24). Defaults to 24.
+     * @param wordCount Number of words to generate (12 or 24). Defaults to 24. Honoured only with
+     *   native crypto; the bundle always generates 24 words.
      * @return List of mnemonic words
      * @throws WalletKitBridgeException if generation fails
      */
@@ -183,12 +190,30 @@ internal interface WalletKitEngine : RequestHandler {
 
     suspend fun addWallet(adapter: TONWalletAdapter): WalletAccount
 
+    /**
+     * Derive and add a batch of wallets.
+     *
+     * TON mnemonics are turned into keys in parallel on [kotlinx.coroutines.Dispatchers.Default]
+     * when [io.ton.walletkit.config.TONWalletKitConfiguration.EngineOptions.nativeCrypto] is on;
+     * other mnemonics are derived by JS. Wallets reach JS in chunks, one bridge call each, and
+     * every result carries the wallet address so no getWalletAddress round trip follows.
+     *
+     * @param requests Wallets to add
+     * @return Cold flow emitting one result per request, in request order
+     */
+    fun addWallets(requests: List<TONWalletImportRequest>): Flow<WalletImportResult>
+
     suspend fun getWallets(): List<WalletAccount>
 
     suspend fun getWallet(walletId: String): WalletAccount?
 
     suspend fun removeWallet(walletId: String)
 
+    /**
+     * Network of a wallet added through this engine, or null when the engine did not add it.
+     */
+    fun walletNetwork(walletId: String): TONNetwork?
+
     /**
      * Get the current state of a wallet.
      *
@@ -380,6 +405,11 @@ internal interface WalletKitEngine : RequestHandler {
      */
     suspend fun listSessions(): List<TONConnectSession>
 
+    /**
+     * Session creations and removals, from the built-in session store when it is enabled.
+     */
+    val sessionChanges: Flow<TONConnectSessionChange>
+
     /**
      * Disconnect a TON Connect session.
      *
@@ -641,8 +671,9 @@ internal interface WalletKitEngine : RequestHandler {
      * event handling. Multiple handlers can be added, and each will receive all events.
      *
      * @param eventsHandler Handler for SDK events
+     * @param dispatcher Where the handler receives events; the main thread when null
      */
-    suspend fun addEventsHandler(eventsHandler: TONBridgeEventsHandler)
+    suspend fun addEventsHandler(eventsHandler: TONBridgeEventsHandler, dispatcher: CoroutineDispatcher? = null)
 
     /**
      * Remove a previously added event handler.
@@ -655,4 +686,9 @@ internal interface WalletKitEngine : RequestHandler {
      * Destroy the engine and release all resources.
      */
     suspend fun destroy()
+
+    /**
+     * Snapshot of call counters for the bridge behind this engine.
+     */
+    fun bridgeMetrics(): TONBridgeMetrics
 }
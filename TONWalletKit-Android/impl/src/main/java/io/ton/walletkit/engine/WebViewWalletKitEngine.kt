@@ -22,7 +22,15 @@
 package io.ton.walletkit.engine
 
 import android.content.Context
+import android.os.Handler
+import android.os.Looper
+import androidx.annotation.VisibleForTesting
+import androidx.lifecycle.DefaultLifecycleObserver
+import androidx.lifecycle.LifecycleOwner
+import androidx.lifecycle.ProcessLifecycleOwner
 import io.ton.walletkit.WalletKitBridgeException
+import io.ton.walletkit.WalletKitConstants
+import io.ton.walletkit.api.WalletVersions
 import io.ton.walletkit.api.generated.TONConnectionApprovalResponse
 import io.ton.walletkit.api.generated.TONConnectionRequestEvent
 import io.ton.walletkit.api.generated.TONDeDustSwapProviderConfig
@@ -60,17 +68,26 @@ import io.ton.walletkit.api.generated.TONTransactionEmulatedPreview
 import io.ton.walletkit.api.generated.TONTransactionPreviewOptions
 import io.ton.walletkit.api.generated.TONTransactionRequest
 import io.ton.walletkit.api.generated.TONTransferRequest
+import io.ton.walletkit.api.isTestnet
 import io.ton.walletkit.bridge.BridgeCodec
+import io.ton.walletkit.bridge.BridgeEnvelope
 import io.ton.walletkit.client.TONAPIClient
 import io.ton.walletkit.config.TONWalletKitConfiguration
 import io.ton.walletkit.engine.adapter.BridgeWalletAdapter
+import io.ton.walletkit.engine.infrastructure.BridgeCallMetrics
+import io.ton.walletkit.engine.infrastructure.BridgeCallPolicy
 import io.ton.walletkit.engine.infrastructure.BridgeRpcClient
+import io.ton.walletkit.engine.infrastructure.IndexedSessionManager
 import io.ton.walletkit.engine.infrastructure.InitializationManager
 import io.ton.walletkit.engine.infrastructure.MessageDispatcher
+import io.ton.walletkit.engine.infrastructure.StartupPhase
+import io.ton.walletkit.engine.infrastructure.StartupTimeline
 import io.ton.walletkit.engine.infrastructure.StorageManager
 import io.ton.walletkit.engine.infrastructure.WebViewManager
 import io.ton.walletkit.engine.model.WalletAccount
+import io.ton.walletkit.engine.model.WalletImportResult
 import io.ton.walletkit.engine.operations.addWallet
+import io.ton.walletkit.engine.operations.addWallets
 import io.ton.walletkit.engine.operations.approveConnect
 import io.ton.walletkit.engine.operations.approveSignData
 import io.ton.walletkit.engine.operations.approveSignMessage
@@ -128,8 +145,11 @@ import io.ton.walletkit.engine.operations.rejectTransaction
 import io.ton.walletkit.engine.operations.removeStakingProvider
 import io.ton.walletkit.engine.operations.removeSwapProvider
 import io.ton.walletkit.engine.operations.removeWallet
+import io.ton.walletkit.engine.operations.requests.WalletImportEntry
 import io.ton.walletkit.engine.operations.responses.AddWalletResponse
+import io.ton.walletkit.engine.operations.responses.AddWalletsEntryResponse
 import io.ton.walletkit.engine.operations.responses.SignerInfoResponse
+import io.ton.walletkit.engine.operations.responses.WalletInfoBridge
 import io.ton.walletkit.engine.operations.sendTransaction
 import io.ton.walletkit.engine.operations.setDefaultStakingProvider
 import io.ton.walletkit.engine.operations.setDefaultSwapProvider
@@ -147,24 +167,39 @@ import io.ton.walletkit.engine.state.SignerManager
 import io.ton.walletkit.internal.constants.BridgeMethodConstants
 import io.ton.walletkit.internal.constants.LogConstants
 import io.ton.walletkit.internal.constants.WebViewConstants
+import io.ton.walletkit.internal.contract.WalletContracts
+import io.ton.walletkit.internal.crypto.Ed25519
+import io.ton.walletkit.internal.crypto.TonMnemonic
 import io.ton.walletkit.internal.util.Logger
 import io.ton.walletkit.internal.util.WalletKitUtils
 import io.ton.walletkit.listener.TONBridgeEventsHandler
 import io.ton.walletkit.model.KeyPair
+import io.ton.walletkit.model.TONBridgeMetrics
 import io.ton.walletkit.model.TONHex
 import io.ton.walletkit.model.TONUserFriendlyAddress
 import io.ton.walletkit.model.TONWalletAdapter
+import io.ton.walletkit.model.TONWalletImportRequest
 import io.ton.walletkit.model.WalletSigner
 import io.ton.walletkit.model.WalletSignerInfo
 import io.ton.walletkit.request.TONWalletConnectionRequest
 import io.ton.walletkit.session.TONConnectSession
+import io.ton.walletkit.session.TONConnectSessionChange
 import io.ton.walletkit.session.TONConnectSessionManager
 import io.ton.walletkit.storage.BridgeStorageAdapter
 import io.ton.walletkit.storage.CustomBridgeStorageAdapter
+import io.ton.walletkit.storage.JournaledBridgeStorageAdapter
 import io.ton.walletkit.storage.MemoryBridgeStorageAdapter
 import io.ton.walletkit.storage.SecureBridgeStorageAdapter
 import io.ton.walletkit.storage.TONWalletKitStorageType
+import kotlinx.coroutines.CoroutineDispatcher
+import kotlinx.coroutines.CoroutineScope
 import kotlinx.coroutines.Dispatchers
+import kotlinx.coroutines.SupervisorJob
+import kotlinx.coroutines.async
+import kotlinx.coroutines.flow.Flow
+import kotlinx.coroutines.flow.channelFlow
+import kotlinx.coroutines.flow.emptyFlow
+import kotlinx.coroutines.launch
 import kotlinx.coroutines.runBlocking
 import kotlinx.coroutines.sync.Mutex
 import kotlinx.coroutines.sync.withLock
@@ -174,10 +209,14 @@ import kotlinx.serialization.json.JsonElement
 import kotlinx.serialization.json.JsonObject
 import kotlinx.serialization.json.buildJsonObject
 import kotlinx.serialization.json.put
+import java.util.concurrent.ConcurrentHashMap
+import java.util.concurrent.CopyOnWriteArrayList
+import java.util.concurrent.atomic.AtomicInteger
 
 /**
  * WebView-backed WalletKit engine. Orchestrates the WebView, JS bridge transport,
- * RPC dispatch, and event routing for a single network instance.
+ * RPC dispatch, and event routing for a single network instance, or for every network when
+ * [TONWalletKitConfiguration.EngineOptions.shareAcrossNetworks] is set.
  *
  * @suppress Internal implementation. Created by [io.ton.walletkit.core.TONWalletKit.initialize].
  */
@@ -186,27 +225,48 @@ internal class WebViewWalletKitEngine private constructor(
     eventsHandler: TONBridgeEventsHandler?,
     private val storageAdapter: BridgeStorageAdapter,
     private val sessionManager: TONConnectSessionManager?,
-    private val apiClients: List<Pair<TONNetwork, TONAPIClient>>,
+    apiClients: List<Pair<TONNetwork, TONAPIClient>>,
     private val assetPath: String = WebViewConstants.DEFAULT_ASSET_PATH,
+    private val engineOptions: TONWalletKitConfiguration.EngineOptions = TONWalletKitConfiguration.EngineOptions(),
+    prewarmedWebView: WebViewManager? = null,
 ) : WalletKitEngine {
     override val streamingEvents get() = messageDispatcher.streamingEvents
 
     private val appContext = context.applicationContext
 
-    private val json = Json {
-        ignoreUnknownKeys = true
-        isLenient = true
-    }
+    private val json = bridgeJson
 
     @Volatile private var persistentStorageEnabled: Boolean = true
 
     @Volatile private var isDestroyed: Boolean = false
 
+    // Custom API clients served to JS; a shared engine adds those of each network that joins it.
+    private val apiClients = CopyOnWriteArrayList(apiClients)
+
+    // Kits holding a shared engine; it is torn down when the last one destroys it.
+    private val holders = AtomicInteger(1)
+
+    // Network of every wallet added through this engine, so kits sharing it see only their own.
+    private val walletNetworks = ConcurrentHashMap<String, TONNetwork>()
+
     private val adapterManager = AdapterManager()
     private val signerManager = SignerManager()
     override val kotlinStreamingProviderManager: KotlinStreamingProviderManager
     private val eventRouter = EventRouter()
-    private val storageManager = StorageManager(storageAdapter) { persistentStorageEnabled }
+    private val storageManager = StorageManager(storageAdapter, engineOptions.storageWriteBehind) { persistentStorageEnabled }
+
+    // The built-in store, when enabled and the configuration brings no session manager of its own.
+    private val nativeSessions =
+        if (sessionManager == null && engineOptions.nativeSessionStore) IndexedSessionManager(storageManager, json) else null
+    private val activeSessionManager: TONConnectSessionManager? = sessionManager ?: nativeSessions
+    override val sessionChanges: Flow<TONConnectSessionChange> = nativeSessions?.changes ?: emptyFlow()
+
+    // Queued storage writes are flushed whenever the app leaves the foreground.
+    private val storageFlushObserver = object : DefaultLifecycleObserver {
+        override fun onStop(owner: LifecycleOwner) {
+            storageManager.flushInBackground()
+        }
+    }
     override val kotlinSwapProviderManager = KotlinSwapProviderManager()
     override val kotlinStakingProviderManager = KotlinStakingProviderManager()
 
@@ -218,22 +278,19 @@ internal class WebViewWalletKitEngine private constructor(
 
     init {
         webViewManager =
-            WebViewManager(
+            prewarmedWebView ?: WebViewManager(
                 context = appContext,
                 assetPath = assetPath,
-                storageManager = storageManager,
-                sessionManager = sessionManager,
-                apiClients = apiClients,
-                adapterManager = adapterManager,
                 json = json,
-                onMessage = ::handleBridgeMessage,
-                onBridgeError = ::handleBridgeError,
+                engineOptions = engineOptions,
             )
         rpcClient = BridgeRpcClient(
             webViewManager = webViewManager,
             codec = BridgeCodec(json),
             ensureInitialized = { ensureWalletKitInitialized() },
             json = json,
+            callPolicy = BridgeCallPolicy(engineOptions.callDeadlines),
+            metrics = BridgeCallMetrics(detailed = engineOptions.recordMetrics),
         )
         kotlinStreamingProviderManager = KotlinStreamingProviderManager(rpcClient, json)
         initManager = InitializationManager(appContext, rpcClient)
@@ -245,6 +302,8 @@ internal class WebViewWalletKitEngine private constructor(
                 eventRouter = eventRouter,
                 initManager = initManager,
                 webViewManager = webViewManager,
+                storageManager = storageManager,
+                sessionManager = activeSessionManager,
                 adapterManager = adapterManager,
                 signerManager = signerManager,
                 kotlinSwapProviderManager = kotlinSwapProviderManager,
@@ -259,10 +318,31 @@ internal class WebViewWalletKitEngine private constructor(
                 eventRouter.addHandler(eventsHandler)
             }
         }
+
+        // Last, so messages a prewarmed WebView received early find every component in place.
+        webViewManager.bind(
+            WebViewManager.Host(
+                storageManager = storageManager,
+                sessionManager = activeSessionManager,
+                apiClients = this.apiClients,
+                adapterManager = adapterManager,
+                onMessage = ::handleBridgeMessage,
+                onBridgeError = ::handleBridgeError,
+                onBinaryMessage = ::handleBridgeBinary,
+                onContextLost = messageDispatcher::onContextLost,
+            ),
+        )
+
+        if (engineOptions.storageWriteBehind != null) {
+            Handler(Looper.getMainLooper()).post {
+                if (!isDestroyed) ProcessLifecycleOwner.get().lifecycle.addObserver(storageFlushObserver)
+            }
+        }
     }
 
     private suspend fun ensureWalletKitInitialized(configuration: TONWalletKitConfiguration? = null) {
         initManager.ensureInitialized(configuration)
+        webViewManager.startupTimeline.mark(StartupPhase.INIT_DONE)
         refreshDerivedState()
     }
 
@@ -270,8 +350,12 @@ internal class WebViewWalletKitEngine private constructor(
         persistentStorageEnabled = initManager.isPersistentStorageEnabled()
     }
 
-    private fun handleBridgeMessage(payload: JsonObject) {
-        messageDispatcher.dispatchMessage(payload)
+    private fun handleBridgeMessage(envelope: BridgeEnvelope) {
+        messageDispatcher.dispatchMessage(envelope)
+    }
+
+    private fun handleBridgeBinary(message: ByteArray) {
+        rpcClient.handleBinary(message)
     }
 
     private fun handleBridgeError(exception: WalletKitBridgeException, malformedJson: String? = null) {
@@ -291,6 +375,11 @@ internal class WebViewWalletKitEngine private constructor(
 
     override suspend fun init(configuration: TONWalletKitConfiguration) {
         initManager.initialize(configuration)
+        if (engineOptions.shareAcrossNetworks) {
+            // No-op for the configuration that initialized the engine.
+            initManager.addNetworks(configuration)
+        }
+        webViewManager.startupTimeline.mark(StartupPhase.INIT_DONE)
         refreshDerivedState()
     }
 
@@ -298,21 +387,111 @@ internal class WebViewWalletKitEngine private constructor(
         initManager.getConfiguration()
 
     override suspend fun mnemonicToKeyPair(words: List<String>, mnemonicType: String): KeyPair =
-        rpcClient.mnemonicToKeyPair(words, mnemonicType)
+        if (engineOptions.nativeCrypto && mnemonicType == TonMnemonic.TYPE) {
+            nativeCrypto { TonMnemonic.toKeyPair(words) }
+        } else {
+            rpcClient.mnemonicToKeyPair(words, mnemonicType)
+        }
 
     override suspend fun sign(data: ByteArray, secretKey: ByteArray): ByteArray =
-        rpcClient.sign(data, secretKey)
+        if (engineOptions.nativeCrypto) {
+            nativeCrypto { Ed25519.sign(data, secretKey) }
+        } else {
+            rpcClient.sign(data, secretKey)
+        }
 
     override suspend fun createTonMnemonic(wordCount: Int): List<String> =
-        rpcClient.createTonMnemonic(wordCount)
+        if (engineOptions.nativeCrypto) {
+            nativeCrypto { TonMnemonic.generate(wordCount) }
+        } else {
+            rpcClient.createTonMnemonic(wordCount)
+        }
+
+    /** Runs CPU-bound native crypto off the caller's thread, failing the way a bridge call would. */
+    private suspend fun <T> nativeCrypto(block: () -> T): T = withContext(Dispatchers.Default) {
+        try {
+            block()
+        } catch (e: IllegalArgumentException) {
+            throw WalletKitBridgeException(e.message ?: "Invalid crypto input", e)
+        }
+    }
 
     override suspend fun addWallet(adapter: TONWalletAdapter): WalletAccount {
         // BridgeWalletAdapter wraps a JS-side adapter; route through its stable adapterId so we don't
         // re-register in AdapterManager or create a duplicate proxy in JS.
         val adapterId = if (adapter is BridgeWalletAdapter) adapter.adapterId else adapterManager.registerAdapter(adapter)
-        return rpcClient.addWallet(adapterId).toWalletAccount()
+        // A custom adapter already knows its address; JS would only ask it back through getAddress.
+        val address = if (adapter is BridgeWalletAdapter) null else adapter.address(adapter.network().isTestnet).value
+        return rpcClient.addWallet(adapterId).toWalletAccount(address, adapter.network())
     }
 
+    override fun addWallets(requests: List<TONWalletImportRequest>): Flow<WalletImportResult> = channelFlow {
+        // Every key starts deriving at once; each chunk goes to JS as soon as its own keys are
+        // ready, so bridge calls overlap with deriving the rest of the batch.
+        val prepared = requests.map { request -> async(Dispatchers.Default) { prepareImport(request) } }
+        for (chunk in prepared.withIndex().chunked(WALLET_IMPORT_CHUNK_SIZE)) {
+            val entries = chunk.map { (index, deferred) -> index to deferred.await() }
+            val ready = entries.mapNotNull { (_, entry) -> entry.getOrNull() }
+            val responses = try {
+                Result.success(if (ready.isEmpty()) emptyList() else rpcClient.addWallets(ready))
+            } catch (e: WalletKitBridgeException) {
+                Result.failure(e)
+            }
+            val chunkFailure = responses.exceptionOrNull()
+            var next = 0
+            for ((index, entry) in entries) {
+                val error = entry.exceptionOrNull() ?: chunkFailure
+                send(
+                    if (error != null) {
+                        failedImport(index, error)
+                    } else {
+                        responses.getOrThrow().getOrNull(next++).toImportResult(index, requests[index].network)
+                    },
+                )
+            }
+        }
+    }
+
+    /** Resolves defaults and derives the key natively when possible; never throws for bad input. */
+    private fun prepareImport(request: TONWalletImportRequest): Result<WalletImportEntry> = try {
+        val walletId = request.walletId ?: when (request.version) {
+            WalletVersions.V5R1 -> WalletKitConstants.DEFAULT_WALLET_ID_V5R1
+            WalletVersions.V4R2 -> WalletKitConstants.DEFAULT_WALLET_ID_V4R2
+            else -> throw WalletKitBridgeException("Unsupported wallet version: ${request.version}")
+        }
+        val derive = engineOptions.nativeCrypto && request.mnemonicType == TonMnemonic.TYPE
+        val seed = if (derive) TonMnemonic.toKeyPair(request.mnemonic).secretKey.copyOf(Ed25519.SEED_BYTES) else null
+        Result.success(
+            WalletImportEntry(
+                secretKey = seed?.let(WalletKitUtils::byteArrayToHexNoPrefix),
+                mnemonic = request.mnemonic.takeUnless { derive },
+                mnemonicType = request.mnemonicType.takeUnless { derive },
+                version = request.version,
+                network = request.network,
+                workchain = request.workchain,
+                walletId = walletId,
+                domain = request.domain,
+            ),
+        )
+    } catch (e: WalletKitBridgeException) {
+        Result.failure(e)
+    } catch (e: IllegalArgumentException) {
+        Result.failure(WalletKitBridgeException(e.message ?: "Invalid mnemonic", e))
+    }
+
+    private suspend fun AddWalletsEntryResponse?.toImportResult(index: Int, network: TONNetwork): WalletImportResult = try {
+        if (this == null) throw WalletKitBridgeException("JS returned no result for wallet $index")
+        error?.let { throw WalletKitBridgeException(it) }
+        WalletImportResult.Added(index, AddWalletResponse(walletId, wallet).toWalletAccount(address, network))
+    } catch (e: WalletKitBridgeException) {
+        WalletImportResult.Failed(index, e)
+    }
+
+    private fun failedImport(index: Int, error: Throwable) = WalletImportResult.Failed(
+        index,
+        error as? WalletKitBridgeException ?: WalletKitBridgeException(error.message ?: "Wallet import failed", error),
+    )
+
     override suspend fun createSignerFromMnemonic(
         mnemonic: List<String>,
         mnemonicType: String,
@@ -341,12 +520,18 @@ internal class WebViewWalletKitEngine private constructor(
         val response = rpcClient.createWalletAdapter(version, signerId, resolvedNetwork, workchain, walletId, domain)
         val adapterId = response.adapterId?.takeIf { it.isNotEmpty() }
             ?: throw WalletKitBridgeException("JS did not return adapterId")
+        val address = response.address?.takeIf { it.isNotEmpty() }
+            ?: WalletInfoBridge(publicKey.value, version, workchain, walletId).derivedAddress()
+            ?: ""
         return BridgeWalletAdapter(
             adapterId = adapterId,
             cachedPublicKey = publicKey,
             cachedNetwork = resolvedNetwork,
-            cachedAddress = TONUserFriendlyAddress(response.address ?: ""),
+            cachedAddress = TONUserFriendlyAddress(address),
             rpcClient = rpcClient,
+            version = version,
+            workchain = workchain,
+            walletId = walletId,
         )
     }
 
@@ -358,12 +543,17 @@ internal class WebViewWalletKitEngine private constructor(
     override suspend fun getWallet(walletId: String): WalletAccount? {
         val response = rpcClient.getWallet(walletId) ?: return null
         val resolvedId = response.walletId?.takeIf { it.isNotEmpty() } ?: walletId
-        val address = rpcClient.getWalletAddress(resolvedId)
+        val address = response.wallet?.derivedAddress() ?: rpcClient.getWalletAddress(resolvedId)
         if (address.isEmpty()) return null
         return response.copy(walletId = resolvedId).toWalletAccount(address)
     }
 
-    override suspend fun removeWallet(walletId: String) = rpcClient.removeWallet(walletId)
+    override suspend fun removeWallet(walletId: String) {
+        rpcClient.removeWallet(walletId)
+        walletNetworks.remove(walletId)
+    }
+
+    override fun walletNetwork(walletId: String): TONNetwork? = walletNetworks[walletId]
 
     override suspend fun getBalance(walletId: String): String = rpcClient.getBalance(walletId)
 
@@ -629,27 +819,46 @@ internal class WebViewWalletKitEngine private constructor(
         )
     }
 
+    /** Builds the account for a wallet JS reported; [network] is recorded when the wallet was just added. */
     private suspend fun AddWalletResponse.toWalletAccount(
         address: String? = null,
+        network: TONNetwork? = null,
     ): WalletAccount {
         val walletId = walletId?.takeIf { it.isNotEmpty() }
             ?: throw WalletKitBridgeException("Failed to retrieve newly added wallet")
-        val resolvedAddress = address ?: rpcClient.getWalletAddress(walletId)
+        network?.let { walletNetworks[walletId] = it }
+        val resolvedAddress = address ?: wallet?.derivedAddress() ?: rpcClient.getWalletAddress(walletId)
         val rawPublicKey = wallet?.publicKey
         return WalletAccount(
             walletId = walletId,
             address = TONUserFriendlyAddress(resolvedAddress),
             publicKey = rawPublicKey?.takeIf { it.isNotEmpty() }?.let(WalletKitUtils::stripHexPrefix),
             version = wallet?.version?.takeIf { it.isNotEmpty() } ?: "unknown",
+            workchain = wallet?.workchain,
+            subwalletId = wallet?.subwalletId,
+            network = walletNetworks[walletId],
         )
     }
 
+    /** Address of a built-in wallet contract computed natively, or null when JS did not report its parameters. */
+    private fun WalletInfoBridge.derivedAddress(): String? {
+        val version = version?.takeIf(WalletContracts::supports) ?: return null
+        val publicKey = publicKey?.takeIf { it.isNotEmpty() } ?: return null
+        if (workchain == null || subwalletId == null) return null
+        return try {
+            WalletContracts.address(version, WalletKitUtils.hexToByteArray(publicKey), workchain, subwalletId).value
+        } catch (e: IllegalArgumentException) {
+            Logger.w(TAG, "Falling back to JS for the address of a $version wallet: ${e.message}")
+            null
+        }
+    }
+
     override suspend fun callBridgeMethod(method: String, params: Any?): JsonObject {
         return call(method, params)
     }
 
-    override suspend fun addEventsHandler(eventsHandler: TONBridgeEventsHandler) {
-        val outcome = eventRouter.addHandler(eventsHandler, logAcquired = false)
+    override suspend fun addEventsHandler(eventsHandler: TONBridgeEventsHandler, dispatcher: CoroutineDispatcher?) {
+        val outcome = eventRouter.addHandler(eventsHandler, logAcquired = false, dispatcher = dispatcher)
 
         if (outcome.alreadyRegistered) {
             Logger.w(TAG, "Handler already registered, skipping")
@@ -676,11 +885,30 @@ internal class WebViewWalletKitEngine private constructor(
         }
     }
 
+    override fun bridgeMetrics(): TONBridgeMetrics = rpcClient.metricsSnapshot()
+
     override suspend fun destroy() {
         if (isDestroyed) {
             Logger.d(TAG, "destroy() called but already destroyed, skipping")
             return
         }
+        if (holders.decrementAndGet() > 0) {
+            Logger.d(TAG, "Shared engine released, still held by ${holders.get()} kit(s)")
+            return
+        }
+        tearDown()
+    }
+
+    /** Registers another kit holding this shared engine, along with its custom API clients. */
+    private fun retain(configuration: TONWalletKitConfiguration) {
+        holders.incrementAndGet()
+        for (entry in configuration.apiClients) {
+            if (apiClients.none { it.first == entry.first }) apiClients.add(entry)
+        }
+    }
+
+    private suspend fun tearDown() {
+        if (isDestroyed) return
         isDestroyed = true
 
         withContext(Dispatchers.Main) {
@@ -693,23 +921,98 @@ internal class WebViewWalletKitEngine private constructor(
                 Logger.w(TAG, "Failed to remove event listeners during destroy", e)
             }
 
+            ProcessLifecycleOwner.get().lifecycle.removeObserver(storageFlushObserver)
+            messageDispatcher.shutdown()
+            eventRouter.close()
             kotlinSwapProviderManager.clear()
             kotlinStakingProviderManager.clear()
             kotlinStreamingProviderManager.clear()
             webViewManager.destroy()
         }
+        storageManager.close()
     }
 
     companion object {
         private val instances = mutableMapOf<TONNetwork, WebViewWalletKitEngine>()
         private val instanceMutex = Mutex()
 
+        internal val bridgeJson = Json {
+            ignoreUnknownKeys = true
+            isLenient = true
+        }
+
+        /** A WebView loading the bridge ahead of the first engine; guarded by [instanceMutex]. */
+        private var prewarmed: WebViewManager? = null
+
+        /** Runs [prewarm] off the caller's thread, so it can wait for [instanceMutex]. */
+        private val prewarmScope = CoroutineScope(SupervisorJob() + Dispatchers.Default)
+
+        /** The engine serving every network of kits that opted into sharing; guarded by [instanceMutex]. */
+        private var shared: WebViewWalletKitEngine? = null
+
+        /** Configuration of the kit that created [shared]; guarded by [instanceMutex]. */
+        private var sharedConfiguration: TONWalletKitConfiguration? = null
+
+        /**
+         * Starts creating the WebView and loading the bridge bundle before any configuration is
+         * known. The next engine created adopts it if its batching options match; otherwise it is
+         * discarded. Calling this again while a prewarmed WebView is waiting does nothing.
+         *
+         * Returns immediately. The check and setup run asynchronously once [instanceMutex] is
+         * free, so a call made while an engine is being created is not lost.
+         */
+        fun prewarm(
+            context: Context,
+            engineOptions: TONWalletKitConfiguration.EngineOptions = TONWalletKitConfiguration.EngineOptions(),
+            assetPath: String = WebViewConstants.DEFAULT_ASSET_PATH,
+        ) {
+            val appContext = context.applicationContext
+            prewarmScope.launch {
+                instanceMutex.withLock {
+                    if (prewarmed != null || instances.values.any { !it.isDestroyed } || shared?.isDestroyed == false) {
+                        Logger.d(TAG, "Skipping prewarm: an engine or prewarmed WebView already exists")
+                        return@withLock
+                    }
+                    Logger.d(TAG, "Prewarming WebView engine")
+                    prewarmed = WebViewManager(
+                        context = appContext,
+                        assetPath = assetPath,
+                        json = bridgeJson,
+                        engineOptions = engineOptions,
+                        startupTimeline = StartupTimeline(prewarmed = true),
+                        deferCreation = true,
+                    )
+                }
+            }
+        }
+
+        /** Hands out the prewarmed WebView if it suits [assetPath] and [engineOptions]. Call under [instanceMutex]. */
+        private fun takePrewarmed(
+            assetPath: String,
+            engineOptions: TONWalletKitConfiguration.EngineOptions,
+        ): WebViewManager? {
+            val candidate = prewarmed ?: return null
+            prewarmed = null
+            // Batching is the only engine option the WebView itself depends on.
+            if (candidate.assetPath == assetPath && candidate.engineOptions.batching == engineOptions.batching) {
+                Logger.d(TAG, "Adopting prewarmed WebView")
+                return candidate
+            }
+            Logger.w(TAG, "Discarding prewarmed WebView: created with a different asset path or batching")
+            candidate.getMainHandler().post { candidate.destroy() }
+            return null
+        }
+
         suspend fun getOrCreate(
             context: Context,
             configuration: TONWalletKitConfiguration,
             eventsHandler: TONBridgeEventsHandler?,
             assetPath: String = WebViewConstants.DEFAULT_ASSET_PATH,
         ): WebViewWalletKitEngine {
+            if (configuration.engineOptions.shareAcrossNetworks) {
+                return getOrJoinShared(context, configuration, eventsHandler, assetPath)
+            }
+
             val network = configuration.network
 
             instances[network]?.let { existingInstance ->
@@ -738,15 +1041,7 @@ internal class WebViewWalletKitEngine private constructor(
                     }
 
                     Logger.d(TAG, "Creating new WebView engine for network: $network")
-                    val storageAdapter = createStorageAdapter(context, configuration.storageType)
-                    WebViewWalletKitEngine(
-                        context,
-                        eventsHandler,
-                        storageAdapter,
-                        configuration.sessionManager,
-                        configuration.apiClients,
-                        assetPath,
-                    ).also {
+                    create(context, configuration, eventsHandler, assetPath).also {
                         instances[network] = it
                     }
                 }
@@ -760,9 +1055,114 @@ internal class WebViewWalletKitEngine private constructor(
             return instance
         }
 
+        /**
+         * Returns the shared engine, creating it on first use. A kit joining a running engine
+         * counts as one more holder; its networks are added to the JS context by [init].
+         *
+         * @throws IllegalArgumentException if the joining kit's storage type, session manager or
+         *   engine options differ from those of the kit that created the engine
+         */
+        private suspend fun getOrJoinShared(
+            context: Context,
+            configuration: TONWalletKitConfiguration,
+            eventsHandler: TONBridgeEventsHandler?,
+            assetPath: String,
+        ): WebViewWalletKitEngine {
+            val instance =
+                instanceMutex.withLock {
+                    val existing = shared?.takeIf { !it.isDestroyed && it.assetPath == assetPath }
+                    if (existing != null) {
+                        sharedConfiguration?.let { requireSharable(it, configuration) }
+                        Logger.d(TAG, "Joining shared WebView engine for network: ${configuration.network}")
+                        existing.retain(configuration)
+                        return@withLock existing
+                    }
+                    Logger.d(TAG, "Creating shared WebView engine for network: ${configuration.network}")
+                    create(context, configuration, eventsHandler, assetPath).also {
+                        shared = it
+                        sharedConfiguration = configuration
+                    }
+                }
+
+            if (eventsHandler != null) {
+                if (!instance.eventRouter.containsHandler(eventsHandler)) {
+                    instance.addEventsHandler(eventsHandler)
+                }
+            }
+
+            return instance
+        }
+
+        /** A shared engine has a single storage, session manager and set of options; joining kits must match them. */
+        private fun requireSharable(
+            owner: TONWalletKitConfiguration,
+            joining: TONWalletKitConfiguration,
+        ) {
+            require(joining.storageType == owner.storageType) {
+                "Cannot share the engine for ${joining.network}: its storage type differs from the running engine's"
+            }
+            require(joining.sessionManager === owner.sessionManager) {
+                "Cannot share the engine for ${joining.network}: its session manager differs from the running engine's"
+            }
+            require(joining.engineOptions == owner.engineOptions) {
+                "Cannot share the engine for ${joining.network}: its engine options differ from the running engine's"
+            }
+        }
+
+        /** Creates an engine for [configuration]. Call under [instanceMutex]. */
+        private fun create(
+            context: Context,
+            configuration: TONWalletKitConfiguration,
+            eventsHandler: TONBridgeEventsHandler?,
+            assetPath: String,
+        ): WebViewWalletKitEngine {
+            val storageAdapter = createStorageAdapter(context, configuration.storageType)
+            return WebViewWalletKitEngine(
+                context,
+                eventsHandler,
+                storageAdapter,
+                configuration.sessionManager,
+                configuration.apiClients,
+                assetPath,
+                configuration.engineOptions,
+                takePrewarmed(assetPath, configuration.engineOptions),
+            )
+        }
+
+        /**
+         * Creates an engine that is neither cached nor given the prewarmed WebView, for
+         * instrumented tests that need a fresh engine or drive [webViewManager] themselves. The
+         * caller owns it.
+         */
+        @VisibleForTesting
+        internal fun createUncached(
+            context: Context,
+            configuration: TONWalletKitConfiguration,
+            webViewManager: WebViewManager =
+                WebViewManager(context, WebViewConstants.DEFAULT_ASSET_PATH, bridgeJson, configuration.engineOptions),
+        ): WebViewWalletKitEngine =
+            WebViewWalletKitEngine(
+                context,
+                null,
+                createStorageAdapter(context, configuration.storageType),
+                configuration.sessionManager,
+                configuration.apiClients,
+                engineOptions = configuration.engineOptions,
+                prewarmedWebView = webViewManager,
+            )
+
         @JvmStatic
         internal suspend fun clearInstances(network: TONNetwork? = null) {
             instanceMutex.withLock {
+                shared?.let { engine ->
+                    val networks = engine.initManager.getConfiguration()?.networkConfigurations?.map { it.network }
+                    if (network == null || networks == null || network in networks) {
+                        engine.tearDown()
+                        shared = null
+                        sharedConfiguration = null
+                        Logger.d(TAG, "Cleared shared WebView engine")
+                    }
+                }
                 if (network != null) {
                     instances[network]?.destroy()
                     instances.remove(network)
@@ -788,6 +1188,10 @@ internal class WebViewWalletKitEngine private constructor(
                     Logger.d(TAG, "Using encrypted storage")
                     SecureBridgeStorageAdapter(context.applicationContext)
                 }
+                is TONWalletKitStorageType.Journaled -> {
+                    Logger.d(TAG, "Using journaled storage")
+                    JournaledBridgeStorageAdapter(context.applicationContext)
+                }
                 is TONWalletKitStorageType.Custom -> {
                     Logger.d(TAG, "Using custom storage")
                     CustomBridgeStorageAdapter(storageType.storage)
@@ -796,5 +1200,8 @@ internal class WebViewWalletKitEngine private constructor(
         }
 
         private const val TAG = LogConstants.TAG_WEBVIEW_ENGINE
+
+        /** Wallets sent to JS per addWallets bridge call; bounds call duration and progress granularity. */
+        private const val WALLET_IMPORT_CHUNK_SIZE = 10
     }
 }
@@ -27,6 +27,7 @@ import io.ton.walletkit.api.generated.TONProofMessage
 import io.ton.walletkit.api.generated.TONTransactionRequest
 import io.ton.walletkit.engine.infrastructure.BridgeRpcClient
 import io.ton.walletkit.internal.constants.BridgeMethodConstants
+import io.ton.walletkit.internal.contract.WalletContracts
 import io.ton.walletkit.internal.util.Logger
 import io.ton.walletkit.model.TONBase64
 import io.ton.walletkit.model.TONHex
@@ -41,7 +42,8 @@ import kotlinx.serialization.json.put
 
 /**
  * Internal adapter wrapping a JS-side wallet adapter.
- * Holds cached metadata; signing is handled by the JS engine.
+ * Holds cached metadata; signing is handled by the JS engine. Addresses in either format and the
+ * state init are derived natively from [version], [workchain] and [walletId].
  */
 internal class BridgeWalletAdapter(
     internal val adapterId: String,
@@ -49,6 +51,9 @@ internal class BridgeWalletAdapter(
     private val cachedNetwork: TONNetwork,
     private val cachedAddress: TONUserFriendlyAddress,
     private val rpcClient: BridgeRpcClient,
+    private val version: String,
+    private val workchain: Int,
+    private val walletId: Long,
 ) : TONWalletAdapter {
 
     override fun identifier(): String = adapterId
@@ -57,10 +62,18 @@ internal class BridgeWalletAdapter(
 
     override fun network(): TONNetwork = cachedNetwork
 
-    override fun address(testnet: Boolean): TONUserFriendlyAddress = cachedAddress
+    override fun address(testnet: Boolean): TONUserFriendlyAddress {
+        val publicKey = cachedPublicKey.data
+        if (!testnet || publicKey == null || !WalletContracts.supports(version)) return cachedAddress
+        return WalletContracts.address(version, publicKey, workchain, walletId, testnet = true)
+    }
 
     override suspend fun stateInit(): TONBase64 {
-        throw UnsupportedOperationException("BridgeWalletAdapter delegates to JS engine")
+        val publicKey = cachedPublicKey.data
+        if (publicKey == null || !WalletContracts.supports(version)) {
+            throw UnsupportedOperationException("No native state init for wallet version $version")
+        }
+        return WalletContracts.stateInitBoc(version, publicKey, walletId)
     }
 
     override suspend fun signedSendTransaction(
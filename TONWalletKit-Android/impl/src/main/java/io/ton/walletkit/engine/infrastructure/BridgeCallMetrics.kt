@@ -0,0 +1,221 @@
+/*
+ * Copyright (c) 2025 TonTech
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+package io.ton.walletkit.engine.infrastructure
+
+import io.ton.walletkit.model.TONBridgeMethodMetrics
+import io.ton.walletkit.model.TONBridgeMetrics
+import io.ton.walletkit.model.TONStartupTimings
+import java.util.concurrent.ConcurrentHashMap
+import java.util.concurrent.atomic.AtomicInteger
+import java.util.concurrent.atomic.AtomicLong
+import java.util.concurrent.atomic.AtomicLongArray
+import kotlin.math.ceil
+
+/**
+ * Lock-free counters for [BridgeRpcClient] calls.
+ *
+ * Per-method statistics are only recorded when [detailed] is set; otherwise [startTimer] skips
+ * the clock read and the finish hooks only maintain the in-flight gauge.
+ */
+internal class BridgeCallMetrics(val detailed: Boolean = false) {
+    private val callsStarted = AtomicLong()
+    private val deadlinesExceeded = AtomicLong()
+    private val callsCancelled = AtomicLong()
+    private val cancelsSent = AtomicLong()
+    private val inFlight = AtomicInteger()
+    private val contextLosses = AtomicLong()
+    private val callsReplayed = AtomicLong()
+    private val callsFailedOnContextLoss = AtomicLong()
+    private val lastRecoveryMillis = AtomicLong(NO_RECOVERY)
+    private val reverseInFlight = AtomicInteger()
+    private val reverseQueued = AtomicInteger()
+    private val reverseQueuedPeak = AtomicInteger()
+    private val reverseRejected = AtomicLong()
+    private val methods = ConcurrentHashMap<String, MethodStats>()
+    private val reverseMethods = ConcurrentHashMap<String, MethodStats>()
+
+    /** Start timestamp to hand back to a finish hook, or 0 when nothing is recorded. */
+    fun startTimer(): Long = if (detailed) System.nanoTime() else 0L
+
+    fun onCallStarted() {
+        callsStarted.incrementAndGet()
+        inFlight.incrementAndGet()
+    }
+
+    /** Pairs with [onCallStarted]; [failed] covers errors, missed deadlines and cancellation. */
+    fun onCallFinished(method: String, startedAt: Long, requestSize: Int, responseSize: Int, failed: Boolean) {
+        inFlight.decrementAndGet()
+        if (!detailed) return
+        methods.computeIfAbsent(method) { MethodStats() }
+            .record(System.nanoTime() - startedAt, requestSize, responseSize, failed)
+    }
+
+    /** Records a reverse-RPC handler run of [method] that started at [startedAt]. */
+    fun onReverseCallFinished(method: String, startedAt: Long, failed: Boolean) {
+        if (!detailed) return
+        reverseMethods.computeIfAbsent(method) { MethodStats() }
+            .record(System.nanoTime() - startedAt, 0, 0, failed)
+    }
+
+    /** A reverse-RPC request was admitted and waits for a permit; see [ReverseRpcExecutor]. */
+    fun onReverseQueued() {
+        val queued = reverseQueued.incrementAndGet()
+        reverseQueuedPeak.accumulateAndGet(queued, ::maxOf)
+    }
+
+    fun onReverseStarted() {
+        reverseQueued.decrementAndGet()
+        reverseInFlight.incrementAndGet()
+    }
+
+    /** Pairs with [onReverseQueued]; [started] tells whether the request left the queue first. */
+    fun onReverseEnded(started: Boolean) {
+        if (started) reverseInFlight.decrementAndGet() else reverseQueued.decrementAndGet()
+    }
+
+    fun onReverseRejected() {
+        reverseRejected.incrementAndGet()
+    }
+
+    fun onDeadlineExceeded() {
+        deadlinesExceeded.incrementAndGet()
+    }
+
+    fun onCallCancelled() {
+        callsCancelled.incrementAndGet()
+    }
+
+    fun onCancelSent() {
+        cancelsSent.incrementAndGet()
+    }
+
+    fun onContextLost(failedCalls: Int) {
+        contextLosses.incrementAndGet()
+        callsFailedOnContextLoss.addAndGet(failedCalls.toLong())
+    }
+
+    fun onCallsReplayed(count: Int) {
+        callsReplayed.addAndGet(count.toLong())
+    }
+
+    fun onContextRecovered(elapsedMillis: Long) {
+        lastRecoveryMillis.set(elapsedMillis)
+    }
+
+    fun snapshot(outboundQueueDepth: Int = 0, startup: TONStartupTimings = TONStartupTimings()) = TONBridgeMetrics(
+        callsStarted = callsStarted.get(),
+        deadlinesExceeded = deadlinesExceeded.get(),
+        callsCancelled = callsCancelled.get(),
+        cancelsSent = cancelsSent.get(),
+        inFlight = inFlight.get(),
+        outboundQueueDepth = outboundQueueDepth,
+        contextLosses = contextLosses.get(),
+        callsReplayed = callsReplayed.get(),
+        callsFailedOnContextLoss = callsFailedOnContextLoss.get(),
+        lastRecoveryMillis = lastRecoveryMillis.get().takeIf { it != NO_RECOVERY },
+        reverseInFlight = reverseInFlight.get(),
+        reverseQueued = reverseQueued.get(),
+        reverseQueuedPeak = reverseQueuedPeak.get(),
+        reverseRejected = reverseRejected.get(),
+        startup = startup,
+        methods = methods.mapValues { it.value.snapshot() },
+        reverseMethods = reverseMethods.mapValues { it.value.snapshot() },
+    )
+
+    private companion object {
+        private const val NO_RECOVERY = -1L
+    }
+
+    private class MethodStats {
+        private val calls = AtomicLong()
+        private val failures = AtomicLong()
+        private val requestBytes = AtomicLong()
+        private val responseBytes = AtomicLong()
+        private val latency = LatencyHistogram()
+
+        fun record(elapsedNanos: Long, requestSize: Int, responseSize: Int, failed: Boolean) {
+            calls.incrementAndGet()
+            if (failed) failures.incrementAndGet()
+            requestBytes.addAndGet(requestSize.toLong())
+            responseBytes.addAndGet(responseSize.toLong())
+            latency.record(elapsedNanos)
+        }
+
+        fun snapshot() = TONBridgeMethodMetrics(
+            calls = calls.get(),
+            failures = failures.get(),
+            p50Millis = latency.percentileMillis(0.50),
+            p95Millis = latency.percentileMillis(0.95),
+            p99Millis = latency.percentileMillis(0.99),
+            requestBytes = requestBytes.get(),
+            responseBytes = responseBytes.get(),
+        )
+    }
+}
+
+/**
+ * Log-scale latency histogram over microseconds: four buckets per power of two, so a bucket's
+ * upper bound is at most 25% above any value in it. Recording is one atomic increment.
+ */
+internal class LatencyHistogram {
+    private val buckets = AtomicLongArray(BUCKET_COUNT)
+
+    fun record(elapsedNanos: Long) {
+        buckets.incrementAndGet(bucketOf(elapsedNanos / NANOS_PER_MICRO))
+    }
+
+    /** Upper bound of the bucket holding the [quantile] sample, in milliseconds; 0 when empty. */
+    fun percentileMillis(quantile: Double): Double {
+        val counts = LongArray(BUCKET_COUNT) { buckets.get(it) }
+        val total = counts.sum()
+        if (total == 0L) return 0.0
+        val rank = ceil(quantile * total).toLong().coerceAtLeast(1)
+        var seen = 0L
+        for (index in counts.indices) {
+            seen += counts[index]
+            if (seen >= rank) return upperBoundMicros(index) / MICROS_PER_MILLI
+        }
+        return upperBoundMicros(BUCKET_COUNT - 1) / MICROS_PER_MILLI
+    }
+
+    private companion object {
+        private const val SUB_BUCKET_BITS = 2
+        private const val SUB_BUCKETS = 1 shl SUB_BUCKET_BITS
+        private const val BUCKET_COUNT = 40 * SUB_BUCKETS
+        private const val NANOS_PER_MICRO = 1_000L
+        private const val MICROS_PER_MILLI = 1_000.0
+
+        fun bucketOf(micros: Long): Int {
+            if (micros < SUB_BUCKETS) return micros.coerceAtLeast(0).toInt()
+            val exponent = 63 - micros.countLeadingZeroBits()
+            val sub = (micros shr (exponent - SUB_BUCKET_BITS)).toInt() and (SUB_BUCKETS - 1)
+            return ((exponent - SUB_BUCKET_BITS + 1) * SUB_BUCKETS + sub).coerceAtMost(BUCKET_COUNT - 1)
+        }
+
+        fun upperBoundMicros(index: Int): Double {
+            if (index < SUB_BUCKETS) return (index + 1).toDouble()
+            val exponent = index / SUB_BUCKETS + SUB_BUCKET_BITS - 1
+            val sub = index % SUB_BUCKETS
+            return ((SUB_BUCKETS + sub + 1).toLong() shl (exponent - SUB_BUCKET_BITS)).toDouble()
+        }
+    }
+}
@@ -0,0 +1,161 @@
+/*
+ * Copyright (c) 2025 TonTech
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+package io.ton.walletkit.engine.infrastructure
+
+import io.ton.walletkit.bridge.transport.BridgePriority
+import io.ton.walletkit.config.TONWalletKitConfiguration
+import io.ton.walletkit.internal.constants.BridgeMethodConstants
+
+/**
+ * Coarse classes of bridge methods, used to pick per-call policies such as deadlines.
+ * Anything not listed is treated as [NETWORK], the conservative choice.
+ */
+internal enum class BridgeMethodClass {
+    LOCAL,
+    NETWORK,
+    EMULATION,
+    ;
+
+    companion object {
+        private val local = setOf(
+            BridgeMethodConstants.METHOD_ADD_NETWORKS,
+            BridgeMethodConstants.METHOD_SET_EVENTS_LISTENERS,
+            BridgeMethodConstants.METHOD_REMOVE_EVENT_LISTENERS,
+            BridgeMethodConstants.METHOD_GET_WALLETS,
+            BridgeMethodConstants.METHOD_GET_WALLET,
+            BridgeMethodConstants.METHOD_GET_WALLET_ADDRESS,
+            BridgeMethodConstants.METHOD_REMOVE_WALLET,
+            BridgeMethodConstants.METHOD_RELEASE_REF,
+            BridgeMethodConstants.METHOD_CREATE_SIGNER_FROM_MNEMONIC,
+            BridgeMethodConstants.METHOD_CREATE_SIGNER_FROM_PRIVATE_KEY,
+            BridgeMethodConstants.METHOD_CREATE_SIGNER_FROM_CUSTOM,
+            BridgeMethodConstants.METHOD_CREATE_V5R1_WALLET_ADAPTER,
+            BridgeMethodConstants.METHOD_CREATE_V4R2_WALLET_ADAPTER,
+            BridgeMethodConstants.METHOD_CREATE_TON_MNEMONIC,
+            BridgeMethodConstants.METHOD_MNEMONIC_TO_KEY_PAIR,
+            BridgeMethodConstants.METHOD_SIGN,
+            BridgeMethodConstants.METHOD_LIST_SESSIONS,
+            BridgeMethodConstants.METHOD_EMIT_BROWSER_PAGE_STARTED,
+            BridgeMethodConstants.METHOD_EMIT_BROWSER_PAGE_FINISHED,
+            BridgeMethodConstants.METHOD_EMIT_BROWSER_ERROR,
+        )
+
+        private val emulation = setOf(
+            BridgeMethodConstants.METHOD_GET_TRANSACTION_PREVIEW,
+        )
+
+        fun of(method: String): BridgeMethodClass = when (method) {
+            in local -> LOCAL
+            in emulation -> EMULATION
+            else -> NETWORK
+        }
+    }
+}
+
+/**
+ * Per-method call policy for [BridgeRpcClient].
+ */
+internal class BridgeCallPolicy(
+    private val deadlines: TONWalletKitConfiguration.CallDeadlines = TONWalletKitConfiguration.CallDeadlines(),
+) {
+    /** Deadline in milliseconds for [method], or null for none. */
+    fun deadlineFor(method: String): Long? = when (BridgeMethodClass.of(method)) {
+        BridgeMethodClass.LOCAL -> deadlines.localMillis
+        BridgeMethodClass.NETWORK -> deadlines.networkMillis
+        BridgeMethodClass.EMULATION -> deadlines.emulationMillis
+    }
+
+    /**
+     * Scheduling class for [method]: approvals and signing jump the queue, streaming and
+     * browser notifications yield to everything else.
+     */
+    fun priorityFor(method: String): BridgePriority = when (method) {
+        in interactive -> BridgePriority.INTERACTIVE
+        in background -> BridgePriority.BACKGROUND
+        else -> BridgePriority.FOREGROUND
+    }
+
+    /**
+     * Whether a call to [method] can be re-sent to a fresh JS context without side effects.
+     * Only reads and pure builders qualify; anything not listed, signing included, is not.
+     */
+    fun isReplayable(method: String): Boolean = method in replayable
+
+    private companion object {
+        private val interactive = setOf(
+            BridgeMethodConstants.METHOD_APPROVE_CONNECT_REQUEST,
+            BridgeMethodConstants.METHOD_REJECT_CONNECT_REQUEST,
+            BridgeMethodConstants.METHOD_APPROVE_TRANSACTION_REQUEST,
+            BridgeMethodConstants.METHOD_REJECT_TRANSACTION_REQUEST,
+            BridgeMethodConstants.METHOD_APPROVE_SIGN_DATA_REQUEST,
+            BridgeMethodConstants.METHOD_REJECT_SIGN_DATA_REQUEST,
+            BridgeMethodConstants.METHOD_APPROVE_SIGN_MESSAGE_REQUEST,
+            BridgeMethodConstants.METHOD_REJECT_SIGN_MESSAGE_REQUEST,
+            BridgeMethodConstants.METHOD_HANDLE_TON_CONNECT_URL,
+            BridgeMethodConstants.METHOD_SEND_TRANSACTION,
+            BridgeMethodConstants.METHOD_SIGN,
+        )
+
+        private val replayable = setOf(
+            BridgeMethodConstants.METHOD_GET_WALLETS,
+            BridgeMethodConstants.METHOD_GET_WALLET,
+            BridgeMethodConstants.METHOD_GET_WALLET_ADDRESS,
+            BridgeMethodConstants.METHOD_GET_BALANCE,
+            BridgeMethodConstants.METHOD_GET_NFTS,
+            BridgeMethodConstants.METHOD_GET_NFT,
+            BridgeMethodConstants.METHOD_GET_JETTONS,
+            BridgeMethodConstants.METHOD_GET_JETTON_BALANCE,
+            BridgeMethodConstants.METHOD_GET_JETTON_WALLET_ADDRESS,
+            BridgeMethodConstants.METHOD_GET_TRANSACTION_PREVIEW,
+            BridgeMethodConstants.METHOD_LIST_SESSIONS,
+            BridgeMethodConstants.METHOD_CONNECTION_EVENT_FROM_URL,
+            BridgeMethodConstants.METHOD_CREATE_TRANSFER_TON_TRANSACTION,
+            BridgeMethodConstants.METHOD_CREATE_TRANSFER_MULTI_TON_TRANSACTION,
+            BridgeMethodConstants.METHOD_CREATE_TRANSFER_NFT_TRANSACTION,
+            BridgeMethodConstants.METHOD_CREATE_TRANSFER_NFT_RAW_TRANSACTION,
+            BridgeMethodConstants.METHOD_CREATE_TRANSFER_JETTON_TRANSACTION,
+            BridgeMethodConstants.METHOD_MNEMONIC_TO_KEY_PAIR,
+            BridgeMethodConstants.METHOD_WALLET_CLIENT_RUN_GET_METHOD,
+            BridgeMethodConstants.METHOD_WALLET_CLIENT_GET_MASTERCHAIN_INFO,
+            BridgeMethodConstants.METHOD_GET_SWAP_QUOTE,
+            BridgeMethodConstants.METHOD_GET_SWAP_PROVIDER_METADATA,
+            BridgeMethodConstants.METHOD_GET_SWAP_PROVIDER_SUPPORTED_NETWORKS,
+            BridgeMethodConstants.METHOD_GET_REGISTERED_SWAP_PROVIDERS,
+            BridgeMethodConstants.METHOD_HAS_SWAP_PROVIDER,
+            BridgeMethodConstants.METHOD_GET_STAKING_QUOTE,
+            BridgeMethodConstants.METHOD_GET_STAKED_BALANCE,
+            BridgeMethodConstants.METHOD_GET_STAKING_PROVIDER_INFO,
+            BridgeMethodConstants.METHOD_GET_STAKING_PROVIDER_METADATA,
+            BridgeMethodConstants.METHOD_GET_STAKING_PROVIDER_SUPPORTED_NETWORKS,
+            BridgeMethodConstants.METHOD_GET_REGISTERED_STAKING_PROVIDERS,
+            BridgeMethodConstants.METHOD_HAS_STAKING_PROVIDER,
+            BridgeMethodConstants.METHOD_STREAMING_HAS_PROVIDER,
+        )
+
+        private val background = setOf(
+            BridgeMethodConstants.METHOD_KOTLIN_PROVIDER_DISPATCH,
+            BridgeMethodConstants.METHOD_EMIT_BROWSER_PAGE_STARTED,
+            BridgeMethodConstants.METHOD_EMIT_BROWSER_PAGE_FINISHED,
+            BridgeMethodConstants.METHOD_EMIT_BROWSER_ERROR,
+        )
+    }
+}
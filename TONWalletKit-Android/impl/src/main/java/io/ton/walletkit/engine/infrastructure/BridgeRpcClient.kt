@@ -22,24 +22,34 @@
 package io.ton.walletkit.engine.infrastructure
 
 import io.ton.walletkit.WalletKitBridgeException
+import io.ton.walletkit.WalletKitContextLostException
 import io.ton.walletkit.bridge.BridgeCodec
+import io.ton.walletkit.bridge.BridgeEnvelope
+import io.ton.walletkit.bridge.BridgeEnvelopeWriter
+import io.ton.walletkit.bridge.BridgePayload
 import io.ton.walletkit.bridge.decodeFromBridge
 import io.ton.walletkit.bridge.decodeFromBridgeOrNull
 import io.ton.walletkit.bridge.dispatch.WrappedFunctionRegistry
 import io.ton.walletkit.bridge.optString
+import io.ton.walletkit.bridge.transport.BinaryRef
+import io.ton.walletkit.bridge.transport.BridgeBinaryCodec
+import io.ton.walletkit.bridge.transport.BridgePriority
 import io.ton.walletkit.internal.constants.BridgeMethodConstants
 import io.ton.walletkit.internal.constants.LogConstants
 import io.ton.walletkit.internal.constants.ResponseConstants
 import io.ton.walletkit.internal.util.Logger
+import kotlinx.coroutines.CancellationException
 import kotlinx.coroutines.CompletableDeferred
+import kotlinx.coroutines.withTimeoutOrNull
 import kotlinx.serialization.json.Json
 import kotlinx.serialization.json.JsonArray
 import kotlinx.serialization.json.JsonElement
 import kotlinx.serialization.json.JsonNull
 import kotlinx.serialization.json.JsonObject
+import kotlinx.serialization.json.JsonPrimitive
 import kotlinx.serialization.json.buildJsonObject
+import kotlinx.serialization.json.intOrNull
 import kotlinx.serialization.json.put
-import java.util.UUID
 import java.util.concurrent.ConcurrentHashMap
 
 internal class BridgeRpcClient(
@@ -47,8 +57,13 @@ internal class BridgeRpcClient(
     private val codec: BridgeCodec,
     private val ensureInitialized: suspend () -> Unit,
     @PublishedApi internal val json: Json,
+    private val callPolicy: BridgeCallPolicy = BridgeCallPolicy(),
+    val metrics: BridgeCallMetrics = BridgeCallMetrics(),
 ) {
-    private val pending = ConcurrentHashMap<String, CompletableDeferred<BridgeResponse>>()
+    private val pending = PendingCallTable<PendingCall>()
+    private val inboundAttachments = ConcurrentHashMap<Int, List<ByteArray>>()
+    private val envelopeWriter = BridgeEnvelopeWriter(codec)
+
     private val ready = CompletableDeferred<Unit>()
 
     /**
@@ -65,7 +80,30 @@ internal class BridgeRpcClient(
     suspend fun call(method: String, params: Any? = null): JsonObject = wrap(send(method, params))
 
     /** Send a request to JS and return the raw decoded result; callers may discard it. */
-    suspend fun send(method: String, params: Any? = null): JsonElement {
+    suspend fun send(method: String, params: Any? = null): JsonElement = sendPayload(method, params).element
+
+    /**
+     * Like [send], but leaves the result as JSON text until it is decoded. Typed callers go
+     * through [callTyped], which deserializes the text without building a [JsonElement] first.
+     */
+    suspend fun sendPayload(method: String, params: Any? = null): BridgePayload =
+        dispatch(method, params, emptyList()).payload
+
+    /** True when byte payloads can use [sendWithAttachments] instead of JSON arrays or hex. */
+    val supportsBinary: Boolean
+        get() = webViewManager.transport.supportsBinary
+
+    /**
+     * Like [send], but ships [attachments] as a single ArrayBuffer message next to the envelope.
+     * [params] refer to them with [BinaryRef]; byte results JS sends back the same way are
+     * returned in [AttachedResult.attachments]. Callers must check [supportsBinary] first.
+     */
+    suspend fun sendWithAttachments(method: String, params: Any?, attachments: List<ByteArray>): AttachedResult {
+        val response = dispatch(method, params, attachments)
+        return AttachedResult(response.payload.element, response.attachments)
+    }
+
+    private suspend fun dispatch(method: String, params: Any?, attachments: List<ByteArray>): BridgeResponse {
         webViewManager.webViewInitialized.await()
         webViewManager.transport.awaitReady()
         if (method != BridgeMethodConstants.METHOD_INIT) {
@@ -73,48 +111,223 @@ internal class BridgeRpcClient(
             ensureInitialized()
         }
 
-        val callId = UUID.randomUUID().toString()
+        val priority = callPolicy.priorityFor(method)
+        val startedAt = metrics.startTimer()
         val deferred = CompletableDeferred<BridgeResponse>()
-        pending[callId] = deferred
-
-        val envelope = buildJsonObject {
-            put(ResponseConstants.KEY_KIND, ResponseConstants.VALUE_KIND_CALL)
-            put(ResponseConstants.KEY_ID, callId)
-            put(ResponseConstants.KEY_METHOD, method)
-            val encoded = codec.encode(params)
-            if (encoded !is JsonNull) {
-                put(ResponseConstants.KEY_PARAMS, encoded)
+        val call = PendingCall(deferred, method, priority, attachments)
+        val callId = pending.register(call)
+        var requestSize = 0
+        try {
+            val envelope = envelopeWriter.call(callId, method, params, attachments.size, priority)
+            if (callPolicy.isReplayable(method)) call.replayEnvelope = envelope
+            requestSize = envelope.length + attachments.sumOf { it.size }
+            if (attachments.isNotEmpty()) {
+                webViewManager.transport.sendBinary(BridgeBinaryCodec.encode(callId.toString(), attachments))
+            }
+            webViewManager.transport.send(envelope, priority)
+        } catch (e: Throwable) {
+            pending.remove(callId)
+            throw e
+        }
+        metrics.onCallStarted()
+
+        var response: BridgeResponse? = null
+        try {
+            val deadline = callPolicy.deadlineFor(method)
+            response = try {
+                if (deadline != null) withTimeoutOrNull(deadline) { deferred.await() } else deferred.await()
+            } catch (e: CancellationException) {
+                metrics.onCallCancelled()
+                abandon(callId, priority)
+                throw e
+            }
+            if (response == null) {
+                metrics.onDeadlineExceeded()
+                abandon(callId, priority)
+                throw WalletKitBridgeException("call[$callId] $method exceeded its ${deadline}ms deadline")
+            }
+            return response
+        } finally {
+            metrics.onCallFinished(method, startedAt, requestSize, response?.size ?: 0, failed = response == null)
+        }
+    }
+
+    /**
+     * Called when the JS context was recreated and every call in flight was lost with it. Calls
+     * that [BridgeCallPolicy.isReplayable] allows stay pending, and so do calls whose envelope is
+     * in [undelivered]: JS never saw those, so sending them again is safe. Their ids are returned
+     * for [replay]; the rest fail with [WalletKitContextLostException].
+     */
+    fun onContextLost(undelivered: List<String> = emptyList()): List<Int> {
+        val unsent = HashMap<Int, String>()
+        for (text in undelivered) {
+            val envelope = try {
+                BridgeEnvelope.parse(text)
+            } catch (e: IllegalArgumentException) {
+                continue
+            }
+            val id = envelope.intId ?: continue
+            if (envelope.kind == ResponseConstants.VALUE_KIND_CALL) unsent[id] = text
+        }
+        val replayIds = ArrayList<Int>()
+        var failed = 0
+        pending.forEach { id, call ->
+            inboundAttachments.remove(id)
+            unsent[id]?.let { call.replayEnvelope = it }
+            if (call.replayEnvelope != null) {
+                replayIds.add(id)
+            } else if (pending.remove(id) != null) {
+                call.deferred.completeExceptionally(WalletKitContextLostException(call.method))
+                failed++
+            }
+        }
+        metrics.onContextLost(failed)
+        if (replayIds.isNotEmpty() || failed > 0) {
+            Logger.w(TAG, "JS context lost: replaying ${replayIds.size} calls, failed $failed")
+        }
+        return replayIds
+    }
+
+    /**
+     * Re-sends the calls kept by [onContextLost] under their original ids, once the new context
+     * is initialized. Calls that completed or were abandoned in the meantime are skipped.
+     */
+    fun replay(callIds: List<Int>) {
+        var replayed = 0
+        for (id in callIds) {
+            val call = pending.get(id) ?: continue
+            val envelope = call.replayEnvelope ?: continue
+            try {
+                if (call.attachments.isNotEmpty()) {
+                    webViewManager.transport.sendBinary(BridgeBinaryCodec.encode(id.toString(), call.attachments))
+                }
+                webViewManager.transport.send(envelope, call.priority)
+                replayed++
+            } catch (e: Exception) {
+                pending.remove(id)?.deferred?.completeExceptionally(
+                    WalletKitBridgeException("call[$id] ${call.method} could not be replayed: ${e.message}"),
+                )
             }
         }
+        metrics.onCallsReplayed(replayed)
+    }
 
-        webViewManager.transport.send(envelope.toString())
-        return deferred.await().raw
+    /** Fails calls kept by [onContextLost] when the context could not be re-initialized. */
+    fun failReplay(callIds: List<Int>, cause: WalletKitBridgeException) {
+        for (id in callIds) {
+            pending.remove(id)?.deferred?.completeExceptionally(cause)
+        }
     }
 
+    /** [metrics] plus gauges owned by the transport. */
+    fun metricsSnapshot() = metrics.snapshot(webViewManager.outboundQueueDepth, webViewManager.startupTimeline.snapshot())
+
+    /**
+     * Drops a call nobody is waiting for and tells JS to stop working on it. The cancel goes in
+     * the call's own lane so it can't overtake a call that is still queued.
+     */
+    private fun abandon(callId: Int, priority: BridgePriority) {
+        inboundAttachments.remove(callId)
+        if (pending.remove(callId) == null) return
+        try {
+            webViewManager.transport.send(envelopeWriter.cancel(callId), priority)
+            metrics.onCancelSent()
+        } catch (e: Exception) {
+            Logger.w(TAG, "Failed to send cancel for call[$callId]: ${e.message}")
+        }
+    }
+
+    /**
+     * Stores the attachments of an upcoming response. JS posts them before the envelope on the
+     * same port, so they are always in place by the time [handleResponse] runs.
+     */
+    fun handleBinary(message: ByteArray) {
+        val decoded = try {
+            BridgeBinaryCodec.decode(message)
+        } catch (e: IllegalArgumentException) {
+            Logger.e(TAG, "Dropping malformed binary bridge message", e)
+            return
+        }
+        val id = decoded.id.toIntOrNull()
+        if (id == null || !pending.contains(id)) {
+            Logger.w(TAG, "handleBinary: No deferred found for id: ${decoded.id}")
+            return
+        }
+        inboundAttachments[id] = decoded.payloads
+    }
+
+    /** Routes a response whose id was not read as a number; forward-call ids are always integers. */
     fun handleResponse(id: String, response: JsonObject) {
-        val deferred = pending.remove(id)
+        val callId = id.toIntOrNull()
+        if (callId == null) {
+            Logger.w(TAG, "handleResponse: No deferred found for id: $id")
+            return
+        }
+        handleResponse(callId, response)
+    }
+
+    fun handleResponse(id: Int, response: JsonObject) {
+        complete(
+            id = id,
+            readError = { response[ResponseConstants.KEY_ERROR] as? JsonObject },
+            readResult = { BridgePayload.of(response[ResponseConstants.KEY_RESULT] ?: JsonNull) },
+            expectedAttachments = (response[BridgeBinaryCodec.KEY_BIN] as? JsonPrimitive)?.intOrNull ?: 0,
+            envelopeSize = 0,
+        )
+    }
+
+    /** Routes a response straight from its envelope; the result stays unparsed until decoded. */
+    fun handleResponse(envelope: BridgeEnvelope) {
+        val id = envelope.intId
+        if (id == null) {
+            Logger.w(TAG, "handleResponse: No deferred found for id: ${envelope.id}")
+            return
+        }
+        complete(
+            id = id,
+            readError = { envelope.element(ResponseConstants.KEY_ERROR, json) as? JsonObject },
+            readResult = { BridgePayload.ofText(json, envelope.rawValue(ResponseConstants.KEY_RESULT)) },
+            expectedAttachments = envelope.rawValue(BridgeBinaryCodec.KEY_BIN)?.toIntOrNull() ?: 0,
+            envelopeSize = envelope.text.length,
+        )
+    }
+
+    private inline fun complete(
+        id: Int,
+        readError: () -> JsonObject?,
+        readResult: () -> BridgePayload,
+        expectedAttachments: Int,
+        envelopeSize: Int,
+    ) {
+        val deferred = pending.remove(id)?.deferred
+        val attachments = inboundAttachments.remove(id).orEmpty()
         if (deferred == null) {
             Logger.w(TAG, "handleResponse: No deferred found for id: $id")
             return
         }
-        val error = response[ResponseConstants.KEY_ERROR] as? JsonObject
+        val error = readError()
         if (error != null) {
             val message = error.optString(ResponseConstants.KEY_MESSAGE, ResponseConstants.ERROR_MESSAGE_DEFAULT)
             Logger.e(TAG, ERROR_CALL_FAILED + id + ERROR_FAILED_SUFFIX + message)
             deferred.completeExceptionally(WalletKitBridgeException(message))
             return
         }
-        val raw = response[ResponseConstants.KEY_RESULT] ?: JsonNull
-        deferred.complete(BridgeResponse(raw))
+        if (attachments.size != expectedAttachments) {
+            deferred.completeExceptionally(
+                WalletKitBridgeException("call[$id] expected $expectedAttachments binary attachments, got ${attachments.size}"),
+            )
+            return
+        }
+        deferred.complete(BridgeResponse(readResult(), attachments, envelopeSize + attachments.sumOf { it.size }))
     }
 
     fun failAll(exception: WalletKitBridgeException) {
-        pending.values.forEach { deferred ->
-            if (!deferred.isCompleted) {
-                deferred.completeExceptionally(exception)
+        pending.drain { call ->
+            if (!call.deferred.isCompleted) {
+                call.deferred.completeExceptionally(exception)
             }
         }
-        pending.clear()
+        inboundAttachments.clear()
         if (!ready.isCompleted) {
             ready.completeExceptionally(exception)
         }
@@ -135,7 +348,32 @@ internal class BridgeRpcClient(
         else -> buildJsonObject { put(ResponseConstants.KEY_VALUE, raw) }
     }
 
-    private data class BridgeResponse(val raw: JsonElement)
+    private class PendingCall(
+        val deferred: CompletableDeferred<BridgeResponse>,
+        val method: String,
+        val priority: BridgePriority,
+        val attachments: List<ByteArray>,
+    ) {
+        /** The call's envelope, kept only for replayable methods. */
+        @Volatile var replayEnvelope: String? = null
+    }
+
+    private class BridgeResponse(
+        val payload: BridgePayload,
+        val attachments: List<ByteArray> = emptyList(),
+        /** Envelope length plus attachment bytes, for [metrics]. */
+        val size: Int = 0,
+    )
+
+    /** Result of [sendWithAttachments]. */
+    class AttachedResult(val raw: JsonElement, val attachments: List<ByteArray>) {
+        /** Bytes referenced by a `{"__bin": n}` result, or null when JS answered in plain JSON. */
+        fun bytesOrNull(): ByteArray? {
+            val index = ((raw as? JsonObject)?.get(BridgeBinaryCodec.KEY_BIN_REF) as? JsonPrimitive)?.intOrNull
+                ?: return null
+            return attachments.getOrNull(index)
+        }
+    }
 
     private companion object {
         private const val TAG = LogConstants.TAG_WEBVIEW_ENGINE
@@ -147,9 +385,9 @@ internal class BridgeRpcClient(
 internal suspend inline fun <reified T : Any> BridgeRpcClient.callTyped(
     method: String,
     params: Any? = null,
-): T = json.decodeFromBridge(send(method, params))
+): T = json.decodeFromBridge(sendPayload(method, params))
 
 internal suspend inline fun <reified T : Any> BridgeRpcClient.callTypedOrNull(
     method: String,
     params: Any? = null,
-): T? = json.decodeFromBridgeOrNull(send(method, params))
+): T? = json.decodeFromBridgeOrNull(sendPayload(method, params))
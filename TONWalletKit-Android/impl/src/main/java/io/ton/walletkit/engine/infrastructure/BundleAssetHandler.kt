@@ -0,0 +1,130 @@
+/*
+ * Copyright (c) 2025 TonTech
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+package io.ton.walletkit.engine.infrastructure
+
+import android.content.res.AssetManager
+import android.webkit.WebResourceResponse
+import androidx.webkit.WebViewAssetLoader
+import io.ton.walletkit.internal.constants.LogConstants
+import io.ton.walletkit.internal.util.Logger
+import java.io.ByteArrayInputStream
+import java.io.IOException
+import java.security.MessageDigest
+import java.util.concurrent.ConcurrentHashMap
+
+/**
+ * Serves the bridge page and its scripts so WebView can keep the compiled bundle across launches.
+ *
+ * The page is rewritten to load each script from a URL carrying the script's content hash, and
+ * scripts are served as immutable under that URL. With the WebView cache enabled, V8 can reuse
+ * its code cache instead of parsing and compiling the bundle on every process start, and a new
+ * bundle gets a new URL, so a stale entry is never picked up. The page itself is always
+ * revalidated. Paths outside the page's directory fall through to [fallback].
+ *
+ * @param pagePath Asset path of the bridge page, e.g. `walletkit/index.html`.
+ */
+internal class BundleAssetHandler(
+    private val assets: AssetManager,
+    private val pagePath: String,
+    private val fallback: WebViewAssetLoader.PathHandler,
+) : WebViewAssetLoader.PathHandler {
+    private val pageDir = pagePath.substringBeforeLast('/', "").let { if (it.isEmpty()) it else "$it/" }
+    private val hashes = ConcurrentHashMap<String, String>()
+
+    // Scripts read while hashing the page, kept until WebView requests them right after.
+    private val primed = ConcurrentHashMap<String, ByteArray>()
+
+    override fun handle(path: String): WebResourceResponse? =
+        try {
+            when {
+                path == pagePath -> servePage()
+                path.startsWith(pageDir) && isScript(path) -> serveScript(path)
+                else -> fallback.handle(path)
+            }
+        } catch (e: IOException) {
+            Logger.e(TAG, "Failed to serve bridge asset: $path", e)
+            null
+        }
+
+    private fun servePage(): WebResourceResponse {
+        val html = assets.open(pagePath).use { it.readBytes() }.decodeToString()
+        val versioned = versionScripts(html) { src -> hashOf(pageDir + src) }
+        return response(MIME_HTML, versioned.encodeToByteArray(), mapOf(HEADER_CACHE_CONTROL to CACHE_REVALIDATE))
+    }
+
+    private fun serveScript(path: String): WebResourceResponse {
+        val bytes = primed.remove(path) ?: assets.open(path).use { it.readBytes() }
+        val hash = hashes.getOrPut(path) { contentHash(bytes) }
+        return response(
+            MIME_JAVASCRIPT,
+            bytes,
+            mapOf(HEADER_CACHE_CONTROL to CACHE_IMMUTABLE, HEADER_ETAG to "\"$hash\""),
+        )
+    }
+
+    private fun hashOf(path: String): String? =
+        hashes[path] ?: try {
+            val bytes = assets.open(path).use { it.readBytes() }
+            primed[path] = bytes
+            contentHash(bytes).also { hashes[path] = it }
+        } catch (e: IOException) {
+            Logger.w(TAG, "Bridge script not found, loading it unversioned: $path")
+            null
+        }
+
+    private fun response(mimeType: String, body: ByteArray, headers: Map<String, String>) =
+        WebResourceResponse(mimeType, CHARSET_UTF_8, STATUS_OK, REASON_OK, headers, ByteArrayInputStream(body))
+
+    companion object {
+        private const val TAG = LogConstants.TAG_WEBVIEW_ENGINE
+        private const val MIME_HTML = "text/html"
+        private const val MIME_JAVASCRIPT = "text/javascript"
+        private const val CHARSET_UTF_8 = "utf-8"
+        private const val STATUS_OK = 200
+        private const val REASON_OK = "OK"
+        private const val HEADER_CACHE_CONTROL = "Cache-Control"
+        private const val HEADER_ETAG = "ETag"
+        private const val CACHE_REVALIDATE = "no-cache"
+        private const val CACHE_IMMUTABLE = "public, max-age=31536000, immutable"
+        private const val VERSION_PARAM = "v"
+        private const val HASH_CHARS = 16
+
+        private val SCRIPT_SRC = Regex("""(<script\b[^>]*\bsrc=")([^"?#]+\.m?js)(")""")
+
+        private fun isScript(path: String) = path.endsWith(".mjs") || path.endsWith(".js")
+
+        /** Appends `?v=<hash>` to every relative script `src` in [html] that [versionOf] knows. */
+        fun versionScripts(html: String, versionOf: (src: String) -> String?): String =
+            SCRIPT_SRC.replace(html) { match ->
+                val (prefix, src, suffix) = match.destructured
+                if (src.contains("://") || src.startsWith("/")) return@replace match.value
+                val version = versionOf(src) ?: return@replace match.value
+                "$prefix$src?$VERSION_PARAM=$version$suffix"
+            }
+
+        /** Leading hex digits of the SHA-256 of [bytes]. */
+        fun contentHash(bytes: ByteArray): String =
+            MessageDigest.getInstance("SHA-256").digest(bytes)
+                .joinToString("") { "%02x".format(it) }
+                .take(HASH_CHARS)
+    }
+}
@@ -0,0 +1,268 @@
+/*
+ * Copyright (c) 2025 TonTech
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+package io.ton.walletkit.engine.infrastructure
+
+import io.ton.walletkit.api.generated.TONDAppInfo
+import io.ton.walletkit.internal.constants.LogConstants
+import io.ton.walletkit.internal.constants.StorageConstants
+import io.ton.walletkit.internal.crypto.Ed25519
+import io.ton.walletkit.internal.util.Logger
+import io.ton.walletkit.model.TONUserFriendlyAddress
+import io.ton.walletkit.session.SessionFilter
+import io.ton.walletkit.session.TONConnectSession
+import io.ton.walletkit.session.TONConnectSessionChange
+import io.ton.walletkit.session.TONConnectSessionManager
+import kotlinx.coroutines.flow.MutableSharedFlow
+import kotlinx.coroutines.flow.SharedFlow
+import kotlinx.coroutines.flow.asSharedFlow
+import kotlinx.coroutines.sync.Mutex
+import kotlinx.coroutines.sync.withLock
+import kotlinx.serialization.encodeToString
+import kotlinx.serialization.json.Json
+import kotlinx.serialization.json.decodeFromJsonElement
+import kotlinx.serialization.json.jsonArray
+import java.security.SecureRandom
+import java.time.Instant
+import java.time.ZoneOffset
+import java.time.format.DateTimeFormatter
+
+/**
+ * The built-in session store enabled by
+ * [io.ton.walletkit.config.TONWalletKitConfiguration.EngineOptions.nativeSessionStore].
+ *
+ * Sessions are held in memory with indexes on walletId, domain and isJsBridge, so a filtered
+ * query touches only the sessions in its smallest matching index and the bundle receives just
+ * the matches. Each session is persisted under its own key through [StorageManager], next to a
+ * list of session ids, so creating or removing one session does not rewrite the others.
+ *
+ * Sessions are created exactly as the bundle's `TONConnectStoredSessionManager` creates them,
+ * with an X25519 key pair and the dApp URL's host as domain. The first load imports the
+ * bundle's stored session list, which is left in place. Clearing [storage] empties the store and
+ * the next access loads it again.
+ *
+ * @suppress Internal component. Use through [io.ton.walletkit.engine.WebViewWalletKitEngine].
+ */
+internal class IndexedSessionManager(
+    private val storage: StorageManager,
+    private val json: Json,
+    private val random: SecureRandom = SecureRandom(),
+    private val clock: () -> Instant = Instant::now,
+) : TONConnectSessionManager {
+    private val mutex = Mutex()
+    private var loaded = false
+
+    // Insertion-ordered, so unfiltered and indexed queries list sessions oldest first.
+    private val sessions = LinkedHashMap<String, TONConnectSession>()
+    private val byWallet = HashMap<String, MutableSet<String>>()
+    private val byDomain = HashMap<String, MutableSet<String>>()
+    private val byJsBridge = HashMap<Boolean, MutableSet<String>>()
+
+    private val _changes = MutableSharedFlow<TONConnectSessionChange>(extraBufferCapacity = CHANGE_BUFFER)
+
+    /** Creations, replacements and removals, emitted after they are applied. */
+    val changes: SharedFlow<TONConnectSessionChange> = _changes.asSharedFlow()
+
+    init {
+        storage.addClearListener(::onStorageCleared)
+    }
+
+    override suspend fun createSession(
+        sessionId: String,
+        dAppInfo: TONDAppInfo,
+        walletId: String,
+        walletAddress: String,
+        isJsBridge: Boolean,
+    ): TONConnectSession {
+        val domain = dAppInfo.url?.let { SessionFilter.domainOf(it) }
+            ?: throw IllegalArgumentException("Unable to resolve domain from dApp URL for new sessions")
+        val secretKey = ByteArray(Ed25519.SEED_BYTES).also(random::nextBytes)
+        val now = TIMESTAMP_FORMAT.format(clock())
+        val session = TONConnectSession(
+            sessionId = sessionId,
+            walletId = walletId,
+            walletAddress = TONUserFriendlyAddress(walletAddress),
+            createdAt = now,
+            lastActivityAt = now,
+            privateKey = secretKey.toHex(),
+            publicKey = Ed25519.x25519PublicKey(secretKey).toHex(),
+            domain = domain,
+            schemaVersion = SCHEMA_VERSION,
+            dAppName = dAppInfo.name,
+            dAppDescription = dAppInfo.description,
+            dAppUrl = dAppInfo.url,
+            dAppIconUrl = dAppInfo.iconUrl,
+            isJsBridge = isJsBridge,
+        )
+        val isNew = withLoaded {
+            val isNew = put(session) == null
+            // The session goes out before the id list, so a stored id always has its session.
+            storage.set(sessionKey(sessionId), json.encodeToString(session))
+            if (isNew) persistIndex()
+            isNew
+        }
+        publish(if (isNew) TONConnectSessionChange.Created(session) else TONConnectSessionChange.Replaced(session))
+        return session
+    }
+
+    override suspend fun getSession(sessionId: String): TONConnectSession? = withLoaded { sessions[sessionId] }
+
+    override suspend fun getSessions(filter: SessionFilter?): List<TONConnectSession> = withLoaded { select(filter) }
+
+    override suspend fun removeSession(sessionId: String) {
+        removeWhere { listOf(sessionId) }
+    }
+
+    override suspend fun removeSessions(filter: SessionFilter?) {
+        removeWhere { select(filter).map { it.sessionId } }
+    }
+
+    override suspend fun clearSessions() {
+        removeWhere { sessions.keys.toList() }
+    }
+
+    /** Removes the sessions whose ids [selectIds] returns under the lock, and returns the removed ids. */
+    private suspend fun removeWhere(selectIds: () -> List<String>): List<String> {
+        val removed = withLoaded {
+            val ids = selectIds().filter { drop(it) != null }
+            if (ids.isNotEmpty()) {
+                persistIndex()
+                storage.removeMany(ids.map(::sessionKey))
+            }
+            ids
+        }
+        if (removed.isNotEmpty()) publish(TONConnectSessionChange.Removed(removed))
+        return removed
+    }
+
+    /** Storage was cleared with the sessions in it: forget them and load afresh on next use. */
+    private suspend fun onStorageCleared() {
+        val removed = mutex.withLock {
+            val ids = sessions.keys.toList()
+            sessions.clear()
+            byWallet.clear()
+            byDomain.clear()
+            byJsBridge.clear()
+            loaded = false
+            ids
+        }
+        if (removed.isNotEmpty()) publish(TONConnectSessionChange.Removed(removed))
+    }
+
+    /** Never suspends the store on a slow collector; a change that does not fit is dropped. */
+    private fun publish(change: TONConnectSessionChange) {
+        if (!_changes.tryEmit(change)) Logger.w(TAG, "Session change buffer full, dropping $change")
+    }
+
+    private fun select(filter: SessionFilter?): List<TONConnectSession> {
+        if (filter == null) return sessions.values.toList()
+        // Walk the smallest index that applies; matches() checks the remaining criteria.
+        val candidates = listOfNotNull(
+            filter.walletId?.takeIf { it.isNotEmpty() }?.let { byWallet[it].orEmpty() },
+            filter.normalizedDomain()?.let { byDomain[it].orEmpty() },
+            filter.isJsBridge?.let { byJsBridge[it].orEmpty() },
+        ).minByOrNull { it.size } ?: return sessions.values.toList()
+        return candidates.mapNotNull { sessions[it] }.filter(filter::matches)
+    }
+
+    private fun put(session: TONConnectSession): TONConnectSession? {
+        val previous = sessions.put(session.sessionId, session)
+        previous?.let(::unindex)
+        byWallet.getOrPut(session.walletId, ::LinkedHashSet).add(session.sessionId)
+        byDomain.getOrPut(session.domain, ::LinkedHashSet).add(session.sessionId)
+        session.isJsBridge?.let { byJsBridge.getOrPut(it, ::LinkedHashSet).add(session.sessionId) }
+        return previous
+    }
+
+    private fun drop(sessionId: String): TONConnectSession? = sessions.remove(sessionId)?.also(::unindex)
+
+    private fun unindex(session: TONConnectSession) {
+        byWallet.removeId(session.walletId, session.sessionId)
+        byDomain.removeId(session.domain, session.sessionId)
+        session.isJsBridge?.let { byJsBridge.removeId(it, session.sessionId) }
+    }
+
+    private fun <K> HashMap<K, MutableSet<String>>.removeId(key: K, sessionId: String) {
+        val ids = get(key) ?: return
+        ids.remove(sessionId)
+        if (ids.isEmpty()) remove(key)
+    }
+
+    private suspend inline fun <T> withLoaded(block: () -> T): T = mutex.withLock {
+        if (!loaded) {
+            load()
+            loaded = true
+        }
+        block()
+    }
+
+    private suspend fun load() {
+        val index = storage.get(StorageConstants.SESSION_INDEX_KEY)
+        if (index == null) {
+            importBundleSessions()
+            return
+        }
+        val ids = runCatching { json.decodeFromString<List<String>>(index) }
+            .onFailure { Logger.w(TAG, "Session index is unreadable, starting empty", it) }
+            .getOrDefault(emptyList())
+        val stored = storage.getMany(ids.map(::sessionKey))
+        for (id in ids) {
+            val raw = stored[sessionKey(id)] ?: continue
+            runCatching { json.decodeFromString<TONConnectSession>(raw) }
+                .onSuccess { put(it) }
+                .onFailure { Logger.w(TAG, "Skipping unreadable session: $id", it) }
+        }
+        Logger.d(TAG, "Loaded ${sessions.size} sessions")
+    }
+
+    private suspend fun importBundleSessions() {
+        val stored = storage.get(StorageConstants.BUNDLE_SESSIONS_KEY)
+        val elements = stored?.let { runCatching { json.parseToJsonElement(it).jsonArray }.getOrNull() }.orEmpty()
+        // Sessions from before walletAddress was recorded can't be completed here and are skipped.
+        val imported = elements.mapNotNull { runCatching { json.decodeFromJsonElement<TONConnectSession>(it) }.getOrNull() }
+        imported.forEach(::put)
+        if (imported.isNotEmpty()) {
+            storage.setMany(imported.associate { sessionKey(it.sessionId) to json.encodeToString(it) })
+        }
+        // Written even when empty, so the import runs once.
+        persistIndex()
+        if (elements.isNotEmpty()) {
+            Logger.d(TAG, "Imported ${imported.size} of ${elements.size} sessions from the bundle's session list")
+        }
+    }
+
+    private suspend fun persistIndex() {
+        storage.set(StorageConstants.SESSION_INDEX_KEY, json.encodeToString(sessions.keys.toList()))
+    }
+
+    private fun sessionKey(sessionId: String) = StorageConstants.KEY_PREFIX_SESSION + sessionId
+
+    private fun ByteArray.toHex() = joinToString("") { "%02x".format(it) }
+
+    companion object {
+        private const val TAG = LogConstants.TAG_SESSION_STORE
+        private const val SCHEMA_VERSION = 1
+        private const val CHANGE_BUFFER = 64
+
+        // Date.prototype.toISOString(), as the bundle stamps sessions.
+        private val TIMESTAMP_FORMAT = DateTimeFormatter.ofPattern("yyyy-MM-dd'T'HH:mm:ss.SSS'Z'").withZone(ZoneOffset.UTC)
+    }
+}
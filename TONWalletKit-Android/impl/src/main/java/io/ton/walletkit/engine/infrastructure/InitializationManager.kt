@@ -37,6 +37,7 @@ import io.ton.walletkit.internal.util.Logger
 import io.ton.walletkit.storage.TONWalletKitStorageType
 import kotlinx.coroutines.sync.Mutex
 import kotlinx.coroutines.sync.withLock
+import kotlinx.serialization.json.JsonObjectBuilder
 import kotlinx.serialization.json.add
 import kotlinx.serialization.json.addJsonObject
 import kotlinx.serialization.json.buildJsonObject
@@ -114,6 +115,19 @@ internal class InitializationManager(
 
     fun isInitialized(): Boolean = isWalletKitInitialized
 
+    /**
+     * Marks the JS side as uninitialized after its context was recreated, so the next
+     * [ensureInitialized] replays the last configuration.
+     *
+     * @return false when no init has completed yet, so there is nothing to replay.
+     */
+    fun invalidate(): Boolean {
+        val config = currentConfig ?: return false
+        pendingInitConfig = config
+        isWalletKitInitialized = false
+        return true
+    }
+
     fun isPersistentStorageEnabled(): Boolean = persistentStorageEnabled
 
     fun currentNetwork(): String = currentNetwork
@@ -176,28 +190,7 @@ internal class InitializationManager(
             put(JsonConstants.KEY_TON_API_URL, apiBaseUrl)
 
             // Pass all configured networks (matching iOS bridge format: networkConfigurations)
-            putJsonArray("networkConfigurations") {
-                for (networkConfig in configuration.networkConfigurations) {
-                    addJsonObject {
-                        putJsonObject("network") {
-                            put("chainId", networkConfig.network.chainId)
-                        }
-                        val apiClientTypeStr = when (networkConfig.apiClientType) {
-                            TONWalletKitConfiguration.APIClientType.DEFAULT -> "default"
-                            TONWalletKitConfiguration.APIClientType.TONCENTER -> "toncenter"
-                            TONWalletKitConfiguration.APIClientType.TONAPI -> "tonapi"
-                            TONWalletKitConfiguration.APIClientType.CUSTOM -> "custom"
-                        }
-                        put("apiClientType", apiClientTypeStr)
-                        networkConfig.apiClientConfiguration?.let { apiConfig ->
-                            putJsonObject("apiClientConfiguration") {
-                                apiConfig.url?.takeIf { it.isNotBlank() }?.let { put("url", it) }
-                                apiConfig.key?.takeIf { it.isNotBlank() }?.let { put("key", it) }
-                            }
-                        }
-                    }
-                }
-            }
+            putNetworkConfigurations(configuration.networkConfigurations)
 
             configuration.bridge.bridgeUrl.takeIf { it.isNotBlank() }?.let { put(JsonConstants.KEY_BRIDGE_URL, it) }
             configuration.walletManifest.name.takeIf { it.isNotBlank() }?.let { put(JsonConstants.KEY_BRIDGE_NAME, it) }
@@ -275,6 +268,59 @@ internal class InitializationManager(
         Logger.d(TAG, "WalletKit initialized. Event listeners will be set up on-demand.")
     }
 
+    /**
+     * Adds the networks of [configuration] that this engine does not serve yet. Before the first
+     * init they are merged into the pending configuration; afterwards they are registered with the
+     * running JS WalletKit, and the merged configuration is what a context recovery replays.
+     *
+     * @return The networks that were added.
+     */
+    suspend fun addNetworks(configuration: TONWalletKitConfiguration): List<TONNetwork> =
+        walletKitInitMutex.withLock {
+            val base = currentConfig ?: pendingInitConfig ?: return@withLock emptyList()
+            val known = base.networkConfigurations.map { it.network }.toSet()
+            val added = configuration.networkConfigurations.filter { it.network !in known }
+            if (added.isEmpty()) return@withLock emptyList()
+
+            val merged = base.copy(networkConfigurations = base.networkConfigurations + added)
+            if (isWalletKitInitialized) {
+                val payload = buildJsonObject { putNetworkConfigurations(added) }
+                rpcClient.send(BridgeMethodConstants.METHOD_ADD_NETWORKS, payload)
+                currentConfig = merged
+            } else {
+                pendingInitConfig = merged
+            }
+            Logger.d(TAG, "Added networks to shared engine: ${added.map { it.network.chainId }}")
+            added.map { it.network }
+        }
+
+    private fun JsonObjectBuilder.putNetworkConfigurations(
+        networkConfigurations: Collection<TONWalletKitConfiguration.NetworkConfiguration>,
+    ) {
+        putJsonArray("networkConfigurations") {
+            for (networkConfig in networkConfigurations) {
+                addJsonObject {
+                    putJsonObject("network") {
+                        put("chainId", networkConfig.network.chainId)
+                    }
+                    val apiClientTypeStr = when (networkConfig.apiClientType) {
+                        TONWalletKitConfiguration.APIClientType.DEFAULT -> "default"
+                        TONWalletKitConfiguration.APIClientType.TONCENTER -> "toncenter"
+                        TONWalletKitConfiguration.APIClientType.TONAPI -> "tonapi"
+                        TONWalletKitConfiguration.APIClientType.CUSTOM -> "custom"
+                    }
+                    put("apiClientType", apiClientTypeStr)
+                    networkConfig.apiClientConfiguration?.let { apiConfig ->
+                        putJsonObject("apiClientConfiguration") {
+                            apiConfig.url?.takeIf { it.isNotBlank() }?.let { put("url", it) }
+                            apiConfig.key?.takeIf { it.isNotBlank() }?.let { put("key", it) }
+                        }
+                    }
+                }
+            }
+        }
+    }
+
     private fun resolveNetworkName(configuration: TONWalletKitConfiguration): String =
         when (configuration.network.chainId) {
             TONNetwork.MAINNET.chainId -> NetworkConstants.NETWORK_MAINNET
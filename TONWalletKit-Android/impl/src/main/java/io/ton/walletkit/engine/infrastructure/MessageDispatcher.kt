@@ -31,6 +31,7 @@ import io.ton.walletkit.api.generated.TONStakingQuoteParams
 import io.ton.walletkit.api.generated.TONSwapParams
 import io.ton.walletkit.api.generated.TONSwapQuoteParams
 import io.ton.walletkit.api.generated.TONTransactionRequest
+import io.ton.walletkit.bridge.BridgeEnvelope
 import io.ton.walletkit.bridge.dispatch.AdapterByIdRequest
 import io.ton.walletkit.bridge.dispatch.AdapterSignDataRequest
 import io.ton.walletkit.bridge.dispatch.AdapterSignTonProofRequest
@@ -44,7 +45,14 @@ import io.ton.walletkit.bridge.dispatch.KotlinProviderUnwatchRequest
 import io.ton.walletkit.bridge.dispatch.KotlinProviderWatchRequest
 import io.ton.walletkit.bridge.dispatch.KotlinStakingGetProviderInfoRequest
 import io.ton.walletkit.bridge.dispatch.KotlinStakingGetStakedBalanceRequest
+import io.ton.walletkit.bridge.dispatch.SessionCreateRequest
+import io.ton.walletkit.bridge.dispatch.SessionFilterRequest
+import io.ton.walletkit.bridge.dispatch.SessionIdRequest
 import io.ton.walletkit.bridge.dispatch.SignWithCustomSignerRequest
+import io.ton.walletkit.bridge.dispatch.StorageKeyRequest
+import io.ton.walletkit.bridge.dispatch.StorageKeysRequest
+import io.ton.walletkit.bridge.dispatch.StorageSetManyRequest
+import io.ton.walletkit.bridge.dispatch.StorageSetRequest
 import io.ton.walletkit.bridge.optJsonObject
 import io.ton.walletkit.bridge.optString
 import io.ton.walletkit.bridge.optStringOrNull
@@ -62,20 +70,29 @@ import io.ton.walletkit.internal.constants.EventTypeConstants
 import io.ton.walletkit.internal.constants.JsonConstants
 import io.ton.walletkit.internal.constants.LogConstants
 import io.ton.walletkit.internal.constants.ResponseConstants
+import io.ton.walletkit.internal.constants.WebViewConstants
 import io.ton.walletkit.internal.util.Logger
+import io.ton.walletkit.session.TONConnectSession
+import io.ton.walletkit.session.TONConnectSessionManager
+import kotlinx.coroutines.CancellationException
 import kotlinx.coroutines.CoroutineScope
 import kotlinx.coroutines.Dispatchers
+import kotlinx.coroutines.SupervisorJob
+import kotlinx.coroutines.cancel
+import kotlinx.coroutines.currentCoroutineContext
 import kotlinx.coroutines.flow.MutableSharedFlow
 import kotlinx.coroutines.flow.SharedFlow
 import kotlinx.coroutines.flow.asSharedFlow
+import kotlinx.coroutines.isActive
 import kotlinx.coroutines.launch
-import kotlinx.coroutines.runBlocking
 import kotlinx.coroutines.sync.Mutex
 import kotlinx.coroutines.sync.withLock
 import kotlinx.serialization.json.Json
 import kotlinx.serialization.json.JsonElement
 import kotlinx.serialization.json.JsonObject
+import kotlinx.serialization.json.JsonPrimitive
 import kotlinx.serialization.json.buildJsonObject
+import kotlinx.serialization.json.intOrNull
 import kotlinx.serialization.json.put
 import java.util.UUID
 
@@ -87,6 +104,10 @@ import java.util.UUID
  * * Parse and dispatch typed events to registered handlers.
  * * Coordinate JavaScript-side event listener setup/teardown.
  * * Forward RPC responses to [BridgeRpcClient].
+ * * Serve reverse-RPC requests from JS, including the asynchronous storage and session protocols.
+ *
+ * Runs on the bridge I/O thread owned by [WebViewManager]; event delivery and anything that
+ * touches a WebView is posted to the main thread.
  *
  * @suppress Internal component. Use through [WebViewWalletKitEngine].
  */
@@ -96,6 +117,8 @@ internal class MessageDispatcher(
     private val eventRouter: EventRouter,
     private val initManager: InitializationManager,
     private val webViewManager: WebViewManager,
+    private val storageManager: StorageManager,
+    private val sessionManager: TONConnectSessionManager?,
     private val adapterManager: AdapterManager,
     private val signerManager: SignerManager,
     private val kotlinSwapProviderManager: KotlinSwapProviderManager,
@@ -112,6 +135,11 @@ internal class MessageDispatcher(
 
     @Volatile private var areEventListenersSetUp = false
 
+    private val reverseExecutor = ReverseRpcExecutor(rpcClient.metrics, REVERSE_CONCURRENCY_LIMITS)
+
+    // Context-loss recovery; cancelled with the dispatcher so no replay reaches a torn-down transport.
+    private val recoveryScope = CoroutineScope(SupervisorJob() + Dispatchers.IO)
+
     private val requestRegistry: BridgeRequestRegistry = BridgeRequestRegistry(json).apply {
         registerTypedJson<SignWithCustomSignerRequest, String>(REQUEST_METHOD_SIGN_WITH_CUSTOM_SIGNER) { req ->
             val signer = signerManager.getSigner(req.signerId)
@@ -205,6 +233,78 @@ internal class MessageDispatcher(
         registerTyped<CallByReferenceRequest>(REQUEST_METHOD_CALL_BY_REFERENCE) { req ->
             rpcClient.wrappedFunctions.invoke(req.refId, req.args)
         }
+
+        registerTypedJson<StorageKeyRequest, String?>(REQUEST_METHOD_STORAGE_GET) { req ->
+            storageManager.get(req.key)
+        }
+
+        registerTyped<StorageSetRequest>(REQUEST_METHOD_STORAGE_SET) { req ->
+            storageManager.set(req.key, req.value)
+            EMPTY_JSON_OBJECT
+        }
+
+        registerTyped<StorageKeyRequest>(REQUEST_METHOD_STORAGE_REMOVE) { req ->
+            storageManager.remove(req.key)
+            EMPTY_JSON_OBJECT
+        }
+
+        registerTypedJson<StorageKeysRequest, Map<String, String>>(REQUEST_METHOD_STORAGE_GET_MANY) { req ->
+            storageManager.getMany(req.keys)
+        }
+
+        registerTyped<StorageSetManyRequest>(REQUEST_METHOD_STORAGE_SET_MANY) { req ->
+            storageManager.setMany(req.values)
+            EMPTY_JSON_OBJECT
+        }
+
+        registerTyped<StorageKeysRequest>(REQUEST_METHOD_STORAGE_REMOVE_MANY) { req ->
+            storageManager.removeMany(req.keys)
+            EMPTY_JSON_OBJECT
+        }
+
+        register(REQUEST_METHOD_STORAGE_CLEAR) {
+            storageManager.clear()
+            EMPTY_JSON_OBJECT
+        }
+
+        registerTypedJson<SessionCreateRequest, TONConnectSession>(REQUEST_METHOD_SESSION_CREATE) { req ->
+            requireSessionManager().createSession(req.sessionId, req.dAppInfo, req.walletId, req.walletAddress, req.isJsBridge)
+        }
+
+        registerTypedJson<SessionIdRequest, TONConnectSession?>(REQUEST_METHOD_SESSION_GET) { req ->
+            requireSessionManager().getSession(req.sessionId)
+        }
+
+        registerTypedJson<SessionFilterRequest, List<TONConnectSession>>(REQUEST_METHOD_SESSION_GET_FILTERED) { req ->
+            requireSessionManager().getSessions(req.toFilter())
+        }
+
+        registerTyped<SessionIdRequest>(REQUEST_METHOD_SESSION_REMOVE) { req ->
+            requireSessionManager().removeSession(req.sessionId)
+            EMPTY_JSON_OBJECT
+        }
+
+        registerTyped<SessionFilterRequest>(REQUEST_METHOD_SESSION_REMOVE_FILTERED) { req ->
+            requireSessionManager().removeSessions(req.toFilter())
+            EMPTY_JSON_OBJECT
+        }
+
+        register(REQUEST_METHOD_SESSION_CLEAR) {
+            requireSessionManager().clearSessions()
+            EMPTY_JSON_OBJECT
+        }
+    }
+
+    /**
+     * Entry point for inbound port messages. Responses are routed from the envelope header
+     * alone; every other kind is rare enough to take the full [JsonObject] path.
+     */
+    fun dispatchMessage(envelope: BridgeEnvelope) {
+        if (envelope.kind == ResponseConstants.VALUE_KIND_RESPONSE) {
+            rpcClient.handleResponse(envelope)
+        } else {
+            dispatchMessage(envelope.toJsonObject(json))
+        }
     }
 
     fun dispatchMessage(payload: JsonObject) {
@@ -221,8 +321,12 @@ internal class MessageDispatcher(
                 }
             }
             ResponseConstants.VALUE_KIND_RESPONSE -> {
-                val id = payload.optString(ResponseConstants.KEY_ID)
-                rpcClient.handleResponse(id, payload)
+                val id = (payload[ResponseConstants.KEY_ID] as? JsonPrimitive)?.intOrNull
+                if (id != null) {
+                    rpcClient.handleResponse(id, payload)
+                } else {
+                    rpcClient.handleResponse(payload.optString(ResponseConstants.KEY_ID), payload)
+                }
             }
             ResponseConstants.VALUE_KIND_REQUEST -> handleRequest(payload)
             ResponseConstants.VALUE_KIND_JS_BRIDGE_EVENT -> handleJsBridgeEvent(payload)
@@ -278,18 +382,46 @@ internal class MessageDispatcher(
             return
         }
 
-        CoroutineScope(Dispatchers.IO).launch {
+        val task: suspend () -> Unit = {
+            val startedAt = rpcClient.metrics.startTimer()
             try {
                 val result = executeNativeRequest(method, params)
+                rpcClient.metrics.onReverseCallFinished(method, startedAt, failed = false)
                 respondToJs(id, result, null)
-            } catch (e: Exception) {
+            } catch (e: Throwable) {
+                // Only teardown leaves JS unanswered; a handler's own cancellation (a timeout
+                // inside a custom adapter) or Error is reported like any other failure.
+                if (e is CancellationException && !currentCoroutineContext().isActive) throw e
+                rpcClient.metrics.onReverseCallFinished(method, startedAt, failed = true)
                 Logger.e(TAG, "Reverse-RPC request failed: method=$method", e)
                 respondToJs(id, null, e.message ?: "Unknown error")
             }
         }
+        // Storage and session requests each share an ordered lane, so a read never overtakes an
+        // earlier write.
+        val accepted = if (method in STORAGE_METHODS) {
+            reverseExecutor.submitOrdered(STORAGE_LANE, task)
+        } else if (method in SESSION_METHODS) {
+            reverseExecutor.submitOrdered(SESSION_LANE, task)
+        } else {
+            reverseExecutor.submit(method, task)
+        }
+        if (!accepted) {
+            Logger.w(TAG, "Reverse-RPC executor saturated, asking JS to retry: method=$method")
+            respondBusy(id)
+        }
+    }
+
+    /**
+     * Stops reverse-RPC work and any context-loss recovery; queued and running handlers are
+     * cancelled without answering JS.
+     */
+    fun shutdown() {
+        recoveryScope.cancel()
+        reverseExecutor.shutdown()
     }
 
-    private suspend fun executeNativeRequest(method: String, params: JsonObject): String {
+    private suspend fun executeNativeRequest(method: String, params: JsonObject): JsonElement {
         return requestRegistry.dispatch(method, params)
     }
 
@@ -300,7 +432,10 @@ internal class MessageDispatcher(
         adapterManager.getAdapter(adapterId)
             ?: throw IllegalArgumentException("Adapter not found: $adapterId")
 
-    private fun respondToJs(id: String, result: String?, errorMessage: String?) {
+    private fun requireSessionManager() =
+        sessionManager ?: throw IllegalStateException("Session manager not configured")
+
+    private fun respondToJs(id: String, result: JsonElement?, errorMessage: String?) {
         val envelope = buildJsonObject {
             put(ResponseConstants.KEY_KIND, ResponseConstants.VALUE_KIND_RESPONSE)
             put(ResponseConstants.KEY_ID, id)
@@ -316,28 +451,45 @@ internal class MessageDispatcher(
         webViewManager.transport.send(envelope.toString())
     }
 
+    private fun respondBusy(id: String) {
+        val envelope = buildJsonObject {
+            put(ResponseConstants.KEY_KIND, ResponseConstants.VALUE_KIND_RESPONSE)
+            put(ResponseConstants.KEY_ID, id)
+            put(
+                ResponseConstants.KEY_ERROR,
+                buildJsonObject {
+                    put(ResponseConstants.KEY_MESSAGE, "Native request queue is full")
+                    put(ResponseConstants.KEY_CODE, ReverseRpcExecutor.BUSY_ERROR_CODE)
+                    put(KEY_RETRY_AFTER_MS, ReverseRpcExecutor.RETRY_AFTER_MILLIS)
+                },
+            )
+        }
+        webViewManager.transport.send(envelope.toString())
+    }
+
     private fun handleReady(payload: JsonObject) {
+        val protocolVersion = (payload[ResponseConstants.KEY_PROTOCOL_VERSION] as? JsonPrimitive)?.intOrNull ?: 0
+        if (protocolVersion != WebViewConstants.BRIDGE_PROTOCOL_VERSION) {
+            // A bundle on another protocol would misread every envelope; fail loudly instead.
+            val exception = WalletKitBridgeException(
+                "Bridge bundle speaks protocol $protocolVersion but this SDK requires " +
+                    "${WebViewConstants.BRIDGE_PROTOCOL_VERSION}. " + WebViewConstants.BUILD_INSTRUCTION,
+            )
+            Logger.e(TAG, "Refusing bridge bundle", exception)
+            rpcClient.failAll(exception)
+            return
+        }
+
         initManager.updateNetwork(payload.optStringOrNull(ResponseConstants.KEY_NETWORK))
         initManager.updateApiBaseUrl(payload.optStringOrNull(ResponseConstants.KEY_TON_API_URL))
 
-        val wasAlreadyReady = rpcClient.isReady()
+        webViewManager.startupTimeline.mark(StartupPhase.JS_READY)
 
-        if (!wasAlreadyReady) {
+        // Every init posts `ready`, including the one [onContextLost] sends to a reloaded page.
+        if (!rpcClient.isReady()) {
             rpcClient.markReady()
         }
 
-        if (wasAlreadyReady && areEventListenersSetUp) {
-            Logger.w(TAG, "Bridge ready event received again - JavaScript context was lost! Re-setting up event listeners...")
-            areEventListenersSetUp = false
-            CoroutineScope(Dispatchers.IO).launch {
-                try {
-                    ensureEventListenersSetUp()
-                } catch (e: Exception) {
-                    Logger.e(TAG, "Failed to re-setup event listeners after JS context loss", e)
-                }
-            }
-        }
-
         val data = JsonObject(payload.filterKeys { it != ResponseConstants.KEY_KIND })
         val readyEvent = buildJsonObject {
             put(ResponseConstants.KEY_TYPE, ResponseConstants.VALUE_KIND_READY)
@@ -346,12 +498,49 @@ internal class MessageDispatcher(
         handleEvent(readyEvent)
     }
 
+    /**
+     * The page hosting JS reloaded and its context was recreated: re-initialize it, restore event
+     * listeners, then replay the calls that are safe to repeat or never reached the old context
+     * ([undelivered]). The rest fail fast. The new init queues until [WebViewManager] hands the
+     * new page its port.
+     */
+    fun onContextLost(undelivered: List<String>) {
+        Logger.w(TAG, "Bridge page reloaded - JavaScript context was lost! Recovering...")
+        val startedAt = System.nanoTime()
+        // Invalidate first, so calls made from here on wait for the new init.
+        val reinitialize = initManager.invalidate()
+        val replayIds = rpcClient.onContextLost(undelivered)
+        val hadEventListeners = areEventListenersSetUp
+        areEventListenersSetUp = false
+
+        recoveryScope.launch {
+            try {
+                if (reinitialize) {
+                    initManager.ensureInitialized()
+                }
+                if (hadEventListeners) {
+                    ensureEventListenersSetUp()
+                }
+                rpcClient.replay(replayIds)
+                val elapsedMillis = (System.nanoTime() - startedAt) / 1_000_000
+                rpcClient.metrics.onContextRecovered(elapsedMillis)
+                Logger.i(TAG, "Recovered from JS context loss in ${elapsedMillis}ms, replayed ${replayIds.size} calls")
+            } catch (e: CancellationException) {
+                throw e
+            } catch (e: Exception) {
+                Logger.e(TAG, "Failed to recover from JS context loss", e)
+                rpcClient.failReplay(replayIds, WalletKitBridgeException("JS context recovery failed: ${e.message}"))
+            }
+        }
+    }
+
     private fun handleEvent(event: JsonObject) {
         val type = event.optString(JsonConstants.KEY_TYPE, EventTypeConstants.EVENT_TYPE_UNKNOWN)
         val data = event.optJsonObject(ResponseConstants.KEY_DATA) ?: JsonObject(emptyMap())
         val eventId = event.optString(JsonConstants.KEY_ID, UUID.randomUUID().toString())
 
-        // Streaming events are routed through the dedicated streaming channel
+        // Streaming events are routed through the dedicated streaming channel. They do not share
+        // the per-handler queues of typed events, so the two are not ordered against each other.
         val streamingEvent = eventParser.parseStreamingEvent(type, data)
         if (streamingEvent != null) {
             mainHandler.post { _streamingEvents.tryEmit(streamingEvent) }
@@ -366,11 +555,7 @@ internal class MessageDispatcher(
         }
 
         if (typedEvent != null) {
-            mainHandler.post {
-                runBlocking {
-                    eventRouter.dispatchEvent(eventId, type, typedEvent)
-                }
-            }
+            eventRouter.post(eventId, type, typedEvent)
         } else {
             Logger.w(TAG, MSG_FAILED_PARSE_TYPED_EVENT_PREFIX + type + " - event will be ignored")
         }
@@ -453,8 +638,8 @@ internal class MessageDispatcher(
      */
     private fun tryExtractCallId(malformedJson: String): String? {
         return try {
-            // Try to find "id":"value" or "id": "value" pattern
-            val regex = """"id"\s*:\s*"([^"]+)"""".toRegex()
+            // Try to find "id":123, "id":"value" or "id": "value" pattern
+            val regex = """"id"\s*:\s*"?([^",}\s]+)""".toRegex()
             val matchResult = regex.find(malformedJson)
             matchResult?.groupValues?.get(1)
         } catch (e: Exception) {
@@ -468,7 +653,7 @@ internal class MessageDispatcher(
         private const val MSG_FAILED_PARSE_TYPED_EVENT_PREFIX = "Failed to parse typed event for type: "
         private const val ERROR_FAILED_SET_UP_EVENT_LISTENERS = "Failed to set up event listeners: "
 
-        private const val EMPTY_JSON_OBJECT = "{}"
+        private val EMPTY_JSON_OBJECT = JsonObject(emptyMap())
 
         // Reverse-RPC method names (must match the JS bridgeRequest() method strings)
         private const val REQUEST_METHOD_SIGN_WITH_CUSTOM_SIGNER = "signWithCustomSigner"
@@ -491,6 +676,51 @@ internal class MessageDispatcher(
         private const val REQUEST_METHOD_KOTLIN_PROVIDER_DISCONNECT = "kotlinProviderDisconnect"
         private const val REQUEST_METHOD_KOTLIN_PROVIDER_RELEASE = "kotlinProviderRelease"
         private const val REQUEST_METHOD_CALL_BY_REFERENCE = "callByReference"
+        private const val REQUEST_METHOD_STORAGE_GET = "storageGet"
+        private const val REQUEST_METHOD_STORAGE_SET = "storageSet"
+        private const val REQUEST_METHOD_STORAGE_REMOVE = "storageRemove"
+        private const val REQUEST_METHOD_STORAGE_CLEAR = "storageClear"
+        private const val REQUEST_METHOD_STORAGE_GET_MANY = "storageGetMany"
+        private const val REQUEST_METHOD_STORAGE_SET_MANY = "storageSetMany"
+        private const val REQUEST_METHOD_STORAGE_REMOVE_MANY = "storageRemoveMany"
+        private const val STORAGE_LANE = "storage"
+        private const val REQUEST_METHOD_SESSION_CREATE = "sessionCreate"
+        private const val REQUEST_METHOD_SESSION_GET = "sessionGet"
+        private const val REQUEST_METHOD_SESSION_GET_FILTERED = "sessionGetFiltered"
+        private const val REQUEST_METHOD_SESSION_REMOVE = "sessionRemove"
+        private const val REQUEST_METHOD_SESSION_REMOVE_FILTERED = "sessionRemoveFiltered"
+        private const val REQUEST_METHOD_SESSION_CLEAR = "sessionClear"
+        private const val SESSION_LANE = "sessions"
+        private const val KEY_RETRY_AFTER_MS = "retryAfterMs"
+
+        /**
+         * Custom signers may prompt the user, so they run one at a time. Watch and callback bursts
+         * are capped below the default to leave room for everything else.
+         */
+        private val REVERSE_CONCURRENCY_LIMITS = mapOf(
+            REQUEST_METHOD_SIGN_WITH_CUSTOM_SIGNER to 1,
+            REQUEST_METHOD_KOTLIN_PROVIDER_WATCH to 4,
+            REQUEST_METHOD_CALL_BY_REFERENCE to 4,
+        )
+
+        private val STORAGE_METHODS = setOf(
+            REQUEST_METHOD_STORAGE_GET,
+            REQUEST_METHOD_STORAGE_SET,
+            REQUEST_METHOD_STORAGE_REMOVE,
+            REQUEST_METHOD_STORAGE_CLEAR,
+            REQUEST_METHOD_STORAGE_GET_MANY,
+            REQUEST_METHOD_STORAGE_SET_MANY,
+            REQUEST_METHOD_STORAGE_REMOVE_MANY,
+        )
+
+        private val SESSION_METHODS = setOf(
+            REQUEST_METHOD_SESSION_CREATE,
+            REQUEST_METHOD_SESSION_GET,
+            REQUEST_METHOD_SESSION_GET_FILTERED,
+            REQUEST_METHOD_SESSION_REMOVE,
+            REQUEST_METHOD_SESSION_REMOVE_FILTERED,
+            REQUEST_METHOD_SESSION_CLEAR,
+        )
     }
 }
 
@@ -0,0 +1,386 @@
+/*
+ * Copyright (c) 2025 TonTech
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+package io.ton.walletkit.engine.infrastructure
+
+import android.webkit.JavascriptInterface
+import io.ton.walletkit.api.generated.TONDAppInfo
+import io.ton.walletkit.api.generated.TONNetwork
+import io.ton.walletkit.api.generated.TONRawStackItem
+import io.ton.walletkit.api.isTestnet
+import io.ton.walletkit.bridge.optString
+import io.ton.walletkit.bridge.optStringOrNull
+import io.ton.walletkit.config.SignDataType
+import io.ton.walletkit.config.TONWalletKitConfiguration
+import io.ton.walletkit.internal.constants.JsonConstants
+import io.ton.walletkit.internal.constants.LogConstants
+import io.ton.walletkit.internal.util.Logger
+import io.ton.walletkit.model.TONBase64
+import io.ton.walletkit.model.TONUserFriendlyAddress
+import io.ton.walletkit.session.SessionFilter
+import kotlinx.coroutines.runBlocking
+import kotlinx.coroutines.withTimeout
+import kotlinx.serialization.encodeToString
+import kotlinx.serialization.json.Json
+import kotlinx.serialization.json.JsonArray
+import kotlinx.serialization.json.add
+import kotlinx.serialization.json.buildJsonArray
+import kotlinx.serialization.json.buildJsonObject
+import kotlinx.serialization.json.jsonObject
+import kotlinx.serialization.json.put
+
+/**
+ * The synchronous native surface the bundle sees as `window.WalletKitNative`: storage, wallet
+ * adapters, and the optional custom session manager and API clients.
+ *
+ * [WebViewManager] exposes it to the bundle. Calls arrive on a JS thread and block until [host]
+ * returns the engine's [WebViewManager.Host].
+ *
+ * @suppress Internal component. Use through [io.ton.walletkit.engine.WebViewWalletKitEngine].
+ */
+internal class NativeBridgeBinding(
+    private val json: Json,
+    private val host: () -> WebViewManager.Host,
+) {
+    /*
+     * Synchronous storage, kept for bundles that predate the storage reverse-RPC methods and for
+     * `window.WalletKitNativeStorage`. Each call blocks the JS thread until the adapter returns;
+     * the bundle's storage adapter uses the asynchronous `storageGet`/`storageSet`/`storageRemove`/
+     * `storageClear` requests instead.
+     */
+    @JavascriptInterface
+    fun storageGet(key: String): String? {
+        return runBlocking {
+            host().storageManager.get(key)
+        }
+    }
+
+    @JavascriptInterface
+    fun storageSet(
+        key: String,
+        value: String,
+    ) {
+        runBlocking {
+            host().storageManager.set(key, value)
+        }
+    }
+
+    @JavascriptInterface
+    fun storageRemove(key: String) {
+        runBlocking {
+            host().storageManager.remove(key)
+        }
+    }
+
+    @JavascriptInterface
+    fun storageClear() {
+        runBlocking {
+            host().storageManager.clear()
+        }
+    }
+
+    @JavascriptInterface
+    fun adapterCallSync(method: String, paramsJson: String): String = runBlocking {
+        withTimeout(1000) {
+            val params = json.parseToJsonElement(paramsJson).jsonObject
+            val adapterId = params.optString("adapterId")
+            val adapter = host().adapterManager.getAdapter(adapterId)
+                ?: throw IllegalArgumentException("Adapter not found: $adapterId")
+            when (method) {
+                "getPublicKey" -> adapter.publicKey().value
+                "getNetwork" -> buildJsonObject { put("chainId", adapter.network().chainId) }.toString()
+                "getAddress" -> adapter.address(adapter.network().isTestnet).value
+                "getWalletId" -> adapter.identifier()
+                "getSupportedFeatures" -> {
+                    val features = adapter.supportedFeatures()
+                        ?: return@withTimeout "null"
+                    featuresToJson(features).toString()
+                }
+                else -> throw IllegalArgumentException("Unknown sync adapter method: $method")
+            }
+        }
+    }
+
+    // ======== Session Manager Methods ========
+    // These methods are only available when a native session manager is configured.
+    // The JS bridge checks hasSessionManager to determine if native session manager is available.
+    // Session calls themselves go out as ordered reverse-RPC requests (see MessageDispatcher);
+    // the blocking methods below serve bundles that predate them.
+
+    @JavascriptInterface
+    fun hasSessionManager(): Boolean = host().sessionManager != null
+
+    @JavascriptInterface
+    fun sessionCreate(
+        sessionId: String,
+        dAppInfoJson: String,
+        walletId: String,
+        walletAddress: String,
+        isJsBridge: Boolean,
+    ): String {
+        val manager = host().sessionManager
+            ?: throw IllegalStateException("Session manager not configured")
+
+        return runBlocking {
+            try {
+                Logger.d(TAG, "sessionCreate: sessionId=$sessionId, dAppInfo=$dAppInfoJson")
+
+                val dAppInfoObj = json.parseToJsonElement(dAppInfoJson).jsonObject
+                val dAppInfo = TONDAppInfo(
+                    name = dAppInfoObj.optString("name", ""),
+                    url = dAppInfoObj.optStringOrNull("url"),
+                    iconUrl = dAppInfoObj.optStringOrNull("iconUrl"),
+                    description = dAppInfoObj.optStringOrNull("description"),
+                )
+
+                val session = manager.createSession(
+                    sessionId = sessionId,
+                    dAppInfo = dAppInfo,
+                    walletId = walletId,
+                    walletAddress = walletAddress,
+                    isJsBridge = isJsBridge,
+                )
+
+                json.encodeToString(session)
+            } catch (e: Exception) {
+                Logger.e(TAG, "Failed to create session: $sessionId", e)
+                throw e
+            }
+        }
+    }
+
+    @JavascriptInterface
+    fun sessionGet(sessionId: String): String? {
+        val manager = host().sessionManager
+            ?: throw IllegalStateException("Session manager not configured")
+
+        return runBlocking {
+            try {
+                Logger.d(TAG, "sessionGet: sessionId=$sessionId")
+                val session = manager.getSession(sessionId)
+                session?.let { json.encodeToString(it) }
+            } catch (e: Exception) {
+                Logger.e(TAG, "Failed to get session: $sessionId", e)
+                null
+            }
+        }
+    }
+
+    @JavascriptInterface
+    fun sessionGetFiltered(filterJson: String): String {
+        val manager = host().sessionManager
+            ?: throw IllegalStateException("Session manager not configured")
+
+        return runBlocking {
+            try {
+                val filter = parseSessionFilter(filterJson)
+                val sessions = manager.getSessions(filter)
+                json.encodeToString(sessions)
+            } catch (e: Exception) {
+                Logger.e(TAG, "Failed to get filtered sessions", e)
+                "[]"
+            }
+        }
+    }
+
+    @JavascriptInterface
+    fun sessionRemove(sessionId: String) {
+        val manager = host().sessionManager
+            ?: throw IllegalStateException("Session manager not configured")
+
+        runBlocking {
+            try {
+                manager.removeSession(sessionId)
+            } catch (e: Exception) {
+                Logger.e(TAG, "Failed to remove session: $sessionId", e)
+            }
+        }
+    }
+
+    @JavascriptInterface
+    fun sessionRemoveFiltered(filterJson: String) {
+        val manager = host().sessionManager
+            ?: throw IllegalStateException("Session manager not configured")
+
+        runBlocking {
+            try {
+                val filter = parseSessionFilter(filterJson)
+                manager.removeSessions(filter)
+            } catch (e: Exception) {
+                Logger.e(TAG, "Failed to remove filtered sessions", e)
+            }
+        }
+    }
+
+    @JavascriptInterface
+    fun sessionClear() {
+        val manager = host().sessionManager
+            ?: throw IllegalStateException("Session manager not configured")
+
+        runBlocking {
+            try {
+                Logger.d(TAG, "sessionClear")
+                manager.clearSessions()
+            } catch (e: Exception) {
+                Logger.e(TAG, "Failed to clear sessions", e)
+            }
+        }
+    }
+
+    // ======== API Client Methods ========
+    // These methods are only available when custom API clients are configured.
+    // The JS bridge checks for apiGetNetworks to determine if native API clients are available.
+
+    @JavascriptInterface
+    fun apiGetNetworks(): String {
+        if (host().apiClients.isEmpty()) {
+            return "[]"
+        }
+
+        val networks = host().apiClients.map { (network, _) ->
+            json.encodeToString(network)
+        }
+        return "[${ networks.joinToString(",") }]"
+    }
+
+    @JavascriptInterface
+    fun apiSendBoc(networkJson: String, boc: String): String {
+        val network = json.decodeFromString<TONNetwork>(networkJson)
+        val client = host().apiClients.find { it.first == network }?.second
+            ?: throw IllegalArgumentException("No API client configured for network: $network")
+
+        return runBlocking {
+            try {
+                Logger.d(TAG, "apiSendBoc: network=$network")
+                client.sendBoc(TONBase64(boc))
+            } catch (e: Exception) {
+                Logger.e(TAG, "Failed to send BOC: $network", e)
+                throw e
+            }
+        }
+    }
+
+    @JavascriptInterface
+    fun apiRunGetMethod(
+        networkJson: String,
+        address: String,
+        method: String,
+        stackJson: String?,
+        seqno: Int,
+    ): String {
+        val network = json.decodeFromString<TONNetwork>(networkJson)
+        val client = host().apiClients.find { it.first == network }?.second
+            ?: throw IllegalArgumentException("No API client configured for network: $network")
+
+        return runBlocking {
+            try {
+                Logger.d(TAG, "apiRunGetMethod: network=$network, address=$address, method=$method")
+                val stack = stackJson?.let { json.decodeFromString<List<TONRawStackItem>>(it) }
+                val seqnoArg = if (seqno == -1) null else seqno
+                val result = client.runGetMethod(TONUserFriendlyAddress(address), method, stack, seqnoArg)
+                json.encodeToString(result)
+            } catch (e: Exception) {
+                Logger.e(TAG, "Failed to run get method: $method on $address", e)
+                throw e
+            }
+        }
+    }
+
+    @JavascriptInterface
+    fun apiGetMasterchainInfo(networkJson: String): String {
+        val network = json.decodeFromString<TONNetwork>(networkJson)
+        val client = host().apiClients.find { it.first == network }?.second
+            ?: throw IllegalArgumentException("No API client configured for network: $network")
+
+        return runBlocking {
+            try {
+                Logger.d(TAG, "apiGetMasterchainInfo: network=$network")
+                val result = client.getMasterchainInfo()
+                json.encodeToString(result)
+            } catch (e: Exception) {
+                Logger.e(TAG, "Failed to get masterchain info", e)
+                throw e
+            }
+        }
+    }
+
+    private fun parseSessionFilter(filterJson: String): SessionFilter? {
+        return try {
+            val jsonObj = json.parseToJsonElement(filterJson).jsonObject
+            if (jsonObj.isEmpty()) {
+                null
+            } else {
+                SessionFilter(
+                    walletId = jsonObj.optStringOrNull("walletId"),
+                    domain = jsonObj.optStringOrNull("domain"),
+                    isJsBridge = (jsonObj["isJsBridge"] as? kotlinx.serialization.json.JsonPrimitive)?.let {
+                        it.content.toBooleanStrictOrNull()
+                    },
+                )
+            }
+        } catch (e: Exception) {
+            Logger.w(TAG, "Failed to parse session filter: $filterJson", e)
+            null
+        }
+    }
+
+    private fun featuresToJson(features: List<TONWalletKitConfiguration.Feature>): JsonArray =
+        buildJsonArray {
+            for (feature in features) {
+                when (feature) {
+                    is TONWalletKitConfiguration.SendTransactionFeature -> {
+                        add(
+                            buildJsonObject {
+                                put(JsonConstants.KEY_NAME, JsonConstants.FEATURE_SEND_TRANSACTION)
+                                feature.maxMessages?.let { put(JsonConstants.KEY_MAX_MESSAGES, it) }
+                                feature.extraCurrencySupported?.let { put("extraCurrencySupported", it) }
+                            },
+                        )
+                    }
+                    is TONWalletKitConfiguration.SignDataFeature -> {
+                        add(
+                            buildJsonObject {
+                                put(JsonConstants.KEY_NAME, JsonConstants.FEATURE_SIGN_DATA)
+                                put(
+                                    JsonConstants.KEY_TYPES,
+                                    buildJsonArray {
+                                        for (type in feature.types) {
+                                            add(
+                                                when (type) {
+                                                    SignDataType.TEXT -> JsonConstants.VALUE_SIGN_DATA_TEXT
+                                                    SignDataType.BINARY -> JsonConstants.VALUE_SIGN_DATA_BINARY
+                                                    SignDataType.CELL -> JsonConstants.VALUE_SIGN_DATA_CELL
+                                                },
+                                            )
+                                        }
+                                    },
+                                )
+                            },
+                        )
+                    }
+                }
+            }
+        }
+
+    private companion object {
+        private const val TAG = LogConstants.TAG_WEBVIEW_ENGINE
+    }
+}
@@ -0,0 +1,108 @@
+/*
+ * Copyright (c) 2025 TonTech
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+package io.ton.walletkit.engine.infrastructure
+
+import java.util.concurrent.ConcurrentHashMap
+import java.util.concurrent.atomic.AtomicInteger
+import java.util.concurrent.atomic.AtomicIntegerArray
+import java.util.concurrent.atomic.AtomicReferenceArray
+
+/**
+ * Pending forward calls keyed by compact integer ids.
+ *
+ * Ids come from a monotonic counter, and id `n` lives in slot `n & (capacity - 1)`, so routing a
+ * response is an array index rather than a string hash. When a slot is still held by a
+ * long-running call, the newer call spills into a small overflow map instead of waiting.
+ *
+ * @param capacity Slot count; rounded up to a power of two.
+ */
+internal class PendingCallTable<T : Any>(capacity: Int = DEFAULT_CAPACITY) {
+    private val size = Integer.highestOneBit((capacity - 1).coerceAtLeast(1)) shl 1
+    private val mask = size - 1
+    private val nextId = AtomicInteger()
+
+    // A slot is claimed by CAS on [values] and released by CAS on [ids], so a slot is reused
+    // only after its previous owner has been fully removed.
+    private val ids = AtomicIntegerArray(size)
+    private val values = AtomicReferenceArray<T?>(size)
+    private val overflow = ConcurrentHashMap<Int, T>()
+
+    /** Stores [value] and returns its id; ids are positive and never 0. */
+    fun register(value: T): Int {
+        val id = allocateId()
+        val slot = id and mask
+        if (values.compareAndSet(slot, null, value)) {
+            ids.set(slot, id)
+        } else {
+            overflow[id] = value
+        }
+        return id
+    }
+
+    fun remove(id: Int): T? {
+        val slot = id and mask
+        if (id != 0 && ids.compareAndSet(slot, id, 0)) {
+            return values.getAndSet(slot, null)
+        }
+        return overflow.remove(id)
+    }
+
+    fun get(id: Int): T? {
+        val slot = id and mask
+        if (id != 0 && ids.get(slot) == id) return values.get(slot)
+        return overflow[id]
+    }
+
+    fun contains(id: Int): Boolean =
+        id != 0 && ids.get(id and mask) == id || overflow.containsKey(id)
+
+    /** Visits every pending entry without removing it; entries may come and go meanwhile. */
+    fun forEach(action: (id: Int, value: T) -> Unit) {
+        for (slot in 0 until size) {
+            val id = ids.get(slot)
+            if (id == 0) continue
+            val value = values.get(slot) ?: continue
+            action(id, value)
+        }
+        overflow.forEach { (id, value) -> action(id, value) }
+    }
+
+    /** Removes every pending entry, handing each to [action]. */
+    fun drain(action: (T) -> Unit) {
+        for (slot in 0 until size) {
+            val id = ids.get(slot)
+            if (id != 0) remove(id)?.let(action)
+        }
+        overflow.keys.forEach { id -> remove(id)?.let(action) }
+    }
+
+    private fun allocateId(): Int {
+        while (true) {
+            val id = nextId.incrementAndGet() and Int.MAX_VALUE
+            if (id != 0) return id
+        }
+    }
+
+    companion object {
+        const val DEFAULT_CAPACITY = 256
+    }
+}
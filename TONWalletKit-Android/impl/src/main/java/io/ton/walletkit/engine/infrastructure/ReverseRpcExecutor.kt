@@ -0,0 +1,161 @@
+/*
+ * Copyright (c) 2025 TonTech
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+package io.ton.walletkit.engine.infrastructure
+
+import io.ton.walletkit.internal.constants.LogConstants
+import io.ton.walletkit.internal.util.Logger
+import kotlinx.coroutines.CoroutineDispatcher
+import kotlinx.coroutines.CoroutineScope
+import kotlinx.coroutines.Dispatchers
+import kotlinx.coroutines.SupervisorJob
+import kotlinx.coroutines.cancel
+import kotlinx.coroutines.channels.Channel
+import kotlinx.coroutines.isActive
+import kotlinx.coroutines.launch
+import kotlinx.coroutines.sync.Semaphore
+import kotlinx.coroutines.sync.withPermit
+import java.util.concurrent.ConcurrentHashMap
+import java.util.concurrent.atomic.AtomicInteger
+
+/**
+ * Runs JS → Kotlin requests in an engine-owned scope.
+ *
+ * Each method gets its own concurrency limit, so a burst of one kind of request (provider
+ * watches, wrapped callbacks) queues behind itself instead of starving the others. At most
+ * [maxPending] requests are admitted at once, running or queued; beyond that [submit] refuses
+ * and the caller tells JS to back off. [shutdown] cancels everything still running or queued.
+ *
+ * Requests whose effects depend on arrival order (storage writes followed by reads of the same
+ * key) go through [submitOrdered] instead, which runs each lane strictly one at a time.
+ *
+ * @param limits Per-method concurrency overrides; other methods get [defaultLimit].
+ */
+internal class ReverseRpcExecutor(
+    private val metrics: BridgeCallMetrics,
+    private val limits: Map<String, Int> = emptyMap(),
+    private val defaultLimit: Int = DEFAULT_LIMIT,
+    private val maxPending: Int = DEFAULT_MAX_PENDING,
+    dispatcher: CoroutineDispatcher = Dispatchers.IO,
+) {
+    private val scope = CoroutineScope(SupervisorJob() + dispatcher)
+    private val permits = ConcurrentHashMap<String, Semaphore>()
+    private val pending = AtomicInteger()
+    private val lanes = ConcurrentHashMap<String, Channel<suspend () -> Unit>>()
+
+    /** Requests admitted and not yet finished, running or queued. */
+    val pendingCount: Int
+        get() = pending.get()
+
+    /**
+     * Queues [block] under [method]'s limit. Returns false without running it when the executor
+     * is saturated or shut down.
+     */
+    fun submit(method: String, block: suspend () -> Unit): Boolean {
+        if (!scope.isActive) return false
+        if (pending.incrementAndGet() > maxPending) {
+            pending.decrementAndGet()
+            metrics.onReverseRejected()
+            return false
+        }
+        val semaphore = permits.computeIfAbsent(method) { Semaphore(limits[method] ?: defaultLimit) }
+        metrics.onReverseQueued()
+        scope.launch {
+            var started = false
+            try {
+                semaphore.withPermit {
+                    started = true
+                    metrics.onReverseStarted()
+                    block()
+                }
+            } finally {
+                metrics.onReverseEnded(started)
+                pending.decrementAndGet()
+            }
+        }
+        return true
+    }
+
+    /**
+     * Queues [block] behind every block submitted to [lane] before it, and runs them one at a
+     * time in submission order. Ordered requests are never refused: a busy retry would let later
+     * requests overtake them. Returns false only after [shutdown].
+     */
+    fun submitOrdered(lane: String, block: suspend () -> Unit): Boolean {
+        pending.incrementAndGet()
+        metrics.onReverseQueued()
+        // A lane whose consumer ended is dropped from [lanes]; the retry starts a fresh one.
+        repeat(2) {
+            if (!scope.isActive) return@repeat
+            val queue = lanes.computeIfAbsent(lane) { startLane(it) }
+            if (queue.trySend(block).isSuccess) return true
+            lanes.remove(lane, queue)
+        }
+        metrics.onReverseEnded(started = false)
+        pending.decrementAndGet()
+        return false
+    }
+
+    fun shutdown() {
+        scope.cancel()
+        lanes.values.forEach { it.close() }
+    }
+
+    private fun startLane(lane: String): Channel<suspend () -> Unit> {
+        val queue = Channel<suspend () -> Unit>(Channel.UNLIMITED) {
+            metrics.onReverseEnded(started = false)
+            pending.decrementAndGet()
+        }
+        val consumer = scope.launch {
+            for (block in queue) {
+                try {
+                    metrics.onReverseStarted()
+                    block()
+                } catch (e: Throwable) {
+                    // A block's own failure, including a CancellationException it raised or an
+                    // Error, must not end the lane: every later block would wait forever.
+                    if (!isActive) throw e
+                    Logger.e(TAG, "Ordered reverse-RPC block failed on lane $lane", e)
+                } finally {
+                    metrics.onReverseEnded(started = true)
+                    pending.decrementAndGet()
+                }
+            }
+        }
+        consumer.invokeOnCompletion {
+            lanes.remove(lane, queue)
+            queue.cancel()
+        }
+        return queue
+    }
+
+    companion object {
+        private const val TAG = LogConstants.TAG_WEBVIEW_ENGINE
+
+        const val DEFAULT_LIMIT = 8
+        const val DEFAULT_MAX_PENDING = 128
+
+        /** Delay JS waits before retrying a request refused with [BUSY_ERROR_CODE]. */
+        const val RETRY_AFTER_MILLIS = 50
+
+        const val BUSY_ERROR_CODE = "busy"
+    }
+}
@@ -0,0 +1,76 @@
+/*
+ * Copyright (c) 2025 TonTech
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+package io.ton.walletkit.engine.infrastructure
+
+import io.ton.walletkit.model.TONStartupTimings
+import java.util.concurrent.atomic.AtomicLongArray
+
+/** Milestones on the way from WebView creation to a usable engine, in the order they usually occur. */
+internal enum class StartupPhase {
+    WEBVIEW_CREATED,
+    PAGE_FINISHED,
+    PORT_READY,
+    CONFIG_BOUND,
+    JS_READY,
+    INIT_DONE,
+}
+
+/**
+ * Records when each [StartupPhase] was first reached, relative to the timeline's creation.
+ *
+ * Only the first [mark] of a phase counts, so a reload or re-initialization later on does not
+ * overwrite the cold-start numbers.
+ *
+ * @param prewarmed Whether the timeline started with [WebViewWalletKitEngine.prewarm].
+ */
+internal class StartupTimeline(
+    val prewarmed: Boolean = false,
+    private val clock: () -> Long = System::nanoTime,
+) {
+    private val origin = clock()
+    private val marks = AtomicLongArray(StartupPhase.entries.size).apply {
+        for (index in 0 until length()) set(index, UNSET)
+    }
+
+    fun mark(phase: StartupPhase) {
+        marks.compareAndSet(phase.ordinal, UNSET, clock() - origin)
+    }
+
+    /** Milliseconds from the timeline's start to [phase], or null if it has not happened yet. */
+    fun elapsedMillis(phase: StartupPhase): Long? =
+        marks.get(phase.ordinal).takeIf { it != UNSET }?.let { it / NANOS_PER_MILLI }
+
+    fun snapshot() = TONStartupTimings(
+        prewarmed = prewarmed,
+        webViewCreatedMillis = elapsedMillis(StartupPhase.WEBVIEW_CREATED),
+        pageFinishedMillis = elapsedMillis(StartupPhase.PAGE_FINISHED),
+        portReadyMillis = elapsedMillis(StartupPhase.PORT_READY),
+        configBoundMillis = elapsedMillis(StartupPhase.CONFIG_BOUND),
+        jsReadyMillis = elapsedMillis(StartupPhase.JS_READY),
+        initDoneMillis = elapsedMillis(StartupPhase.INIT_DONE),
+    )
+
+    private companion object {
+        private const val UNSET = -1L
+        private const val NANOS_PER_MILLI = 1_000_000L
+    }
+}
@@ -21,32 +21,107 @@
  */
 package io.ton.walletkit.engine.infrastructure
 
+import io.ton.walletkit.config.TONWalletKitConfiguration
 import io.ton.walletkit.internal.constants.LogConstants
 import io.ton.walletkit.internal.util.Logger
 import io.ton.walletkit.storage.BridgeStorageAdapter
+import kotlinx.coroutines.CoroutineDispatcher
+import kotlinx.coroutines.CoroutineScope
+import kotlinx.coroutines.Dispatchers
+import kotlinx.coroutines.Job
+import kotlinx.coroutines.NonCancellable
+import kotlinx.coroutines.SupervisorJob
+import kotlinx.coroutines.cancel
+import kotlinx.coroutines.delay
+import kotlinx.coroutines.launch
+import kotlinx.coroutines.sync.Mutex
+import kotlinx.coroutines.sync.withLock
+import kotlinx.coroutines.withContext
+import java.util.concurrent.CopyOnWriteArrayList
+import java.util.concurrent.atomic.AtomicLong
 
 /**
  * Mediates storage operations between the JS bridge and the Android storage adapter, gating
- * persistence on the runtime flag. All operations must be invoked from a coroutine context;
- * callers that need a blocking API (e.g., JavaScript interfaces) should wrap with `runBlocking`.
+ * persistence on the runtime flag. All operations must be invoked from a coroutine context.
+ * The bundle reaches them as ordered reverse-RPC requests through [MessageDispatcher]; only the
+ * legacy synchronous interface in [NativeBridgeBinding] wraps them in `runBlocking`.
+ *
+ * With [writeBehind] set, values are cached after the first read and writes are queued per key,
+ * so a key rewritten many times between flushes costs one adapter write. A queued write is
+ * visible to [get] immediately. See [TONWalletKitConfiguration.StorageWriteBehind] for when the
+ * queue is flushed; [close] flushes it one last time. Writes the adapter rejects are queued
+ * again and retried after [TONWalletKitConfiguration.StorageWriteBehind.maxFlushDelayMillis].
  *
  * @suppress Internal component. Use through [WebViewWalletKitEngine].
  */
 internal class StorageManager(
     private val storageAdapter: BridgeStorageAdapter,
+    private val writeBehind: TONWalletKitConfiguration.StorageWriteBehind? = null,
+    dispatcher: CoroutineDispatcher = Dispatchers.IO,
     private val isPersistentStorageEnabled: () -> Boolean,
 ) {
+    private val scope = CoroutineScope(SupervisorJob() + dispatcher)
+
+    // Guards [cache], [pending], [generation] and the flush timers; never held across adapter calls.
+    private val stateMutex = Mutex()
+
+    // Serializes adapter writes, so flushes and clears reach the adapter in order.
+    private val writeMutex = Mutex()
+
+    // A null value records a key known to be absent. Least recently used keys are evicted past
+    // [MAX_CACHED_KEYS]; [pending] is consulted first, so eviction never hides a queued write.
+    private val cache = object : LinkedHashMap<String, String?>(16, 0.75f, true) {
+        override fun removeEldestEntry(eldest: MutableMap.MutableEntry<String, String?>) = size > MAX_CACHED_KEYS
+    }
+
+    // Last queued write per key, in the order keys were first queued; null means remove.
+    private var pending = LinkedHashMap<String, String?>()
+
+    // Bumped by [clear]; a read that started before the bump does not populate [cache].
+    private var generation = 0L
+
+    // Flushes once writes pause, and at the latest a fixed time after the first pending write.
+    private var debounceFlush: Job? = null
+    private var deadlineFlush: Job? = null
+
+    // Run after every [clear], outside the locks, so they may call back into this manager.
+    private val clearListeners = CopyOnWriteArrayList<suspend () -> Unit>()
+
+    private val _adapterWrites = AtomicLong()
+    private val _coalescedWrites = AtomicLong()
+
+    /** Write and removal calls issued to the storage adapter; a multi-key call counts once. */
+    val adapterWrites: Long
+        get() = _adapterWrites.get()
+
+    /** Writes that were superseded by a later write to the same key before reaching the adapter. */
+    val coalescedWrites: Long
+        get() = _coalescedWrites.get()
+
     suspend fun get(key: String): String? {
         if (!isPersistentStorageEnabled()) {
             return null
         }
 
-        return try {
+        val readGeneration = if (writeBehind != null) {
+            stateMutex.withLock {
+                if (pending.containsKey(key)) return pending[key]
+                if (cache.containsKey(key)) return cache[key]
+                generation
+            }
+        } else {
+            0L
+        }
+
+        val value = try {
             storageAdapter.get(key)
         } catch (e: Exception) {
             Logger.e(TAG, LogConstants.MSG_STORAGE_GET_FAILED + key, e)
-            null
+            return null
         }
+
+        if (writeBehind == null) return value
+        return stateMutex.withLock { cacheReadLocked(key, value, readGeneration) }
     }
 
     suspend fun set(key: String, value: String) {
@@ -54,11 +129,12 @@ internal class StorageManager(
             return
         }
 
-        try {
-            storageAdapter.set(key, value)
-        } catch (e: Exception) {
-            Logger.e(TAG, LogConstants.MSG_STORAGE_SET_FAILED + key, e)
+        if (writeBehind != null) {
+            enqueue(mapOf(key to value), writeBehind)
+            return
         }
+
+        write(mapOf(key to value))
     }
 
     suspend fun remove(key: String) {
@@ -66,11 +142,83 @@ internal class StorageManager(
             return
         }
 
-        try {
-            storageAdapter.remove(key)
-        } catch (e: Exception) {
-            Logger.e(TAG, LogConstants.MSG_STORAGE_REMOVE_FAILED + key, e)
+        if (writeBehind != null) {
+            enqueue(mapOf(key to null), writeBehind)
+            return
         }
+
+        write(mapOf(key to null))
+    }
+
+    /** Values of the [keys] that exist, read from the adapter in one call for keys not cached. */
+    suspend fun getMany(keys: Collection<String>): Map<String, String> {
+        if (!isPersistentStorageEnabled()) {
+            return emptyMap()
+        }
+
+        // Values already known in memory; the rest are read from the adapter.
+        val known = HashMap<String, String?>()
+        val missing = ArrayList<String>()
+        var readGeneration = 0L
+        if (writeBehind != null) {
+            stateMutex.withLock {
+                readGeneration = generation
+                for (key in keys) {
+                    when {
+                        pending.containsKey(key) -> known[key] = pending[key]
+                        cache.containsKey(key) -> known[key] = cache[key]
+                        else -> missing += key
+                    }
+                }
+            }
+        } else {
+            missing += keys
+        }
+
+        val loaded = if (missing.isEmpty()) {
+            emptyMap()
+        } else {
+            try {
+                storageAdapter.getMany(missing)
+            } catch (e: Exception) {
+                Logger.e(TAG, LogConstants.MSG_STORAGE_GET_FAILED + missing, e)
+                return emptyMap()
+            }
+        }
+
+        if (writeBehind == null) return loaded
+        stateMutex.withLock {
+            for (key in missing) known[key] = cacheReadLocked(key, loaded[key], readGeneration)
+        }
+        return buildMap { for (key in keys) known[key]?.let { put(key, it) } }
+    }
+
+    /** Sets every entry of [values]; without write-behind they reach the adapter in one call. */
+    suspend fun setMany(values: Map<String, String>) {
+        if (!isPersistentStorageEnabled() || values.isEmpty()) {
+            return
+        }
+
+        if (writeBehind != null) {
+            enqueue(values, writeBehind)
+            return
+        }
+
+        write(values)
+    }
+
+    suspend fun removeMany(keys: Collection<String>) {
+        if (!isPersistentStorageEnabled() || keys.isEmpty()) {
+            return
+        }
+
+        val removals = keys.associateWith { null }
+        if (writeBehind != null) {
+            enqueue(removals, writeBehind)
+            return
+        }
+
+        write(removals)
     }
 
     suspend fun clear() {
@@ -78,14 +226,154 @@ internal class StorageManager(
             return
         }
 
-        try {
-            storageAdapter.clear()
-        } catch (e: Exception) {
-            Logger.e(TAG, LogConstants.MSG_STORAGE_CLEAR_FAILED, e)
+        writeMutex.withLock {
+            stateMutex.withLock {
+                pending.clear()
+                cache.clear()
+                generation++
+                cancelScheduledFlushesLocked()
+            }
+            try {
+                storageAdapter.clear()
+            } catch (e: Exception) {
+                Logger.e(TAG, LogConstants.MSG_STORAGE_CLEAR_FAILED, e)
+            }
         }
+        for (listener in clearListeners) listener()
+    }
+
+    /** Registers [listener] to run after each [clear], e.g. to drop state derived from storage. */
+    fun addClearListener(listener: suspend () -> Unit) {
+        clearListeners += listener
+    }
+
+    /**
+     * Writes every queued value to the adapter and returns once the adapter has answered. Entries
+     * it rejects are queued again, unless a newer value was queued for the key meanwhile, and
+     * retried by a scheduled flush.
+     */
+    suspend fun flush() {
+        writeMutex.withLock {
+            val batch = stateMutex.withLock {
+                if (pending.isEmpty()) return
+                cancelScheduledFlushesLocked()
+                pending.also { pending = LinkedHashMap() }
+            }
+            val failed = write(batch)
+            if (failed.isEmpty() || writeBehind == null) return
+            stateMutex.withLock {
+                // Ahead of newer keys, since the failed entries were queued first.
+                val requeued = LinkedHashMap<String, String?>()
+                for ((key, value) in failed) {
+                    if (!pending.containsKey(key)) requeued[key] = value
+                }
+                requeued.putAll(pending)
+                pending = requeued
+                if (deadlineFlush == null) deadlineFlush = flushAfter(writeBehind.maxFlushDelayMillis)
+            }
+        }
+    }
+
+    /** Starts a [flush] without waiting for it, e.g. when the app goes to the background. */
+    fun flushInBackground() {
+        scope.launch { flush() }
+    }
+
+    /** Flushes queued writes and stops scheduling new flushes; writes the adapter rejects are lost. */
+    suspend fun close() {
+        withContext(NonCancellable) { flush() }
+        scope.cancel()
+        val lost = stateMutex.withLock { pending.keys.toList() }
+        if (lost.isNotEmpty()) Logger.e(TAG, LogConstants.MSG_STORAGE_WRITES_LOST + lost)
+    }
+
+    private suspend fun enqueue(
+        entries: Map<String, String?>,
+        options: TONWalletKitConfiguration.StorageWriteBehind,
+    ) {
+        val flushNow = stateMutex.withLock {
+            if (pending.isEmpty()) deadlineFlush = flushAfter(options.maxFlushDelayMillis)
+            for ((key, value) in entries) {
+                cache[key] = value
+                if (pending.containsKey(key)) _coalescedWrites.incrementAndGet()
+                pending[key] = value
+            }
+            if (pending.size >= options.maxPendingKeys) {
+                true
+            } else {
+                debounceFlush?.cancel()
+                debounceFlush = flushAfter(options.flushDelayMillis)
+                false
+            }
+        }
+        if (flushNow) flush()
+    }
+
+    private fun flushAfter(millis: Long): Job = scope.launch {
+        delay(millis)
+        // Once due, a flush runs to completion even if a later write cancels this timer.
+        withContext(NonCancellable) { flush() }
+    }
+
+    /**
+     * Caches [value], just read from the adapter, unless a write landed while it was read (that
+     * write wins) or [clear] ran since [readGeneration] (storage no longer holds it).
+     */
+    private fun cacheReadLocked(key: String, value: String?, readGeneration: Long): String? =
+        when {
+            pending.containsKey(key) -> pending[key]
+            cache.containsKey(key) -> cache[key]
+            readGeneration != generation -> null
+            else -> value.also { cache[key] = it }
+        }
+
+    private fun cancelScheduledFlushesLocked() {
+        debounceFlush?.cancel()
+        deadlineFlush?.cancel()
+        debounceFlush = null
+        deadlineFlush = null
+    }
+
+    /**
+     * Writes [batch] (null values are removals) with one adapter call for the values and one
+     * for the removals, so an adapter with transactional [BridgeStorageAdapter.setMany] commits
+     * a whole flush at once. Returns the entries of the calls that failed.
+     */
+    private suspend fun write(batch: Map<String, String?>): Map<String, String?> {
+        val failed = LinkedHashMap<String, String?>()
+        val values = LinkedHashMap<String, String>()
+        val removals = ArrayList<String>()
+        for ((key, value) in batch) {
+            if (value == null) removals += key else values[key] = value
+        }
+
+        if (values.isNotEmpty()) {
+            _adapterWrites.incrementAndGet()
+            try {
+                val single = values.entries.singleOrNull()
+                if (single != null) storageAdapter.set(single.key, single.value) else storageAdapter.setMany(values)
+            } catch (e: Exception) {
+                Logger.e(TAG, LogConstants.MSG_STORAGE_SET_FAILED + values.keys, e)
+                failed.putAll(values)
+            }
+        }
+        if (removals.isNotEmpty()) {
+            _adapterWrites.incrementAndGet()
+            try {
+                val single = removals.singleOrNull()
+                if (single != null) storageAdapter.remove(single) else storageAdapter.removeMany(removals)
+            } catch (e: Exception) {
+                Logger.e(TAG, LogConstants.MSG_STORAGE_REMOVE_FAILED + removals, e)
+                for (key in removals) failed[key] = null
+            }
+        }
+        return failed
     }
 
     private companion object {
         private const val TAG = LogConstants.TAG_WEBVIEW_ENGINE
+
+        // Far above the bundle's own keys plus one per stored session.
+        private const val MAX_CACHED_KEYS = 512
     }
 }
@@ -24,10 +24,11 @@ package io.ton.walletkit.engine.infrastructure
 import android.content.Context
 import android.graphics.Bitmap
 import android.os.Handler
+import android.os.HandlerThread
 import android.os.Looper
+import android.os.Process
 import android.view.ViewGroup
 import android.webkit.ConsoleMessage
-import android.webkit.JavascriptInterface
 import android.webkit.WebChromeClient
 import android.webkit.WebResourceError
 import android.webkit.WebResourceRequest
@@ -37,76 +38,96 @@ import android.webkit.WebView
 import android.webkit.WebViewClient
 import androidx.webkit.WebViewAssetLoader
 import io.ton.walletkit.WalletKitBridgeException
-import io.ton.walletkit.api.generated.TONDAppInfo
 import io.ton.walletkit.api.generated.TONNetwork
-import io.ton.walletkit.api.generated.TONRawStackItem
-import io.ton.walletkit.api.isTestnet
+import io.ton.walletkit.bridge.BridgeEnvelope
 import io.ton.walletkit.bridge.BuildConfig
-import io.ton.walletkit.bridge.optString
-import io.ton.walletkit.bridge.optStringOrNull
 import io.ton.walletkit.bridge.transport.BridgeTransport
 import io.ton.walletkit.bridge.transport.WebMessagePortBridgeTransport
 import io.ton.walletkit.client.TONAPIClient
-import io.ton.walletkit.config.SignDataType
 import io.ton.walletkit.config.TONWalletKitConfiguration
 import io.ton.walletkit.engine.state.AdapterManager
-import io.ton.walletkit.internal.constants.JsonConstants
 import io.ton.walletkit.internal.constants.LogConstants
 import io.ton.walletkit.internal.constants.ResponseConstants
 import io.ton.walletkit.internal.constants.WebViewConstants
 import io.ton.walletkit.internal.util.Logger
-import io.ton.walletkit.model.TONBase64
-import io.ton.walletkit.model.TONUserFriendlyAddress
-import io.ton.walletkit.session.SessionFilter
 import io.ton.walletkit.session.TONConnectSessionManager
 import kotlinx.coroutines.CompletableDeferred
 import kotlinx.coroutines.runBlocking
-import kotlinx.coroutines.withTimeout
-import kotlinx.serialization.SerializationException
-import kotlinx.serialization.encodeToString
 import kotlinx.serialization.json.Json
-import kotlinx.serialization.json.JsonArray
-import kotlinx.serialization.json.JsonObject
-import kotlinx.serialization.json.add
-import kotlinx.serialization.json.buildJsonArray
-import kotlinx.serialization.json.buildJsonObject
-import kotlinx.serialization.json.jsonObject
-import kotlinx.serialization.json.put
 
 /**
  * Owns the WebView lifecycle, asset loading, and JavaScript bridge integration.
  *
+ * The WebView and bundle load start as soon as the manager is created, while the engine that
+ * serves it is attached later through [bind]. Until then inbound messages are held on the bridge
+ * thread and JS calls into native storage or clients wait for the [Host]. This is what lets
+ * [WebViewWalletKitEngine.prewarm] start before any configuration exists.
+ *
+ * @param deferCreation Post WebView creation to the main looper even when already on it, so a
+ *   caller such as `Application.onCreate` is not held up.
  * @suppress Internal component. Use through [WebViewWalletKitEngine].
  */
 internal class WebViewManager(
     context: Context,
-    private val assetPath: String,
-    private val storageManager: StorageManager,
-    private val sessionManager: TONConnectSessionManager?,
-    private val apiClients: List<Pair<TONNetwork, TONAPIClient>>,
-    private val adapterManager: AdapterManager,
+    val assetPath: String,
     private val json: Json,
-    private val onMessage: (JsonObject) -> Unit,
-    private val onBridgeError: (WalletKitBridgeException, String?) -> Unit,
+    val engineOptions: TONWalletKitConfiguration.EngineOptions = TONWalletKitConfiguration.EngineOptions(),
+    val startupTimeline: StartupTimeline = StartupTimeline(),
+    deferCreation: Boolean = false,
 ) {
+    /**
+     * Engine-side collaborators; everything here depends on the configuration. [onContextLost]
+     * runs when the page is reloaded, with the envelopes that never reached the old one.
+     */
+    class Host(
+        val storageManager: StorageManager,
+        val sessionManager: TONConnectSessionManager?,
+        val apiClients: List<Pair<TONNetwork, TONAPIClient>>,
+        val adapterManager: AdapterManager,
+        val onMessage: (BridgeEnvelope) -> Unit,
+        val onBridgeError: (WalletKitBridgeException, String?) -> Unit,
+        val onBinaryMessage: (ByteArray) -> Unit = {},
+        val onContextLost: (undelivered: List<String>) -> Unit = {},
+    )
+
     private val appContext = context.applicationContext
     private val assetLoader =
         WebViewAssetLoader
             .Builder()
             .setDomain(WebViewConstants.ASSET_LOADER_DOMAIN)
-            .addPathHandler(WebViewConstants.ASSET_LOADER_PATH, WebViewAssetLoader.AssetsPathHandler(appContext))
+            .addPathHandler(
+                WebViewConstants.ASSET_LOADER_PATH,
+                BundleAssetHandler(appContext.assets, assetPath.trimStart('/'), WebViewAssetLoader.AssetsPathHandler(appContext)),
+            )
             .build()
     private val mainHandler = Handler(Looper.getMainLooper())
+
+    /**
+     * Inbound port messages are decoded and routed here, off the UI thread. Components that
+     * touch views or user callbacks post back to [mainHandler] themselves.
+     */
+    private val bridgeThread = HandlerThread(WebViewConstants.BRIDGE_IO_THREAD_NAME, Process.THREAD_PRIORITY_FOREGROUND).apply { start() }
+    private val bridgeHandler = Handler(bridgeThread.looper)
     private lateinit var webView: WebView
 
+    private val hostDeferred = CompletableDeferred<Host>()
+
+    // Confined to the bridge thread: set by [bind], read when inbound messages are routed.
+    private var boundHost: Host? = null
+    private val earlyInbound = ArrayDeque<(Host) -> Unit>()
+
     val webViewInitialized = CompletableDeferred<Unit>()
 
     private lateinit var transportImpl: WebMessagePortBridgeTransport
     val transport: BridgeTransport
         get() = transportImpl
 
+    /** Outbound messages not yet posted to the port; 0 before the WebView is set up. */
+    val outboundQueueDepth: Int
+        get() = if (::transportImpl.isInitialized) transportImpl.outboundQueueDepth else 0
+
     init {
-        if (Looper.myLooper() == Looper.getMainLooper()) {
+        if (!deferCreation && Looper.myLooper() == Looper.getMainLooper()) {
             initializeWebView()
         } else {
             mainHandler.post { initializeWebView() }
@@ -115,6 +136,38 @@ internal class WebViewManager(
 
     fun getMainHandler(): Handler = mainHandler
 
+    /**
+     * Attaches the engine. Messages that arrived before this are delivered first, in order.
+     * Must be called exactly once.
+     */
+    fun bind(host: Host) {
+        bridgeHandler.post {
+            boundHost = host
+            hostDeferred.complete(host)
+            startupTimeline.mark(StartupPhase.CONFIG_BOUND)
+            while (earlyInbound.isNotEmpty()) {
+                earlyInbound.removeFirst()(host)
+            }
+        }
+    }
+
+    /** Runs [action] on the bridge thread once a host is bound. */
+    private fun withHost(action: (Host) -> Unit) {
+        if (Looper.myLooper() != bridgeThread.looper) {
+            bridgeHandler.post { withHost(action) }
+            return
+        }
+        val host = boundHost
+        if (host != null) action(host) else earlyInbound.addLast(action)
+    }
+
+    private fun reportError(exception: WalletKitBridgeException, raw: String?) {
+        withHost { it.onBridgeError(exception, raw) }
+    }
+
+    /** For JS binding threads, which may block until the engine is attached. */
+    private fun host(): Host = runBlocking { hostDeferred.await() }
+
     fun attachTo(parent: ViewGroup) {
         if (::webView.isInitialized && webView.parent !== parent) {
             (webView.parent as? ViewGroup)?.removeView(webView)
@@ -125,6 +178,7 @@ internal class WebViewManager(
     fun asView(): WebView = webView
 
     fun destroy() {
+        bridgeThread.quitSafely()
         if (!::webView.isInitialized) return
         if (::transportImpl.isInitialized) transportImpl.close()
         (webView.parent as? ViewGroup)?.removeView(webView)
@@ -137,28 +191,35 @@ internal class WebViewManager(
         try {
             Logger.d(TAG, "Initializing WebView on thread: ${Thread.currentThread().name}")
             webView = WebView(appContext)
+            startupTimeline.mark(StartupPhase.WEBVIEW_CREATED)
             WebView.setWebContentsDebuggingEnabled(BuildConfig.LOG_LEVEL != "OFF")
             webView.settings.javaScriptEnabled = true
             webView.settings.domStorageEnabled = true
-            webView.settings.cacheMode = WebSettings.LOAD_NO_CACHE
+            // The bundle is served under a content-hashed URL, so caching it (and V8's code cache) is safe.
+            webView.settings.cacheMode = WebSettings.LOAD_DEFAULT
             webView.settings.allowFileAccess = true
             webView.settings.mixedContentMode = WebSettings.MIXED_CONTENT_ALWAYS_ALLOW
-            webView.addJavascriptInterface(JsBinding(), WebViewConstants.JS_INTERFACE_NAME)
+            webView.addJavascriptInterface(NativeBridgeBinding(json, ::host), WebViewConstants.JS_INTERFACE_NAME)
 
             transportImpl = WebMessagePortBridgeTransport(
                 webView = webView,
                 mainHandler = mainHandler,
-                callbackHandler = mainHandler,
+                callbackHandler = bridgeHandler,
+                batching = engineOptions.batching,
             )
+            transportImpl.setOnBinaryMessage { message -> withHost { it.onBinaryMessage(message) } }
             transportImpl.setOnMessage { jsonString ->
-                try {
-                    onMessage(json.parseToJsonElement(jsonString).jsonObject)
-                } catch (err: SerializationException) {
-                    Logger.e(TAG, "SerializationException: " + LogConstants.MSG_MALFORMED_PAYLOAD, err)
-                    onBridgeError(
-                        WalletKitBridgeException(LogConstants.ERROR_MALFORMED_PAYLOAD_PREFIX + err.message),
-                        jsonString,
-                    )
+                withHost { host ->
+                    try {
+                        host.onMessage(BridgeEnvelope.parse(jsonString))
+                    } catch (err: IllegalArgumentException) {
+                        // Also covers SerializationException from values parsed on demand.
+                        Logger.e(TAG, LogConstants.MSG_MALFORMED_PAYLOAD, err)
+                        host.onBridgeError(
+                            WalletKitBridgeException(LogConstants.ERROR_MALFORMED_PAYLOAD_PREFIX + err.message),
+                            jsonString,
+                        )
+                    }
                 }
             }
 
@@ -188,33 +249,47 @@ internal class WebViewManager(
                                     WebViewConstants.ERROR_BUNDLE_LOAD_FAILED + MSG_OPEN_PAREN + description + MSG_CLOSE_PAREN_PERIOD_SPACE + WebViewConstants.BUILD_INSTRUCTION,
                                 )
                             failBridgeFutures(exception)
-                            onBridgeError(exception, null)
+                            reportError(exception, null)
                         }
                     }
 
                     override fun onPageStarted(view: WebView?, url: String?, favicon: Bitmap?) {
                         super.onPageStarted(view, url, favicon)
                         Logger.d(TAG, "WebView page started loading: $url")
+                        if (transportImpl.isReady) {
+                            // The page reloaded and took the JS context with it. Recovery starts now so
+                            // no call slips into the new context before its init; the re-handshake
+                            // happens in onPageFinished and releases whatever recovery queued.
+                            Logger.w(TAG, "WebView reloaded with an open bridge port, detaching it")
+                            val undelivered = transportImpl.detachPort()
+                            withHost { it.onContextLost(undelivered) }
+                        }
                     }
 
                     override fun onPageFinished(view: WebView?, url: String?) {
                         super.onPageFinished(view, url)
                         Logger.d(TAG, "WebView page finished loading: $url")
+                        startupTimeline.mark(StartupPhase.PAGE_FINISHED)
 
                         val logLevel = BuildConfig.LOG_LEVEL
                         view?.evaluateJavascript("window.__WALLETKIT_LOG_LEVEL__ = '$logLevel';") {
                             Logger.d(TAG, "Log level set: __WALLETKIT_LOG_LEVEL__ = $logLevel")
                         }
+                        engineOptions.batching?.let { batching ->
+                            // Must land before the port handshake so JS picks it up when the port opens.
+                            view?.evaluateJavascript("window.__WALLETKIT_BRIDGE_BATCH_BYTES__ = ${batching.maxBatchBytes};", null)
+                        }
 
                         try {
                             transportImpl.handOffPortToJs()
+                            startupTimeline.mark(StartupPhase.PORT_READY)
                         } catch (err: Throwable) {
                             Logger.e(TAG, "Failed to hand off bridge port to JS", err)
                             val exception = WalletKitBridgeException(
                                 "Failed to hand off bridge port: ${err.message}",
                             )
                             transportImpl.fail(exception)
-                            onBridgeError(exception, null)
+                            reportError(exception, null)
                         }
                     }
 
@@ -238,7 +313,7 @@ internal class WebViewManager(
             Logger.e(TAG, MSG_FAILED_INITIALIZE_WEBVIEW, e)
             webViewInitialized.completeExceptionally(e)
             if (::transportImpl.isInitialized) transportImpl.fail(e)
-            onBridgeError(
+            reportError(
                 WalletKitBridgeException(
                     WebViewConstants.ERROR_BUNDLE_LOAD_FAILED + MSG_OPEN_PAREN + (e.message ?: ResponseConstants.VALUE_UNKNOWN) + MSG_CLOSE_PAREN_PERIOD_SPACE + WebViewConstants.BUILD_INSTRUCTION,
                 ),
@@ -251,320 +326,6 @@ internal class WebViewManager(
         if (::transportImpl.isInitialized) transportImpl.fail(exception)
     }
 
-    private inner class JsBinding {
-        @JavascriptInterface
-        fun storageGet(key: String): String? {
-            return runBlocking {
-                storageManager.get(key)
-            }
-        }
-
-        @JavascriptInterface
-        fun storageSet(
-            key: String,
-            value: String,
-        ) {
-            runBlocking {
-                storageManager.set(key, value)
-            }
-        }
-
-        @JavascriptInterface
-        fun storageRemove(key: String) {
-            runBlocking {
-                storageManager.remove(key)
-            }
-        }
-
-        @JavascriptInterface
-        fun storageClear() {
-            runBlocking {
-                storageManager.clear()
-            }
-        }
-
-        @JavascriptInterface
-        fun adapterCallSync(method: String, paramsJson: String): String = runBlocking {
-            withTimeout(1000) {
-                val params = json.parseToJsonElement(paramsJson).jsonObject
-                val adapterId = params.optString("adapterId")
-                val adapter = adapterManager.getAdapter(adapterId)
-                    ?: throw IllegalArgumentException("Adapter not found: $adapterId")
-                when (method) {
-                    "getPublicKey" -> adapter.publicKey().value
-                    "getNetwork" -> buildJsonObject { put("chainId", adapter.network().chainId) }.toString()
-                    "getAddress" -> adapter.address(adapter.network().isTestnet).value
-                    "getWalletId" -> adapter.identifier()
-                    "getSupportedFeatures" -> {
-                        val features = adapter.supportedFeatures()
-                            ?: return@withTimeout "null"
-                        featuresToJson(features).toString()
-                    }
-                    else -> throw IllegalArgumentException("Unknown sync adapter method: $method")
-                }
-            }
-        }
-
-        // ======== Session Manager Methods ========
-        // These methods are only available when a custom session manager is configured.
-        // The JS bridge checks hasSessionManager to determine if native session manager is available.
-
-        @JavascriptInterface
-        fun hasSessionManager(): Boolean = sessionManager != null
-
-        @JavascriptInterface
-        fun sessionCreate(
-            sessionId: String,
-            dAppInfoJson: String,
-            walletId: String,
-            walletAddress: String,
-            isJsBridge: Boolean,
-        ): String {
-            val manager = sessionManager
-                ?: throw IllegalStateException("Session manager not configured")
-
-            return runBlocking {
-                try {
-                    Logger.d(TAG, "sessionCreate: sessionId=$sessionId, dAppInfo=$dAppInfoJson")
-
-                    val dAppInfoObj = json.parseToJsonElement(dAppInfoJson).jsonObject
-                    val dAppInfo = TONDAppInfo(
-                        name = dAppInfoObj.optString("name", ""),
-                        url = dAppInfoObj.optStringOrNull("url"),
-                        iconUrl = dAppInfoObj.optStringOrNull("iconUrl"),
-                        description = dAppInfoObj.optStringOrNull("description"),
-                    )
-
-                    val session = manager.createSession(
-                        sessionId = sessionId,
-                        dAppInfo = dAppInfo,
-                        walletId = walletId,
-                        walletAddress = walletAddress,
-                        isJsBridge = isJsBridge,
-                    )
-
-                    json.encodeToString(session)
-                } catch (e: Exception) {
-                    Logger.e(TAG, "Failed to create session: $sessionId", e)
-                    throw e
-                }
-            }
-        }
-
-        @JavascriptInterface
-        fun sessionGet(sessionId: String): String? {
-            val manager = sessionManager
-                ?: throw IllegalStateException("Session manager not configured")
-
-            return runBlocking {
-                try {
-                    Logger.d(TAG, "sessionGet: sessionId=$sessionId")
-                    val session = manager.getSession(sessionId)
-                    session?.let { json.encodeToString(it) }
-                } catch (e: Exception) {
-                    Logger.e(TAG, "Failed to get session: $sessionId", e)
-                    null
-                }
-            }
-        }
-
-        @JavascriptInterface
-        fun sessionGetFiltered(filterJson: String): String {
-            val manager = sessionManager
-                ?: throw IllegalStateException("Session manager not configured")
-
-            return runBlocking {
-                try {
-                    val filter = parseSessionFilter(filterJson)
-                    val sessions = manager.getSessions(filter)
-                    json.encodeToString(sessions)
-                } catch (e: Exception) {
-                    Logger.e(TAG, "Failed to get filtered sessions", e)
-                    "[]"
-                }
-            }
-        }
-
-        @JavascriptInterface
-        fun sessionRemove(sessionId: String) {
-            val manager = sessionManager
-                ?: throw IllegalStateException("Session manager not configured")
-
-            runBlocking {
-                try {
-                    manager.removeSession(sessionId)
-                } catch (e: Exception) {
-                    Logger.e(TAG, "Failed to remove session: $sessionId", e)
-                }
-            }
-        }
-
-        @JavascriptInterface
-        fun sessionRemoveFiltered(filterJson: String) {
-            val manager = sessionManager
-                ?: throw IllegalStateException("Session manager not configured")
-
-            runBlocking {
-                try {
-                    val filter = parseSessionFilter(filterJson)
-                    manager.removeSessions(filter)
-                } catch (e: Exception) {
-                    Logger.e(TAG, "Failed to remove filtered sessions", e)
-                }
-            }
-        }
-
-        @JavascriptInterface
-        fun sessionClear() {
-            val manager = sessionManager
-                ?: throw IllegalStateException("Session manager not configured")
-
-            runBlocking {
-                try {
-                    Logger.d(TAG, "sessionClear")
-                    manager.clearSessions()
-                } catch (e: Exception) {
-                    Logger.e(TAG, "Failed to clear sessions", e)
-                }
-            }
-        }
-
-        // ======== API Client Methods ========
-        // These methods are only available when custom API clients are configured.
-        // The JS bridge checks for apiGetNetworks to determine if native API clients are available.
-
-        @JavascriptInterface
-        fun apiGetNetworks(): String {
-            if (apiClients.isEmpty()) {
-                return "[]"
-            }
-
-            val networks = apiClients.map { (network, _) ->
-                json.encodeToString(network)
-            }
-            return "[${ networks.joinToString(",") }]"
-        }
-
-        @JavascriptInterface
-        fun apiSendBoc(networkJson: String, boc: String): String {
-            val network = json.decodeFromString<TONNetwork>(networkJson)
-            val client = apiClients.find { it.first == network }?.second
-                ?: throw IllegalArgumentException("No API client configured for network: $network")
-
-            return runBlocking {
-                try {
-                    Logger.d(TAG, "apiSendBoc: network=$network")
-                    client.sendBoc(TONBase64(boc))
-                } catch (e: Exception) {
-                    Logger.e(TAG, "Failed to send BOC: $network", e)
-                    throw e
-                }
-            }
-        }
-
-        @JavascriptInterface
-        fun apiRunGetMethod(
-            networkJson: String,
-            address: String,
-            method: String,
-            stackJson: String?,
-            seqno: Int,
-        ): String {
-            val network = json.decodeFromString<TONNetwork>(networkJson)
-            val client = apiClients.find { it.first == network }?.second
-                ?: throw IllegalArgumentException("No API client configured for network: $network")
-
-            return runBlocking {
-                try {
-                    Logger.d(TAG, "apiRunGetMethod: network=$network, address=$address, method=$method")
-                    val stack = stackJson?.let { json.decodeFromString<List<TONRawStackItem>>(it) }
-                    val seqnoArg = if (seqno == -1) null else seqno
-                    val result = client.runGetMethod(TONUserFriendlyAddress(address), method, stack, seqnoArg)
-                    json.encodeToString(result)
-                } catch (e: Exception) {
-                    Logger.e(TAG, "Failed to run get method: $method on $address", e)
-                    throw e
-                }
-            }
-        }
-
-        @JavascriptInterface
-        fun apiGetMasterchainInfo(networkJson: String): String {
-            val network = json.decodeFromString<TONNetwork>(networkJson)
-            val client = apiClients.find { it.first == network }?.second
-                ?: throw IllegalArgumentException("No API client configured for network: $network")
-
-            return runBlocking {
-                try {
-                    Logger.d(TAG, "apiGetMasterchainInfo: network=$network")
-                    val result = client.getMasterchainInfo()
-                    json.encodeToString(result)
-                } catch (e: Exception) {
-                    Logger.e(TAG, "Failed to get masterchain info", e)
-                    throw e
-                }
-            }
-        }
-
-        private fun parseSessionFilter(filterJson: String): SessionFilter? {
-            return try {
-                val jsonObj = json.parseToJsonElement(filterJson).jsonObject
-                if (jsonObj.isEmpty()) {
-                    null
-                } else {
-                    SessionFilter(
-                        walletId = jsonObj.optStringOrNull("walletId"),
-                        domain = jsonObj.optStringOrNull("domain"),
-                        isJsBridge = (jsonObj["isJsBridge"] as? kotlinx.serialization.json.JsonPrimitive)?.let {
-                            it.content.toBooleanStrictOrNull()
-                        },
-                    )
-                }
-            } catch (e: Exception) {
-                Logger.w(TAG, "Failed to parse session filter: $filterJson", e)
-                null
-            }
-        }
-
-        private fun featuresToJson(features: List<TONWalletKitConfiguration.Feature>): JsonArray =
-            buildJsonArray {
-                for (feature in features) {
-                    when (feature) {
-                        is TONWalletKitConfiguration.SendTransactionFeature -> {
-                            add(
-                                buildJsonObject {
-                                    put(JsonConstants.KEY_NAME, JsonConstants.FEATURE_SEND_TRANSACTION)
-                                    feature.maxMessages?.let { put(JsonConstants.KEY_MAX_MESSAGES, it) }
-                                    feature.extraCurrencySupported?.let { put("extraCurrencySupported", it) }
-                                },
-                            )
-                        }
-                        is TONWalletKitConfiguration.SignDataFeature -> {
-                            add(
-                                buildJsonObject {
-                                    put(JsonConstants.KEY_NAME, JsonConstants.FEATURE_SIGN_DATA)
-                                    put(
-                                        JsonConstants.KEY_TYPES,
-                                        buildJsonArray {
-                                            for (type in feature.types) {
-                                                add(
-                                                    when (type) {
-                                                        SignDataType.TEXT -> JsonConstants.VALUE_SIGN_DATA_TEXT
-                                                        SignDataType.BINARY -> JsonConstants.VALUE_SIGN_DATA_BINARY
-                                                        SignDataType.CELL -> JsonConstants.VALUE_SIGN_DATA_CELL
-                                                    },
-                                                )
-                                            }
-                                        },
-                                    )
-                                },
-                            )
-                        }
-                    }
-                }
-            }
-    }
-
     private companion object {
         private const val TAG = LogConstants.TAG_WEBVIEW_ENGINE
         private const val MSG_FAILED_INITIALIZE_WEBVIEW = "Failed to initialize WebView"
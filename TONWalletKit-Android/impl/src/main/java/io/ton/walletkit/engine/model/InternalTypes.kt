@@ -21,6 +21,8 @@
  */
 package io.ton.walletkit.engine.model
 
+import io.ton.walletkit.WalletKitBridgeException
+import io.ton.walletkit.api.generated.TONNetwork
 import io.ton.walletkit.model.TONUserFriendlyAddress
 import kotlinx.serialization.Serializable
 
@@ -30,9 +32,13 @@ import kotlinx.serialization.Serializable
  *
  * Only contains fields that come from JS:
  * - walletId: from getWalletId() method result included in wrapper
- * - address: from getWalletAddress() RPC call
+ * - address: derived natively for built-in contracts, otherwise from getWalletAddress() RPC call
  * - publicKey: serialized property on wallet object
  * - version: serialized property on wallet object (e.g., "v5r1", "v4r2")
+ * - workchain, subwalletId: contract parameters of built-in adapters; null for custom adapters
+ *
+ * [network] is native bookkeeping: the network the wallet was added for, null when it was not
+ * added through this engine.
  */
 @Serializable
 data class WalletAccount(
@@ -40,4 +46,20 @@ data class WalletAccount(
     val address: TONUserFriendlyAddress,
     val publicKey: String? = null,
     val version: String? = null,
+    val workchain: Int? = null,
+    val subwalletId: Long? = null,
+    val network: TONNetwork? = null,
 )
+
+/**
+ * Outcome of one wallet in [io.ton.walletkit.engine.WalletKitEngine.addWallets].
+ *
+ * @property index Position of the wallet in the submitted batch
+ */
+sealed class WalletImportResult {
+    abstract val index: Int
+
+    data class Added(override val index: Int, val account: WalletAccount) : WalletImportResult()
+
+    data class Failed(override val index: Int, val error: WalletKitBridgeException) : WalletImportResult()
+}
@@ -22,8 +22,10 @@
 package io.ton.walletkit.engine.operations
 
 import io.ton.walletkit.WalletKitBridgeException
+import io.ton.walletkit.bridge.transport.BinaryRef
 import io.ton.walletkit.engine.infrastructure.BridgeRpcClient
 import io.ton.walletkit.engine.infrastructure.callTyped
+import io.ton.walletkit.engine.operations.requests.BinarySignRequest
 import io.ton.walletkit.engine.operations.requests.CreateMnemonicRequest
 import io.ton.walletkit.engine.operations.requests.MnemonicToKeyPairRequest
 import io.ton.walletkit.engine.operations.requests.SignRequest
@@ -44,6 +46,15 @@ internal suspend fun BridgeRpcClient.mnemonicToKeyPair(words: List<String>, mnem
 }
 
 internal suspend fun BridgeRpcClient.sign(data: ByteArray, secretKey: ByteArray): ByteArray {
+    if (supportsBinary) {
+        val result = sendWithAttachments(
+            BridgeMethodConstants.METHOD_SIGN,
+            BinarySignRequest(data = BinaryRef(0), secretKey = BinaryRef(1)),
+            listOf(data, secretKey),
+        )
+        return result.bytesOrNull()
+            ?: throw WalletKitBridgeException("Signature missing from sign result")
+    }
     val signatureHex: String = callTyped(
         BridgeMethodConstants.METHOD_SIGN,
         SignRequest(
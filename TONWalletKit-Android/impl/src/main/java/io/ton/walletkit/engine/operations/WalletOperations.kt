@@ -28,13 +28,16 @@ import io.ton.walletkit.engine.infrastructure.BridgeRpcClient
 import io.ton.walletkit.engine.infrastructure.callTyped
 import io.ton.walletkit.engine.infrastructure.callTypedOrNull
 import io.ton.walletkit.engine.operations.requests.AdapterIdRequest
+import io.ton.walletkit.engine.operations.requests.AddWalletsRequest
 import io.ton.walletkit.engine.operations.requests.CreateAdapterRequest
 import io.ton.walletkit.engine.operations.requests.CreateSignerFromCustomRequest
 import io.ton.walletkit.engine.operations.requests.CreateSignerFromMnemonicRequest
 import io.ton.walletkit.engine.operations.requests.CreateSignerFromSecretKeyRequest
 import io.ton.walletkit.engine.operations.requests.WalletIdRequest
+import io.ton.walletkit.engine.operations.requests.WalletImportEntry
 import io.ton.walletkit.engine.operations.responses.AdapterInfoResponse
 import io.ton.walletkit.engine.operations.responses.AddWalletResponse
+import io.ton.walletkit.engine.operations.responses.AddWalletsEntryResponse
 import io.ton.walletkit.engine.operations.responses.SignerInfoResponse
 import io.ton.walletkit.internal.constants.BridgeMethodConstants
 
@@ -87,6 +90,9 @@ internal suspend fun BridgeRpcClient.createWalletAdapter(
 internal suspend fun BridgeRpcClient.addWallet(adapterId: String): AddWalletResponse =
     callTyped(BridgeMethodConstants.METHOD_ADD_WALLET, AdapterIdRequest(adapterId = adapterId))
 
+internal suspend fun BridgeRpcClient.addWallets(entries: List<WalletImportEntry>): List<AddWalletsEntryResponse> =
+    callTyped(BridgeMethodConstants.METHOD_ADD_WALLETS, AddWalletsRequest(wallets = entries))
+
 internal suspend fun BridgeRpcClient.getWallets(): List<AddWalletResponse> =
     callTyped(BridgeMethodConstants.METHOD_GET_WALLETS)
 
@@ -21,6 +21,7 @@
  */
 package io.ton.walletkit.engine.operations.requests
 
+import io.ton.walletkit.bridge.transport.BinaryRef
 import kotlinx.serialization.Serializable
 
 /**
@@ -47,3 +48,10 @@ internal data class SignRequest(
     val data: List<Int>,
     val secretKey: List<Int>,
 )
+
+/** [SignRequest] over the binary lane: both byte arrays travel as ArrayBuffer attachments. */
+@Serializable
+internal data class BinarySignRequest(
+    val data: BinaryRef,
+    val secretKey: BinaryRef,
+)
@@ -72,3 +72,24 @@ internal data class CreateAdapterRequest(
 internal data class AdapterIdRequest(
     val adapterId: String,
 )
+
+/**
+ * One wallet in an [AddWalletsRequest]. Carries either the 32-byte [secretKey] seed, when the key
+ * was derived natively, or the [mnemonic] for JS to derive.
+ */
+@Serializable
+internal data class WalletImportEntry(
+    val secretKey: String? = null,
+    val mnemonic: List<String>? = null,
+    val mnemonicType: String? = null,
+    val version: String,
+    val network: TONNetwork,
+    val workchain: Int,
+    val walletId: Long,
+    val domain: TONSignatureDomain? = null,
+)
+
+@Serializable
+internal data class AddWalletsRequest(
+    val wallets: List<WalletImportEntry>,
+)
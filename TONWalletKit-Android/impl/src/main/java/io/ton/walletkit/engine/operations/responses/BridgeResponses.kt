@@ -76,10 +76,13 @@ internal data class AdapterInfoResponse(
     val address: String? = null,
 )
 
+/** Wallet fields from JS; [workchain] and [subwalletId] are reported by built-in adapters only. */
 @Serializable
 internal data class WalletInfoBridge(
     val publicKey: String? = null,
     val version: String? = null,
+    val workchain: Int? = null,
+    val subwalletId: Long? = null,
 )
 
 @Serializable
@@ -88,6 +91,15 @@ internal data class AddWalletResponse(
     val wallet: WalletInfoBridge? = null,
 )
 
+/** Outcome of one entry of an addWallets batch: the added wallet and its address, or [error]. */
+@Serializable
+internal data class AddWalletsEntryResponse(
+    val walletId: String? = null,
+    val wallet: WalletInfoBridge? = null,
+    val address: String? = null,
+    val error: String? = null,
+)
+
 @Serializable
 internal data class ProviderIdResponse(val providerId: String)
 
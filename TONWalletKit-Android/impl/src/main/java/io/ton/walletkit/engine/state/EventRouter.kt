@@ -25,32 +25,55 @@ import io.ton.walletkit.event.TONWalletKitEvent
 import io.ton.walletkit.internal.constants.LogConstants
 import io.ton.walletkit.internal.util.Logger
 import io.ton.walletkit.listener.TONBridgeEventsHandler
-import kotlinx.coroutines.sync.Mutex
-import kotlinx.coroutines.sync.withLock
+import kotlinx.coroutines.CoroutineDispatcher
+import kotlinx.coroutines.CoroutineStart
+import kotlinx.coroutines.CoroutineScope
+import kotlinx.coroutines.Dispatchers
+import kotlinx.coroutines.SupervisorJob
+import kotlinx.coroutines.cancel
+import kotlinx.coroutines.channels.Channel
+import kotlinx.coroutines.launch
+import java.util.concurrent.atomic.AtomicInteger
 
 /**
  * Coordinates registration and invocation of [TONBridgeEventsHandler] instances.
  *
- * The router encapsulates the concurrency guarantees required by the bridge: handler collections
- * are mutated under a mutex, and dispatching obtains a snapshot to avoid concurrent modifications.
- * Logging mirrors the behaviour that previously lived in [WebViewWalletKitEngine].
+ * Handlers live in a copy-on-write snapshot: registration swaps in a new list under a lock and
+ * dispatching reads the current one without locking. [post] never blocks the caller; each handler
+ * has its own queue drained on its own dispatcher (the main thread unless one was given), so a
+ * slow handler delays only itself. A handler sees events in the order they were posted, which
+ * also keeps every session's events in order. Handlers that run longer than
+ * [slowHandlerMillis], or fall more than [BACKLOG_WARNING] events behind, are logged.
+ *
+ * Only typed events go through here. Streaming events are emitted on the callback thread by
+ * [io.ton.walletkit.engine.infrastructure.MessageDispatcher], so a handler may see a typed event
+ * before or after a streaming update that the bridge sent around the same time.
  *
  * @suppress Internal component. Use through [WebViewWalletKitEngine].
  */
-internal class EventRouter {
-    private val eventHandlers = mutableListOf<TONBridgeEventsHandler>()
-    private val mutex = Mutex()
+internal class EventRouter(
+    private val defaultDispatcher: CoroutineDispatcher = Dispatchers.Main,
+    private val slowHandlerMillis: Long = DEFAULT_SLOW_HANDLER_MILLIS,
+) {
+    private val lock = Any()
+    private val scope = CoroutineScope(SupervisorJob())
 
-    @Volatile private var handlerCount: Int = 0
+    @Volatile private var slots: List<HandlerSlot> = emptyList()
 
     /**
      * Register a handler. Returns metadata describing whether the handler was added and if it was
      * the first one in the collection.
+     *
+     * @param dispatcher Where [post]ed events are delivered to this handler; defaults to the router's.
      */
-    suspend fun addHandler(handler: TONBridgeEventsHandler, logAcquired: Boolean = false): AddHandlerOutcome =
-        mutex.withLock {
-            val existingHandlers = eventHandlers.toList()
-            if (eventHandlers.contains(handler)) {
+    suspend fun addHandler(
+        handler: TONBridgeEventsHandler,
+        logAcquired: Boolean = false,
+        dispatcher: CoroutineDispatcher? = null,
+    ): AddHandlerOutcome =
+        synchronized(lock) {
+            val existingHandlers = slots.map { it.handler }
+            if (existingHandlers.contains(handler)) {
                 AddHandlerOutcome(
                     alreadyRegistered = true,
                     isFirstHandler = false,
@@ -58,63 +81,59 @@ internal class EventRouter {
                     handlersAfterAdd = existingHandlers,
                 )
             } else {
-                val wasEmpty = eventHandlers.isEmpty()
-                eventHandlers.add(handler)
-                handlerCount = eventHandlers.size
+                slots = slots + HandlerSlot(handler, dispatcher ?: defaultDispatcher)
                 AddHandlerOutcome(
                     alreadyRegistered = false,
-                    isFirstHandler = wasEmpty,
+                    isFirstHandler = existingHandlers.isEmpty(),
                     handlersBeforeAdd = existingHandlers,
-                    handlersAfterAdd = eventHandlers.toList(),
+                    handlersAfterAdd = existingHandlers + handler,
                 )
             }
         }
 
     /**
      * Unregister a handler. Returns whether the handler was removed and if the collection is empty.
+     * Events still queued for the handler are dropped.
      */
-    suspend fun removeHandler(handler: TONBridgeEventsHandler): RemoveHandlerOutcome =
-        mutex.withLock {
-            val removed = eventHandlers.remove(handler)
-            if (removed) {
-                handlerCount = eventHandlers.size
-            }
-            RemoveHandlerOutcome(
-                removed = removed,
-                isEmpty = eventHandlers.isEmpty(),
-            )
+    suspend fun removeHandler(handler: TONBridgeEventsHandler): RemoveHandlerOutcome {
+        val removed = synchronized(lock) {
+            val slot = slots.firstOrNull { it.handler == handler }
+            if (slot != null) slots = slots - slot
+            slot
         }
+        removed?.close()
+        return RemoveHandlerOutcome(
+            removed = removed != null,
+            isEmpty = slots.isEmpty(),
+        )
+    }
 
     suspend fun containsHandler(handler: TONBridgeEventsHandler): Boolean =
-        mutex.withLock { eventHandlers.contains(handler) }
+        slots.any { it.handler == handler }
 
-    suspend fun dispatchEvent(
+    /**
+     * Queues [event] for every registered handler and returns immediately.
+     */
+    fun post(
         eventId: String,
         type: String,
         event: TONWalletKitEvent,
     ) {
-        try {
-            val handlers =
-                mutex.withLock {
-                    eventHandlers.toList()
-                }
-
-            for (handler in handlers) {
-                try {
-                    handler.handle(event)
-                } catch (e: Exception) {
-                    Logger.e(TAG, MSG_HANDLER_EXCEPTION_PREFIX + eventId + " for handler ${handler.javaClass.simpleName}", e)
-                }
-            }
-        } catch (e: Exception) {
-            Logger.e(TAG, MSG_HANDLER_EXCEPTION_PREFIX + eventId, e)
+        for (slot in slots) {
+            slot.enqueue(Delivery(eventId, type, event))
         }
     }
 
     /**
      * Current number of registered handlers.
      */
-    fun getHandlerCount(): Int = handlerCount
+    fun getHandlerCount(): Int = slots.size
+
+    /** Stops delivery to every handler; queued events are dropped. */
+    fun close() {
+        synchronized(lock) { slots = emptyList() }
+        scope.cancel()
+    }
 
     data class AddHandlerOutcome(
         val alreadyRegistered: Boolean,
@@ -128,8 +147,59 @@ internal class EventRouter {
         val isEmpty: Boolean,
     )
 
+    private class Delivery(
+        val eventId: String,
+        val type: String,
+        val event: TONWalletKitEvent,
+    )
+
+    private inner class HandlerSlot(
+        val handler: TONBridgeEventsHandler,
+        dispatcher: CoroutineDispatcher,
+    ) {
+        private val queue = Channel<Delivery>(Channel.UNLIMITED)
+        private val backlog = AtomicInteger()
+        // Started on the first post, so a handler that never receives an event never touches [dispatcher].
+        private val job = scope.launch(dispatcher, start = CoroutineStart.LAZY) {
+            for (delivery in queue) {
+                backlog.decrementAndGet()
+                deliver(delivery)
+            }
+        }
+
+        fun enqueue(delivery: Delivery) {
+            if (queue.trySend(delivery).isFailure) return
+            job.start()
+            if (backlog.incrementAndGet() == BACKLOG_WARNING) {
+                Logger.w(TAG, "Handler ${handler.javaClass.simpleName} is $BACKLOG_WARNING events behind")
+            }
+        }
+
+        private fun deliver(delivery: Delivery) {
+            val startedAt = System.nanoTime()
+            try {
+                handler.handle(delivery.event)
+            } catch (e: Exception) {
+                Logger.e(TAG, MSG_HANDLER_EXCEPTION_PREFIX + delivery.eventId + " for handler ${handler.javaClass.simpleName}", e)
+            }
+            val elapsedMillis = (System.nanoTime() - startedAt) / 1_000_000
+            if (elapsedMillis >= slowHandlerMillis) {
+                Logger.w(TAG, "Slow handler ${handler.javaClass.simpleName}: ${delivery.type} event ${delivery.eventId} took ${elapsedMillis}ms")
+            }
+        }
+
+        fun close() {
+            queue.close()
+            job.cancel()
+        }
+    }
+
     private companion object {
         private const val TAG = LogConstants.TAG_WEBVIEW_ENGINE
         private const val MSG_HANDLER_EXCEPTION_PREFIX = "Handler threw exception for event "
+
+        /** Two frames at 60 Hz; handlers run on the main thread by default. */
+        private const val DEFAULT_SLOW_HANDLER_MILLIS = 32L
+        private const val BACKLOG_WARNING = 64
     }
 }
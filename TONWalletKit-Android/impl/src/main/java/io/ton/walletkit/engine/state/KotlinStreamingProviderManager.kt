@@ -30,8 +30,8 @@ import kotlinx.coroutines.Dispatchers
 import kotlinx.coroutines.Job
 import kotlinx.coroutines.SupervisorJob
 import kotlinx.coroutines.launch
-import kotlinx.serialization.encodeToString
 import kotlinx.serialization.json.Json
+import kotlinx.serialization.json.encodeToJsonElement
 import java.util.concurrent.ConcurrentHashMap
 
 /** Manages custom Kotlin [ITONStreamingProvider] instances registered into the JS bridge. */
@@ -107,10 +107,9 @@ internal class KotlinStreamingProviderManager(
 
     private suspend inline fun <reified T> dispatch(subscriptionId: String, value: T) {
         try {
-            val updateJson = json.encodeToString(value)
             rpcClient.send(
                 BridgeMethodConstants.METHOD_KOTLIN_PROVIDER_DISPATCH,
-                mapOf("subscriptionId" to subscriptionId, "updateJson" to updateJson),
+                mapOf("subscriptionId" to subscriptionId, "update" to json.encodeToJsonElement(value)),
             )
         } catch (_: Exception) {
         }
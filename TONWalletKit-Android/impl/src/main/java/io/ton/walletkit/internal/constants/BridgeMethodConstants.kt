@@ -36,6 +36,11 @@ internal object BridgeMethodConstants {
      */
     const val METHOD_INIT = "init"
 
+    /**
+     * Method name for adding networks to an initialized bridge (shared multi-network engine).
+     */
+    const val METHOD_ADD_NETWORKS = "addNetworks"
+
     /**
      * Method name for setting up event listeners.
      */
@@ -57,6 +62,7 @@ internal object BridgeMethodConstants {
     const val METHOD_CREATE_V5R1_WALLET_ADAPTER = "createV5R1WalletAdapter"
     const val METHOD_CREATE_V4R2_WALLET_ADAPTER = "createV4R2WalletAdapter"
     const val METHOD_ADD_WALLET = "addWallet"
+    const val METHOD_ADD_WALLETS = "addWallets"
     const val METHOD_RELEASE_REF = "releaseRef"
 
     /**
@@ -40,6 +40,16 @@ internal object LogConstants {
      */
     const val TAG_BRIDGE_STORAGE = "SecureBridgeStorageAdapter"
 
+    /**
+     * Log tag for the journaled storage (EncryptedJournal, JournaledBridgeStorageAdapter).
+     */
+    const val TAG_JOURNAL_STORAGE = "JournaledStorage"
+
+    /**
+     * Log tag for the native session store (IndexedSessionManager).
+     */
+    const val TAG_SESSION_STORE = "IndexedSessionManager"
+
     /**
      * Log tag for WebViewWalletKitEngine class.
      */
@@ -85,4 +95,9 @@ internal object LogConstants {
      * Log message for storage clear failures.
      */
     const val MSG_STORAGE_CLEAR_FAILED = "Storage clear failed"
+
+    /**
+     * Log message prefix for queued storage writes still failing when storage is closed.
+     */
+    const val MSG_STORAGE_WRITES_LOST = "Storage writes lost on close for keys: "
 }
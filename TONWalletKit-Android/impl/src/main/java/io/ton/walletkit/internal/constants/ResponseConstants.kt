@@ -396,6 +396,11 @@ internal object ResponseConstants {
      */
     const val KEY_NETWORK = "network"
 
+    /**
+     * JSON key for the bridge wire protocol version in the `ready` message.
+     */
+    const val KEY_PROTOCOL_VERSION = "protocolVersion"
+
     /**
      * JSON key for TON API URL.
      */
@@ -436,6 +441,11 @@ internal object ResponseConstants {
      */
     const val KEY_METHOD = "method"
 
+    /**
+     * JSON key for the scheduling hint on call envelopes; absent for foreground calls.
+     */
+    const val KEY_PRIORITY = "priority"
+
     // Kind/Type values
     /**
      * Value for 'ready' message kind/type.
@@ -467,6 +477,11 @@ internal object ResponseConstants {
      */
     const val VALUE_KIND_CALL = "call"
 
+    /**
+     * Value for 'cancel' message kind (Kotlin→JS: abandon the forward call with this id).
+     */
+    const val VALUE_KIND_CANCEL = "cancel"
+
     /**
      * Schema type value for text data.
      */
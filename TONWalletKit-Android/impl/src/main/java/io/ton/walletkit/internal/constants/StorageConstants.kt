@@ -51,6 +51,16 @@ internal object StorageConstants {
      */
     const val KEY_PREFIX_SESSION = "session:"
 
+    /**
+     * Storage key for the native session store's list of session ids.
+     */
+    const val SESSION_INDEX_KEY = "session_index"
+
+    /**
+     * Storage key under which the bundle's own session manager keeps its session list.
+     */
+    const val BUNDLE_SESSIONS_KEY = "sessions"
+
     /**
      * Prefix for configuration storage keys.
      *
@@ -82,6 +92,27 @@ internal object StorageConstants {
      */
     const val BRIDGE_STORAGE_NAME = "walletkit_bridge_storage"
 
+    /**
+     * File name of the journaled bridge storage, in the no-backup files directory.
+     */
+    const val BRIDGE_JOURNAL_FILE_NAME = "walletkit_bridge_journal"
+
+    /**
+     * File name of the journal's wrapped data key, next to the journal.
+     */
+    const val BRIDGE_JOURNAL_KEY_FILE_NAME = "walletkit_bridge_journal.key"
+
+    /**
+     * Keystore alias for the key wrapping the journal's data key.
+     */
+    const val BRIDGE_JOURNAL_KEYSTORE_KEY = "walletkit_bridge_journal_key"
+
+    /**
+     * Journal key recording that encrypted preferences were imported. It has no bridge prefix,
+     * so bridge reads and clears never see it.
+     */
+    const val BRIDGE_JOURNAL_MIGRATED_KEY = "journal:migrated"
+
     /**
      * Keystore alias for mnemonic encryption.
      */
@@ -80,8 +80,21 @@ internal object WebViewConstants {
      */
     const val BUILD_INSTRUCTION = "Run `pnpm -w --filter androidkit build` and recompile."
 
+    /**
+     * Bridge wire protocol this SDK requires, matched against `protocolVersion` in the bundle's
+     * `ready` message. Version 1 covers batched framing, binary attachments, integer call ids,
+     * cancellation, structured reverse-RPC results, priority lanes, `addNetworks`,
+     * `describeWallet` and the asynchronous storage and session requests.
+     */
+    const val BRIDGE_PROTOCOL_VERSION = 1
+
     /**
      * URL prefix for loading assets.
      */
     const val URL_PREFIX_HTTPS = "https://"
+
+    /**
+     * Name of the thread that decodes and routes inbound bridge messages.
+     */
+    const val BRIDGE_IO_THREAD_NAME = "WalletKitBridgeIO"
 }
@@ -0,0 +1,158 @@
+/*
+ * Copyright (c) 2025 TonTech
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+package io.ton.walletkit.internal.contract
+
+import java.io.ByteArrayOutputStream
+
+/**
+ * Bag-of-cells (BOC) encoding of cell trees, compatible with `@ton/core` in the bridge bundle.
+ */
+internal object BagOfCells {
+    private const val MAGIC = 0xB5EE9C72.toInt()
+    private const val FLAG_HAS_INDEX = 0x80
+    private const val FLAG_HAS_CRC32C = 0x40
+    private const val FLAG_EXOTIC = 0x08
+
+    /** Decodes a single-root BOC, verifying its CRC32C when present. */
+    fun parse(boc: ByteArray): Cell {
+        val reader = Reader(boc)
+        require(reader.int(4) == MAGIC) { "Not a bag of cells" }
+        val flags = reader.int(1)
+        val sizeBytes = flags and 0x07
+        val offsetBytes = reader.int(1)
+        val cellCount = reader.int(sizeBytes)
+        val rootCount = reader.int(sizeBytes)
+        reader.int(sizeBytes) // absent cells
+        reader.int(offsetBytes) // total cell data size
+        require(rootCount == 1) { "Expected one root cell, got $rootCount" }
+        val root = reader.int(sizeBytes)
+        if (flags and FLAG_HAS_INDEX != 0) reader.skip(cellCount * offsetBytes)
+        if (flags and FLAG_HAS_CRC32C != 0) {
+            val expected = crc32c(boc, boc.size - 4)
+            val actual = boc.copyOfRange(boc.size - 4, boc.size).foldIndexed(0) { i, acc, b -> acc or ((b.toInt() and 0xFF) shl (8 * i)) }
+            require(expected == actual) { "Bag of cells checksum mismatch" }
+        }
+
+        val raw = List(cellCount) {
+            val d1 = reader.int(1)
+            val d2 = reader.int(1)
+            require(d1 and FLAG_EXOTIC == 0) { "Exotic cells are not supported" }
+            val bytes = reader.bytes((d2 + 1) / 2)
+            val bitLength = if (d2 % 2 == 0) bytes.size * 8 else bytes.size * 8 - 1 - bytes.last().countTrailingZeroBits()
+            if (bitLength % 8 != 0) {
+                bytes[bytes.size - 1] = (bytes.last().toInt() and (0xFF shl (8 - bitLength % 8))).toByte()
+            }
+            Triple(bytes, bitLength, IntArray(d1 and 0x07) { reader.int(sizeBytes) })
+        }
+        // References always point forward, so building back to front sees children first.
+        val cells = arrayOfNulls<Cell>(cellCount)
+        for (index in cellCount - 1 downTo 0) {
+            val (bytes, bitLength, refs) = raw[index]
+            cells[index] = Cell(bytes, bitLength, refs.map { requireNotNull(cells[it]) { "Bad cell reference" } })
+        }
+        return requireNotNull(cells[root])
+    }
+
+    /**
+     * Encodes the tree under [root] without an index and with a CRC32C, the layout of
+     * `@ton/core`'s default `toBoc()`. Identical subtrees are stored once.
+     */
+    fun serialize(root: Cell): ByteArray {
+        val order = topologicalOrder(root)
+        val indices = order.withIndex().associate { (index, cell) -> cell.hashKey() to index }
+        val sizeBytes = byteCount(order.size)
+
+        val cells = ByteArrayOutputStream()
+        for (cell in order) {
+            cells.write(cell.descriptors())
+            cells.write(cell.paddedData())
+            cell.refs.forEach { writeInt(cells, indices.getValue(it.hashKey()), sizeBytes) }
+        }
+        val cellData = cells.toByteArray()
+        val offsetBytes = byteCount(cellData.size)
+
+        val out = ByteArrayOutputStream()
+        writeInt(out, MAGIC, 4)
+        out.write(FLAG_HAS_CRC32C or sizeBytes)
+        out.write(offsetBytes)
+        writeInt(out, order.size, sizeBytes)
+        writeInt(out, 1, sizeBytes)
+        writeInt(out, 0, sizeBytes)
+        writeInt(out, cellData.size, offsetBytes)
+        writeInt(out, 0, sizeBytes)
+        out.write(cellData)
+        val body = out.toByteArray()
+        val crc = crc32c(body, body.size)
+        return body + ByteArray(4) { (crc ushr (8 * it)).toByte() }
+    }
+
+    /** Parents before children, matching the order `@ton/core` writes so outputs are byte-identical. */
+    private fun topologicalOrder(root: Cell): List<Cell> {
+        val visited = HashSet<String>()
+        val postOrder = ArrayList<Cell>()
+        fun visit(cell: Cell) {
+            if (!visited.add(cell.hashKey())) return
+            cell.refs.asReversed().forEach(::visit)
+            postOrder += cell
+        }
+        visit(root)
+        return postOrder.asReversed()
+    }
+
+    private fun byteCount(value: Int): Int = maxOf(1, (32 - Integer.numberOfLeadingZeros(value) + 7) / 8)
+
+    private fun writeInt(out: ByteArrayOutputStream, value: Int, bytes: Int) {
+        for (shift in (bytes - 1) * 8 downTo 0 step 8) out.write(value ushr shift)
+    }
+
+    private val crcTable = IntArray(256) { n ->
+        var c = n
+        repeat(8) { c = if (c and 1 != 0) (c ushr 1) xor 0x82F63B78.toInt() else c ushr 1 }
+        c
+    }
+
+    private fun crc32c(bytes: ByteArray, length: Int): Int {
+        var crc = -1
+        for (i in 0 until length) crc = crcTable[(crc xor bytes[i].toInt()) and 0xFF] xor (crc ushr 8)
+        return crc.inv()
+    }
+
+    private class Reader(private val bytes: ByteArray) {
+        private var position = 0
+
+        fun int(size: Int): Int {
+            require(position + size <= bytes.size) { "Truncated bag of cells" }
+            var value = 0
+            repeat(size) { value = (value shl 8) or (bytes[position++].toInt() and 0xFF) }
+            return value
+        }
+
+        fun bytes(size: Int): ByteArray {
+            require(position + size <= bytes.size) { "Truncated bag of cells" }
+            return bytes.copyOfRange(position, position + size).also { position += size }
+        }
+
+        fun skip(size: Int) {
+            position += size
+        }
+    }
+}
@@ -0,0 +1,118 @@
+/*
+ * Copyright (c) 2025 TonTech
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+package io.ton.walletkit.internal.contract
+
+import java.security.MessageDigest
+
+/**
+ * An ordinary TVM cell: up to [MAX_BITS] data bits and [MAX_REFS] references.
+ *
+ * Covers what deriving wallet state inits needs, building, hashing and serializing ordinary
+ * cells; exotic cells are not supported.
+ *
+ * @property data Data bits packed most significant bit first, unused trailing bits zero
+ * @property bitLength Number of data bits
+ * @property refs Referenced cells
+ */
+internal class Cell(
+    private val data: ByteArray,
+    val bitLength: Int,
+    val refs: List<Cell> = emptyList(),
+) {
+    init {
+        require(bitLength in 0..MAX_BITS) { "Cell holds at most $MAX_BITS bits, got $bitLength" }
+        require(refs.size <= MAX_REFS) { "Cell holds at most $MAX_REFS references, got ${refs.size}" }
+        require(data.size == (bitLength + 7) / 8) { "Cell data does not match its bit length" }
+    }
+
+    /** Longest chain of references below this cell; 0 for a leaf. */
+    val depth: Int = if (refs.isEmpty()) 0 else refs.maxOf { it.depth } + 1
+
+    private val hashBytes: ByteArray by lazy {
+        val digest = MessageDigest.getInstance("SHA-256")
+        digest.update(descriptors())
+        digest.update(paddedData())
+        refs.forEach { digest.update(byteArrayOf((it.depth ushr 8).toByte(), it.depth.toByte())) }
+        refs.forEach { digest.update(it.hashBytes) }
+        digest.digest()
+    }
+
+    /** Representation hash of the cell, the value contract addresses are derived from. */
+    fun hash(): ByteArray = hashBytes.copyOf()
+
+    /** The two descriptor bytes: reference count, then the data length in half-bytes. */
+    internal fun descriptors(): ByteArray =
+        byteArrayOf(refs.size.toByte(), ((bitLength + 7) / 8 + bitLength / 8).toByte())
+
+    /** Data bytes with the completion tag: a 1 bit after the last data bit of a partial byte. */
+    internal fun paddedData(): ByteArray {
+        val padded = data.copyOf()
+        val partial = bitLength % 8
+        if (partial != 0) {
+            padded[padded.size - 1] = (padded[padded.size - 1].toInt() or (0x80 ushr partial)).toByte()
+        }
+        return padded
+    }
+
+    internal fun hashKey(): String = hashBytes.joinToString("") { "%02x".format(it) }
+
+    companion object {
+        const val MAX_BITS = 1023
+        const val MAX_REFS = 4
+    }
+}
+
+/** Accumulates bits and references for a new [Cell]. */
+internal class CellBuilder {
+    private val bits = ByteArray((Cell.MAX_BITS + 7) / 8)
+    private var length = 0
+    private val refs = ArrayList<Cell>(Cell.MAX_REFS)
+
+    fun storeBit(bit: Boolean): CellBuilder {
+        require(length < Cell.MAX_BITS) { "Cell overflow" }
+        if (bit) bits[length / 8] = (bits[length / 8].toInt() or (0x80 ushr (length % 8))).toByte()
+        length++
+        return this
+    }
+
+    /** Stores the low [bitCount] bits of [value], most significant first. */
+    fun storeUint(value: Long, bitCount: Int): CellBuilder {
+        require(bitCount in 0..63 && value >= 0 && value ushr bitCount == 0L) {
+            "$value does not fit in $bitCount bits"
+        }
+        for (shift in bitCount - 1 downTo 0) storeBit((value ushr shift) and 1L == 1L)
+        return this
+    }
+
+    fun storeBytes(bytes: ByteArray): CellBuilder {
+        bytes.forEach { storeUint(it.toLong() and 0xFF, 8) }
+        return this
+    }
+
+    fun storeRef(cell: Cell): CellBuilder {
+        require(refs.size < Cell.MAX_REFS) { "Cell reference overflow" }
+        refs += cell
+        return this
+    }
+
+    fun build(): Cell = Cell(bits.copyOf((length + 7) / 8), length, refs.toList())
+}
@@ -0,0 +1,138 @@
+/*
+ * Copyright (c) 2025 TonTech
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+package io.ton.walletkit.internal.contract
+
+import io.ton.walletkit.api.WalletVersions
+import io.ton.walletkit.model.TONBase64
+import io.ton.walletkit.model.TONRawAddress
+import io.ton.walletkit.model.TONUserFriendlyAddress
+import java.util.Base64
+
+/**
+ * State inits and addresses of the built-in wallet contracts, derived natively the same way as
+ * the bridge's WalletV4R2Adapter and WalletV5R1Adapter.
+ *
+ * An address depends only on the contract code, public key, wallet ID and workchain, so derived
+ * addresses are memoized by those inputs and wallet lists can be rendered without the bridge.
+ */
+internal object WalletContracts {
+    private const val ADDRESS_CACHE_SIZE = 256
+
+    private val v4r2Code: Cell by lazy { BagOfCells.parse(Base64.getDecoder().decode(V4R2_CODE)) }
+    private val v5r1Code: Cell by lazy { BagOfCells.parse(Base64.getDecoder().decode(V5R1_CODE)) }
+
+    private data class AddressKey(
+        val version: String,
+        val publicKey: String,
+        val workchain: Int,
+        val walletId: Long,
+        val testnet: Boolean,
+    )
+
+    private val addresses = object : LinkedHashMap<AddressKey, TONUserFriendlyAddress>(16, 0.75f, true) {
+        override fun removeEldestEntry(eldest: MutableMap.MutableEntry<AddressKey, TONUserFriendlyAddress>?): Boolean =
+            size > ADDRESS_CACHE_SIZE
+    }
+
+    fun supports(version: String): Boolean = version == WalletVersions.V4R2 || version == WalletVersions.V5R1
+
+    /** The StateInit cell: no split depth or special flags, code and data references, no libraries. */
+    fun stateInit(version: String, publicKey: ByteArray, walletId: Long): Cell =
+        CellBuilder()
+            .storeBit(false)
+            .storeBit(false)
+            .storeBit(true)
+            .storeRef(code(version))
+            .storeBit(true)
+            .storeRef(data(version, publicKey, walletId))
+            .storeBit(false)
+            .build()
+
+    /** The StateInit as a base64 BOC, byte-identical to what the JS adapters produce. */
+    fun stateInitBoc(version: String, publicKey: ByteArray, walletId: Long): TONBase64 =
+        TONBase64(Base64.getEncoder().encodeToString(BagOfCells.serialize(stateInit(version, publicKey, walletId))))
+
+    /**
+     * Non-bounceable user-friendly address of the contract, the format JS `getAddress()` returns.
+     *
+     * @throws IllegalArgumentException for an unsupported version, a public key that is not 32
+     *   bytes, or a wallet ID that does not fit in 32 bits
+     */
+    fun address(
+        version: String,
+        publicKey: ByteArray,
+        workchain: Int,
+        walletId: Long,
+        testnet: Boolean = false,
+    ): TONUserFriendlyAddress {
+        val key = AddressKey(version, publicKey.joinToString("") { "%02x".format(it) }, workchain, walletId, testnet)
+        synchronized(addresses) { addresses[key] }?.let { return it }
+        val hash = stateInit(version, publicKey, walletId).hash()
+        val address = TONRawAddress(workchain.toByte(), hash).toUserFriendly(isBounceable = false, isTestnetOnly = testnet)
+        synchronized(addresses) { addresses[key] = address }
+        return address
+    }
+
+    private fun code(version: String): Cell = when (version) {
+        WalletVersions.V4R2 -> v4r2Code
+        WalletVersions.V5R1 -> v5r1Code
+        else -> throw IllegalArgumentException("Unsupported wallet version: $version")
+    }
+
+    /** Initial contract data: seqno 0, the wallet ID and public key, and an empty plugin/extension dictionary. */
+    private fun data(version: String, publicKey: ByteArray, walletId: Long): Cell {
+        require(publicKey.size == 32) { "Public key must be 32 bytes, got ${publicKey.size}" }
+        val builder = CellBuilder()
+        if (version == WalletVersions.V5R1) builder.storeBit(true) // signature auth allowed
+        return builder
+            .storeUint(0, 32)
+            .storeUint(walletId, 32)
+            .storeBytes(publicKey)
+            .storeBit(false)
+            .build()
+    }
+
+    private const val V4R2_CODE =
+        "te6ccgECFAEAAtQAART/APSkE/S88sgLAQIBIAIDAgFIBAUE+PKDCNcYINMf0x/THwL4I7vyZO1E0NMf0x/T//QE0VFDuvKh" +
+        "UVG68qIF+QFUEGT5EPKj+AAkpMjLH1JAyx9SMMv/UhD0AMntVPgPAdMHIcAAn2xRkyDXSpbTB9QC+wDoMOAhwAHjACHAAuMA" +
+        "AcADkTDjDQOkyMsfEssfy/8QERITAubQAdDTAyFxsJJfBOAi10nBIJJfBOAC0x8hghBwbHVnvSKCEGRzdHK9sJJfBeAD+kAw" +
+        "IPpEAcjKB8v/ydDtRNCBAUDXIfQEMFyBAQj0Cm+hMbOSXwfgBdM/yCWCEHBsdWe6kjgw4w0DghBkc3RyupJfBuMNBgcCASAI" +
+        "CQB4AfoA9AQw+CdvIjBQCqEhvvLgUIIQcGx1Z4MesXCAGFAEywUmzxZY+gIZ9ADLaRfLH1Jgyz8gyYBA+wAGAIpQBIEBCPRZ" +
+        "MO1E0IEBQNcgyAHPFvQAye1UAXKwjiOCEGRzdHKDHrFwgBhQBcsFUAPPFiP6AhPLassfyz/JgED7AJJfA+ICASAKCwBZvSQr" +
+        "b2omhAgKBrkPoCGEcNQICEekk30pkQzmkD6f+YN4EoAbeBAUiYcVnzGEAgFYDA0AEbjJftRNDXCx+AA9sp37UTQgQFA1yH0B" +
+        "DACyMoHy//J0AGBAQj0Cm+hMYAIBIA4PABmtznaiaEAga5Drhf/AABmvHfaiaEAQa5DrhY/AAG7SB/oA1NQi+QAFyMoHFcv/" +
+        "ydB3dIAYyMsFywIizxZQBfoCFMtrEszMyXP7AMhAFIEBCPRR8qcCAHCBAQjXGPoA0z/IVCBHgQEI9FHyp4IQbm90ZXB0gBjI" +
+        "ywXLAlAGzxZQBPoCFMtqEssfyz/Jc/sAAgBsgQEI1xj6ANM/MFIkgQEI9Fnyp4IQZHN0cnB0gBjIywXLAlAFzxZQA/oCE8tq" +
+        "yx8Syz/Jc/sAAAr0AMntVA=="
+
+    private const val V5R1_CODE =
+        "te6ccgECFAEAAoEAART/APSkE/S88sgLAQIBIAIDAgFIBAUBAvIOAtzQINdJwSCRW49jINcLHyCCEGV4dG69IYIQc2ludL2w" +
+        "kl8D4IIQZXh0brqOtIAg1yEB0HTXIfpAMPpE+Cj6RDBYvZFb4O1E0IEBQdch9AWDB/QOb6ExkTDhgEDXIXB/2zzgMSDXSYEC" +
+        "gLmRMOBw4hAPAgEgBgcCASAICQAZvl8PaiaECAoOuQ+gLAIBbgoLAgFIDA0AGa3OdqJoQCDrkOuF/8AAGa8d9qJoQBDrkOuF" +
+        "j8AAF7Ml+1E0HHXIdcLH4AARsmL7UTQ1woAgAR4g1wsfghBzaWduuvLgin8PAeaO8O2i7fshgwjXIgKDCNcjIIAg1yHTH9Mf" +
+        "0x/tRNDSANMfINMf0//XCgAK+QFAzPkQmiiUXwrbMeHywIffArNQB7Dy0IRRJbry4IVQNrry4Ib4I7vy0IgikvgA3gGkf8jK" +
+        "AMsfAc8Wye1UIJL4D95w2zzYEAP27aLt+wL0BCFukmwhjkwCIdc5MHCUIccAs44tAdcoIHYeQ2wg10nACPLgkyDXSsAC8uCT" +
+        "INcdBscSwgBSMLDy0InXTNc5MAGk6GwShAe78uCT10rAAPLgk+1V4tIAAcAAkVvg69csCBQgkXCWAdcsCBwS4lIQseMPINdK" +
+        "ERITAJYB+kAB+kT4KPpEMFi68uCR7UTQgQFB1xj0BQSdf8jKAEAEgwf0U/Lgi44UA4MH9Fvy4Iwi1woAIW4Bs7Dy0JDiyFAD" +
+        "zxYS9ADJ7VQAcjDXLAgkji0h8uCS0gDtRNDSAFETuvLQj1RQMJExnAGBAUDXIdcKAPLgjuLIygBYzxbJ7VST8sCN4gAQk1vb" +
+        "MeHXTNA="
+}
@@ -0,0 +1,325 @@
+/*
+ * Copyright (c) 2025 TonTech
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+package io.ton.walletkit.internal.crypto
+
+import java.security.MessageDigest
+
+/**
+ * Ed25519 key derivation and signing, ported from TweetNaCl.
+ *
+ * Android only ships Ed25519 in JCA from API 33, so this is plain Kotlin. Keys and signatures are
+ * byte-for-byte those of `nacl.sign` in the bridge bundle: a secret key is the 32-byte seed
+ * followed by the 32-byte public key. Field elements are 16 limbs of 16 bits in a [LongArray],
+ * and every step runs in constant time.
+ */
+internal object Ed25519 {
+    const val SEED_BYTES = 32
+    const val PUBLIC_KEY_BYTES = 32
+    const val SECRET_KEY_BYTES = 64
+    const val SIGNATURE_BYTES = 64
+
+    /** Returns the 64-byte secret key (seed and public key) for [seed]. */
+    fun secretKeyFromSeed(seed: ByteArray): ByteArray {
+        require(seed.size == SEED_BYTES) { "Ed25519 seed must be $SEED_BYTES bytes, got ${seed.size}" }
+        val d = sha512(seed)
+        clamp(d)
+        val p = point()
+        scalarBase(p, d)
+        val secretKey = seed.copyOf(SECRET_KEY_BYTES)
+        pack(secretKey, SEED_BYTES, p)
+        return secretKey
+    }
+
+    /**
+     * Signs [message] with [secretKey], either a 64-byte secret key or a 32-byte seed, and returns
+     * the detached 64-byte signature.
+     */
+    fun sign(message: ByteArray, secretKey: ByteArray): ByteArray {
+        val fullKey = when (secretKey.size) {
+            SEED_BYTES -> secretKeyFromSeed(secretKey)
+            SECRET_KEY_BYTES -> secretKey
+            else -> throw IllegalArgumentException("Ed25519 secret key must be 32 or 64 bytes, got ${secretKey.size}")
+        }
+        val d = sha512(fullKey.copyOf(SEED_BYTES))
+        clamp(d)
+
+        val digest = MessageDigest.getInstance("SHA-512")
+        digest.update(d, 32, 32)
+        digest.update(message)
+        val r = digest.digest()
+        reduce(r)
+        val p = point()
+        scalarBase(p, r)
+
+        val signature = ByteArray(SIGNATURE_BYTES)
+        pack(signature, 0, p)
+        digest.update(signature, 0, 32)
+        digest.update(fullKey, SEED_BYTES, PUBLIC_KEY_BYTES)
+        digest.update(message)
+        val h = digest.digest()
+        reduce(h)
+
+        val x = LongArray(64)
+        for (i in 0 until 32) x[i] = (r[i].toLong() and 0xff)
+        for (i in 0 until 32) {
+            val hi = h[i].toLong() and 0xff
+            for (j in 0 until 32) x[i + j] += hi * (d[j].toLong() and 0xff)
+        }
+        modL(signature, 32, x)
+        return signature
+    }
+
+    /**
+     * Returns the X25519 public key for a 32-byte [secretKey], as `nacl.box.keyPair` computes it for
+     * TON Connect session keys. The clamped scalar multiplies the Edwards base point, and the
+     * result maps to the Montgomery u-coordinate as (Z + Y) / (Z - Y).
+     */
+    fun x25519PublicKey(secretKey: ByteArray): ByteArray {
+        require(secretKey.size == SEED_BYTES) { "X25519 secret key must be $SEED_BYTES bytes, got ${secretKey.size}" }
+        val s = secretKey.copyOf()
+        clamp(s)
+        val p = point()
+        scalarBase(p, s)
+        val u = LongArray(16)
+        val den = LongArray(16)
+        add(u, p[2], p[1])
+        sub(den, p[2], p[1])
+        inv25519(den, den)
+        mul(u, u, den)
+        val publicKey = ByteArray(PUBLIC_KEY_BYTES)
+        pack25519(publicKey, 0, u)
+        return publicKey
+    }
+
+    private fun sha512(data: ByteArray): ByteArray = MessageDigest.getInstance("SHA-512").digest(data)
+
+    private fun clamp(d: ByteArray) {
+        d[0] = (d[0].toInt() and 248).toByte()
+        d[31] = (d[31].toInt() and 127 or 64).toByte()
+    }
+
+    // ---- GF(2^255 - 19) ----
+
+    private fun gf(vararg limbs: Long) = LongArray(16).also { limbs.copyInto(it) }
+
+    private fun point() = Array(4) { LongArray(16) }
+
+    private fun car25519(o: LongArray) {
+        for (i in 0 until 16) {
+            o[i] += 1L shl 16
+            val c = o[i] shr 16
+            if (i < 15) o[i + 1] += c - 1 else o[0] += 38 * (c - 1)
+            o[i] -= c shl 16
+        }
+    }
+
+    /** Swaps [p] and [q] when [b] is 1, without branching on it. */
+    private fun sel25519(p: LongArray, q: LongArray, b: Int) {
+        val c = (b - 1).toLong().inv()
+        for (i in 0 until 16) {
+            val t = c and (p[i] xor q[i])
+            p[i] = p[i] xor t
+            q[i] = q[i] xor t
+        }
+    }
+
+    private fun pack25519(o: ByteArray, offset: Int, n: LongArray) {
+        val m = LongArray(16)
+        val t = n.copyOf()
+        car25519(t)
+        car25519(t)
+        car25519(t)
+        repeat(2) {
+            m[0] = t[0] - 0xffed
+            for (i in 1 until 15) {
+                m[i] = t[i] - 0xffff - ((m[i - 1] shr 16) and 1)
+                m[i - 1] = m[i - 1] and 0xffff
+            }
+            m[15] = t[15] - 0x7fff - ((m[14] shr 16) and 1)
+            val b = ((m[15] shr 16) and 1).toInt()
+            m[14] = m[14] and 0xffff
+            sel25519(t, m, 1 - b)
+        }
+        for (i in 0 until 16) {
+            o[offset + 2 * i] = t[i].toByte()
+            o[offset + 2 * i + 1] = (t[i] shr 8).toByte()
+        }
+    }
+
+    private fun par25519(a: LongArray): Int {
+        val d = ByteArray(32)
+        pack25519(d, 0, a)
+        return d[0].toInt() and 1
+    }
+
+    private fun add(o: LongArray, a: LongArray, b: LongArray) {
+        for (i in 0 until 16) o[i] = a[i] + b[i]
+    }
+
+    private fun sub(o: LongArray, a: LongArray, b: LongArray) {
+        for (i in 0 until 16) o[i] = a[i] - b[i]
+    }
+
+    private fun mul(o: LongArray, a: LongArray, b: LongArray) {
+        val t = LongArray(31)
+        for (i in 0 until 16) {
+            for (j in 0 until 16) t[i + j] += a[i] * b[j]
+        }
+        for (i in 0 until 15) t[i] += 38 * t[i + 16]
+        t.copyInto(o, 0, 0, 16)
+        car25519(o)
+        car25519(o)
+    }
+
+    private fun inv25519(o: LongArray, i: LongArray) {
+        val c = i.copyOf()
+        for (a in 253 downTo 0) {
+            mul(c, c, c)
+            if (a != 2 && a != 4) mul(c, c, i)
+        }
+        c.copyInto(o)
+    }
+
+    // ---- Edwards points in extended coordinates (X, Y, Z, T) ----
+
+    private fun addPoint(p: Array<LongArray>, q: Array<LongArray>) {
+        val a = LongArray(16)
+        val b = LongArray(16)
+        val c = LongArray(16)
+        val d = LongArray(16)
+        val t = LongArray(16)
+        val e = LongArray(16)
+        val f = LongArray(16)
+        val g = LongArray(16)
+        val h = LongArray(16)
+        sub(a, p[1], p[0])
+        sub(t, q[1], q[0])
+        mul(a, a, t)
+        add(b, p[0], p[1])
+        add(t, q[0], q[1])
+        mul(b, b, t)
+        mul(c, p[3], q[3])
+        mul(c, c, D2)
+        mul(d, p[2], q[2])
+        add(d, d, d)
+        sub(e, b, a)
+        sub(f, d, c)
+        add(g, d, c)
+        add(h, b, a)
+        mul(p[0], e, f)
+        mul(p[1], h, g)
+        mul(p[2], g, f)
+        mul(p[3], e, h)
+    }
+
+    private fun cswap(p: Array<LongArray>, q: Array<LongArray>, b: Int) {
+        for (i in 0 until 4) sel25519(p[i], q[i], b)
+    }
+
+    private fun pack(r: ByteArray, offset: Int, p: Array<LongArray>) {
+        val tx = LongArray(16)
+        val ty = LongArray(16)
+        val zi = LongArray(16)
+        inv25519(zi, p[2])
+        mul(tx, p[0], zi)
+        mul(ty, p[1], zi)
+        pack25519(r, offset, ty)
+        r[offset + 31] = (r[offset + 31].toInt() xor (par25519(tx) shl 7)).toByte()
+    }
+
+    private fun scalarMult(p: Array<LongArray>, q: Array<LongArray>, s: ByteArray) {
+        GF0.copyInto(p[0])
+        GF1.copyInto(p[1])
+        GF1.copyInto(p[2])
+        GF0.copyInto(p[3])
+        for (i in 255 downTo 0) {
+            val b = (s[i / 8].toInt() shr (i and 7)) and 1
+            cswap(p, q, b)
+            addPoint(q, p)
+            addPoint(p, p)
+            cswap(p, q, b)
+        }
+    }
+
+    private fun scalarBase(p: Array<LongArray>, s: ByteArray) {
+        val q = point()
+        X.copyInto(q[0])
+        Y.copyInto(q[1])
+        GF1.copyInto(q[2])
+        mul(q[3], X, Y)
+        scalarMult(p, q, s)
+    }
+
+    // ---- Scalars modulo the group order L ----
+
+    private fun modL(r: ByteArray, offset: Int, x: LongArray) {
+        for (i in 63 downTo 32) {
+            var carry = 0L
+            var j = i - 32
+            while (j < i - 12) {
+                x[j] += carry - 16 * x[i] * L[j - (i - 32)]
+                carry = (x[j] + 128) shr 8
+                x[j] -= carry shl 8
+                j++
+            }
+            x[j] += carry
+            x[i] = 0
+        }
+        var carry = 0L
+        for (j in 0 until 32) {
+            x[j] += carry - (x[31] shr 4) * L[j]
+            carry = x[j] shr 8
+            x[j] = x[j] and 255
+        }
+        for (j in 0 until 32) x[j] -= carry * L[j]
+        for (i in 0 until 32) {
+            x[i + 1] += x[i] shr 8
+            r[offset + i] = (x[i] and 255).toByte()
+        }
+    }
+
+    /** Reduces the 64-byte little-endian number in [r] modulo L, in place. */
+    private fun reduce(r: ByteArray) {
+        val x = LongArray(64) { r[it].toLong() and 0xff }
+        r.fill(0)
+        modL(r, 0, x)
+    }
+
+    private val GF0 = gf()
+    private val GF1 = gf(1)
+    private val D2 = gf(
+        0xf159, 0x26b2, 0x9b94, 0xebd6, 0xb156, 0x8283, 0x149a, 0x00e0,
+        0xd130, 0xeef3, 0x80f2, 0x198e, 0xfce7, 0x56df, 0xd9dc, 0x2406,
+    )
+    private val X = gf(
+        0xd51a, 0x8f25, 0x2d60, 0xc956, 0xa7b2, 0x9525, 0xc760, 0x692c,
+        0xdc5c, 0xfdd6, 0xe231, 0xc0a4, 0x53fe, 0xcd6e, 0x36d3, 0x2169,
+    )
+    private val Y = gf(
+        0x6658, 0x6666, 0x6666, 0x6666, 0x6666, 0x6666, 0x6666, 0x6666,
+        0x6666, 0x6666, 0x6666, 0x6666, 0x6666, 0x6666, 0x6666, 0x6666,
+    )
+    private val L = longArrayOf(
+        0xed, 0xd3, 0xf5, 0x5c, 0x1a, 0x63, 0x12, 0x58, 0xd6, 0x9c, 0xf7, 0xa2, 0xde, 0xf9, 0xde, 0x14,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0x10,
+    )
+}
@@ -0,0 +1,93 @@
+/*
+ * Copyright (c) 2025 TonTech
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+package io.ton.walletkit.internal.crypto
+
+import io.ton.walletkit.WalletKitBridgeException
+import io.ton.walletkit.model.KeyPair
+import java.security.SecureRandom
+import javax.crypto.Mac
+import javax.crypto.spec.SecretKeySpec
+
+/**
+ * TON mnemonics, computed natively with the same derivation as `@ton/crypto` in the bridge
+ * bundle: the phrase is HMAC-SHA512'd into entropy, and PBKDF2-HMAC-SHA512 over that entropy
+ * yields the Ed25519 seed (100k rounds) or the version check byte.
+ */
+internal object TonMnemonic {
+    const val TYPE = "ton"
+
+    private const val PBKDF_ITERATIONS = 100_000
+    private const val DEFAULT_SEED_SALT = "TON default seed"
+    private const val SEED_VERSION_SALT = "TON seed version"
+    private const val HMAC_SHA512 = "HmacSHA512"
+
+    /**
+     * Draws [wordCount] random words until they form a basic (password-less) TON mnemonic, the
+     * same check `mnemonicNew` runs. About one candidate in 256 passes.
+     */
+    fun generate(wordCount: Int = 24, random: SecureRandom = SecureRandom()): List<String> {
+        require(wordCount > 0) { "Word count must be positive" }
+        val words = Bip39Wordlist.words
+        while (true) {
+            val candidate = List(wordCount) { words[random.nextInt(Bip39Wordlist.SIZE)] }
+            if (isBasicSeed(toEntropy(candidate))) return candidate
+        }
+    }
+
+    /** Derives the wallet key pair; the secret key is the 32-byte seed followed by the public key. */
+    fun toKeyPair(mnemonic: List<String>): KeyPair {
+        if (mnemonic.size != 12 && mnemonic.size != 24) {
+            throw WalletKitBridgeException("Invalid mnemonic length: expected 12 or 24 words, got ${mnemonic.size}")
+        }
+        val normalized = mnemonic.map { it.lowercase().trim() }
+        val seed = pbkdf2Sha512(toEntropy(normalized), DEFAULT_SEED_SALT.encodeToByteArray(), PBKDF_ITERATIONS)
+        val secretKey = Ed25519.secretKeyFromSeed(seed.copyOf(Ed25519.SEED_BYTES))
+        return KeyPair(secretKey.copyOfRange(Ed25519.SEED_BYTES, Ed25519.SECRET_KEY_BYTES), secretKey)
+    }
+
+    internal fun isBasicSeed(entropy: ByteArray): Boolean =
+        pbkdf2Sha512(entropy, SEED_VERSION_SALT.encodeToByteArray(), PBKDF_ITERATIONS / 256)[0] == 0.toByte()
+
+    internal fun toEntropy(words: List<String>): ByteArray =
+        Mac.getInstance(HMAC_SHA512).run {
+            init(SecretKeySpec(words.joinToString(" ").encodeToByteArray(), HMAC_SHA512))
+            doFinal()
+        }
+
+    /**
+     * PBKDF2 with a single 64-byte output block. JCA's PBKDF2 factories take the password as
+     * chars, which cannot carry raw entropy bytes, so the rounds run over [Mac] directly.
+     */
+    internal fun pbkdf2Sha512(password: ByteArray, salt: ByteArray, iterations: Int): ByteArray {
+        val mac = Mac.getInstance(HMAC_SHA512)
+        mac.init(SecretKeySpec(password, HMAC_SHA512))
+        mac.update(salt)
+        val u = mac.doFinal(byteArrayOf(0, 0, 0, 1))
+        val result = u.copyOf()
+        repeat(iterations - 1) {
+            mac.update(u)
+            mac.doFinal(u, 0)
+            for (i in result.indices) result[i] = (result[i].toInt() xor u[i].toInt()).toByte()
+        }
+        return result
+    }
+}
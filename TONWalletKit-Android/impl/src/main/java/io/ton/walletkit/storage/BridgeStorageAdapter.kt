@@ -61,4 +61,32 @@ internal interface BridgeStorageAdapter {
      * Clear all storage data.
      */
     suspend fun clear()
+
+    /**
+     * Get several values at once; missing keys are left out of the result.
+     * Defaults to one [get] per key.
+     */
+    suspend fun getMany(keys: Collection<String>): Map<String, String> =
+        buildMap { for (key in keys) get(key)?.let { put(key, it) } }
+
+    /**
+     * Set several values at once, ideally in one transaction. Defaults to one [set] per key.
+     */
+    suspend fun setMany(values: Map<String, String>) {
+        for ((key, value) in values) set(key, value)
+    }
+
+    /**
+     * Remove several values at once, ideally in one transaction. Defaults to one [remove] per key.
+     */
+    suspend fun removeMany(keys: Collection<String>) {
+        for (key in keys) remove(key)
+    }
+
+    /**
+     * Get every value whose key starts with [prefix].
+     * @throws UnsupportedOperationException if the backing store cannot enumerate keys
+     */
+    suspend fun getByPrefix(prefix: String): Map<String, String> =
+        throw UnsupportedOperationException("Prefix scans are not supported by this storage")
 }
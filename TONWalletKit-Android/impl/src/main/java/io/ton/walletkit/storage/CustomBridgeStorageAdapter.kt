@@ -80,6 +80,35 @@ internal class CustomBridgeStorageAdapter(
         }
     }
 
+    override suspend fun getMany(keys: Collection<String>): Map<String, String> =
+        wrap(StorageOperation.GET, "getMany ${keys.size} keys") { customStorage.getMany(keys) }
+
+    override suspend fun setMany(values: Map<String, String>) {
+        wrap(StorageOperation.SET, "setMany ${values.size} keys") { customStorage.setMany(values) }
+    }
+
+    override suspend fun removeMany(keys: Collection<String>) {
+        wrap(StorageOperation.REMOVE, "removeMany ${keys.size} keys") { customStorage.removeMany(keys) }
+    }
+
+    override suspend fun getByPrefix(prefix: String): Map<String, String> =
+        wrap(StorageOperation.GET, "getByPrefix $prefix") { customStorage.getByPrefix(prefix) }
+
+    /** Multi-key variant of the wrapping above; the failing key is unknown, so none is reported. */
+    private inline fun <T> wrap(operation: StorageOperation, description: String, block: () -> T): T {
+        try {
+            return block()
+        } catch (e: WalletKitStorageException) {
+            Logger.e(TAG, "Custom storage $description failed", e)
+            throw e
+        } catch (e: UnsupportedOperationException) {
+            throw e
+        } catch (e: Exception) {
+            Logger.e(TAG, "Custom storage $description failed", e)
+            throw WalletKitStorageException(operation, null, e)
+        }
+    }
+
     private companion object {
         private const val TAG = LogConstants.TAG_CUSTOM_STORAGE
     }
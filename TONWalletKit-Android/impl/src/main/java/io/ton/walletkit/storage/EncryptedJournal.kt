@@ -0,0 +1,359 @@
+/*
+ * Copyright (c) 2025 TonTech
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+package io.ton.walletkit.storage
+
+import io.ton.walletkit.internal.constants.LogConstants
+import io.ton.walletkit.internal.util.Logger
+import java.io.Closeable
+import java.io.File
+import java.io.IOException
+import java.io.RandomAccessFile
+import java.nio.ByteBuffer
+import java.security.GeneralSecurityException
+import java.security.SecureRandom
+import javax.crypto.Cipher
+import javax.crypto.SecretKey
+import javax.crypto.spec.GCMParameterSpec
+
+/**
+ * Append-only key-value journal with every record encrypted on its own (AES-256-GCM).
+ *
+ * A write appends one record instead of rewriting the store, so its cost does not grow with the
+ * amount of data stored. An in-memory index maps each live key to its latest record; reads
+ * decrypt that record only. Removing a key prefix is a single record, too. Once superseded
+ * records outweigh live ones, [compact] copies the live records to a new file and swaps it in.
+ *
+ * Crash consistency: a record is written with one `write` call and survives process death once
+ * that returns; a write that fails partway is truncated away before the error propagates. On
+ * open, a torn tail left by a crash mid-write is cut off, so that loses at most the write in
+ * flight. Damaged bytes followed by authentic records are skipped instead, and the journal is
+ * rewritten without them, so no authenticated record is ever dropped. Compaction syncs the new file before renaming it over the old one, and a compaction
+ * file left behind by a crash is discarded.
+ *
+ * Layout: a header (magic, random journal id, and a GCM tag over both that checks [key]), then
+ * records of `length | iv | ciphertext`. The journal id is the associated data of every record.
+ *
+ * Thread-safe: every operation holds one lock, file I/O included.
+ *
+ * @param file Journal file; created if missing.
+ * @param key AES key the records are encrypted with.
+ * @param compactionMinBytes Journals smaller than this are never compacted automatically.
+ * @throws IOException if [file] is not a journal or was written with another key.
+ * @suppress Internal implementation class.
+ */
+internal class EncryptedJournal(
+    private val file: File,
+    private val key: SecretKey,
+    private val compactionMinBytes: Long = DEFAULT_COMPACTION_MIN_BYTES,
+) : Closeable {
+    private val lock = Any()
+    private val random = SecureRandom()
+    private val cipher = Cipher.getInstance(TRANSFORMATION)
+    private val index = HashMap<String, Location>()
+    private var liveBytes = 0L
+    private lateinit var header: ByteArray
+    private lateinit var journalId: ByteArray
+    private lateinit var raf: RandomAccessFile
+
+    /** True when [file] did not exist (or was empty) and this instance created it. */
+    val isNew: Boolean
+
+    init {
+        File(file.path + COMPACTION_SUFFIX).delete()
+        isNew = !file.exists() || file.length() == 0L
+        if (isNew) createEmpty()
+        open()
+    }
+
+    /** Current file size in bytes, superseded records included. */
+    val sizeBytes: Long
+        get() = synchronized(lock) { raf.length() }
+
+    /** Bytes taken by the latest record of every live key. */
+    val liveSizeBytes: Long
+        get() = synchronized(lock) { liveBytes }
+
+    fun get(key: String): String? = synchronized(lock) {
+        val location = index[key] ?: return null
+        val record = ByteArray(location.length)
+        raf.seek(location.offset)
+        raf.readFully(record)
+        val entry = decode(decrypt(record, 0, record.size))
+        entry.value
+    }
+
+    fun keys(prefix: String = ""): List<String> = synchronized(lock) {
+        index.keys.filter { it.startsWith(prefix) }
+    }
+
+    fun put(key: String, value: String) {
+        synchronized(lock) { append(Entry(OP_PUT, key, value)) }
+    }
+
+    fun remove(key: String) {
+        synchronized(lock) {
+            if (key in index) append(Entry(OP_REMOVE, key, null))
+        }
+    }
+
+    /** Removes every key starting with [prefix] with a single record; returns how many. */
+    fun removePrefix(prefix: String): Int = synchronized(lock) {
+        val count = index.keys.count { it.startsWith(prefix) }
+        if (count > 0) append(Entry(OP_REMOVE_PREFIX, prefix, null))
+        count
+    }
+
+    /** Rewrites the journal with live records only. */
+    fun compact() {
+        synchronized(lock) {
+            val target = File(file.path + COMPACTION_SUFFIX)
+            val compacted = HashMap<String, Location>(index.size)
+            RandomAccessFile(target, "rw").use { out ->
+                out.setLength(0)
+                out.write(header)
+                for ((key, location) in index) {
+                    val record = ByteArray(location.length)
+                    raf.seek(location.offset)
+                    raf.readFully(record)
+                    compacted[key] = Location(out.filePointer, location.length)
+                    out.write(record)
+                }
+                out.fd.sync()
+            }
+            raf.close()
+            if (!target.renameTo(file)) {
+                raf = RandomAccessFile(file, "rw")
+                throw IOException("Failed to replace journal with its compacted copy")
+            }
+            raf = RandomAccessFile(file, "rw")
+            index.clear()
+            index.putAll(compacted)
+        }
+    }
+
+    override fun close() {
+        synchronized(lock) { raf.close() }
+    }
+
+    private fun append(entry: Entry) {
+        val plaintext = encode(entry)
+        val iv = ByteArray(IV_BYTES).also(random::nextBytes)
+        cipher.init(Cipher.ENCRYPT_MODE, key, GCMParameterSpec(TAG_BITS, iv))
+        cipher.updateAAD(journalId)
+        val ciphertext = cipher.doFinal(plaintext)
+
+        val recordLength = IV_BYTES + ciphertext.size
+        val frame = ByteBuffer.allocate(LENGTH_BYTES + recordLength)
+            .putInt(recordLength)
+            .put(iv)
+            .put(ciphertext)
+            .array()
+        val offset = raf.length()
+        raf.seek(offset)
+        try {
+            raf.write(frame)
+        } catch (e: IOException) {
+            // Later records must not land behind a partial frame (a full disk mid-write).
+            try {
+                raf.setLength(offset)
+            } catch (truncate: IOException) {
+                e.addSuppressed(truncate)
+            }
+            throw e
+        }
+        apply(entry, Location(offset + LENGTH_BYTES, recordLength))
+
+        val size = offset + frame.size
+        if (size >= compactionMinBytes && size - header.size - liveBytes > liveBytes) {
+            try {
+                compact()
+            } catch (e: IOException) {
+                Logger.w(TAG, "Journal compaction failed, will retry on a later write", e)
+            }
+        }
+    }
+
+    private fun apply(entry: Entry, location: Location) {
+        when (entry.op) {
+            OP_PUT -> {
+                val previous = index.put(entry.key, location)
+                liveBytes += location.length - (previous?.length ?: 0)
+            }
+            OP_REMOVE -> index.remove(entry.key)?.let { liveBytes -= it.length }
+            OP_REMOVE_PREFIX -> {
+                val iterator = index.entries.iterator()
+                while (iterator.hasNext()) {
+                    val (key, previous) = iterator.next()
+                    if (key.startsWith(entry.key)) {
+                        liveBytes -= previous.length
+                        iterator.remove()
+                    }
+                }
+            }
+        }
+    }
+
+    private fun createEmpty() {
+        val id = ByteArray(ID_BYTES).also(random::nextBytes)
+        val iv = ByteArray(IV_BYTES).also(random::nextBytes)
+        cipher.init(Cipher.ENCRYPT_MODE, key, GCMParameterSpec(TAG_BITS, iv))
+        cipher.updateAAD(MAGIC)
+        cipher.updateAAD(id)
+        val check = cipher.doFinal()
+        RandomAccessFile(file, "rw").use { out ->
+            out.setLength(0)
+            out.write(MAGIC)
+            out.write(id)
+            out.write(iv)
+            out.write(check)
+            out.fd.sync()
+        }
+    }
+
+    private fun open() {
+        raf = RandomAccessFile(file, "rw")
+        val length = raf.length()
+        if (length < HEADER_BYTES) {
+            raf.close()
+            throw IOException("Journal header is truncated")
+        }
+        header = ByteArray(HEADER_BYTES).also(raf::readFully)
+        if (!header.copyOfRange(0, MAGIC.size).contentEquals(MAGIC)) {
+            raf.close()
+            throw IOException("Not a WalletKit journal")
+        }
+        journalId = header.copyOfRange(MAGIC.size, MAGIC.size + ID_BYTES)
+        try {
+            val ivOffset = MAGIC.size + ID_BYTES
+            cipher.init(Cipher.DECRYPT_MODE, key, GCMParameterSpec(TAG_BITS, header, ivOffset, IV_BYTES))
+            cipher.updateAAD(MAGIC)
+            cipher.updateAAD(journalId)
+            cipher.doFinal(header, ivOffset + IV_BYTES, TAG_BITS / 8)
+        } catch (e: GeneralSecurityException) {
+            raf.close()
+            throw WrongKeyException(e)
+        }
+        replay(length)
+    }
+
+    private fun replay(length: Long) {
+        var position = HEADER_BYTES.toLong()
+        // End of the last authenticated record, and damaged bytes skipped before it.
+        var end = position
+        var skipped = 0L
+        while (position + LENGTH_BYTES <= length) {
+            val record = readRecord(position, length)
+            if (record == null) {
+                // Not a record boundary: step over damaged bytes towards the next authentic record.
+                position++
+                continue
+            }
+            val (entry, location) = record
+            skipped += position - end
+            apply(entry, location)
+            position = location.offset + location.length
+            end = position
+        }
+        when {
+            skipped > 0 -> {
+                // Authentic records follow damaged ones: keep them, and rewrite without the damage.
+                Logger.e(TAG, "Skipped $skipped damaged bytes inside the journal, rewriting it")
+                compact()
+            }
+            end < length -> {
+                Logger.w(TAG, "Dropping ${length - end} bytes of torn journal tail")
+                raf.setLength(end)
+            }
+        }
+    }
+
+    /** The record framed at [position], or null unless one that passes authentication starts there. */
+    private fun readRecord(position: Long, length: Long): Pair<Entry, Location>? {
+        raf.seek(position)
+        val recordLength = raf.readInt()
+        val recordOffset = position + LENGTH_BYTES
+        if (recordLength < MIN_RECORD_BYTES || recordLength > length - recordOffset) return null
+        val record = ByteArray(recordLength).also(raf::readFully)
+        val entry = try {
+            decode(decrypt(record, 0, recordLength))
+        } catch (e: GeneralSecurityException) {
+            return null
+        }
+        return entry to Location(recordOffset, recordLength)
+    }
+
+    private fun decrypt(record: ByteArray, offset: Int, length: Int): ByteArray {
+        cipher.init(Cipher.DECRYPT_MODE, key, GCMParameterSpec(TAG_BITS, record, offset, IV_BYTES))
+        cipher.updateAAD(journalId)
+        return cipher.doFinal(record, offset + IV_BYTES, length - IV_BYTES)
+    }
+
+    /** The journal's header does not authenticate under the key it was opened with. */
+    class WrongKeyException(cause: Throwable) : IOException("Journal was written with a different key", cause)
+
+    private class Location(val offset: Long, val length: Int)
+
+    private class Entry(val op: Byte, val key: String, val value: String?)
+
+    private companion object {
+        private const val TAG = LogConstants.TAG_JOURNAL_STORAGE
+        private const val TRANSFORMATION = "AES/GCM/NoPadding"
+        private val MAGIC = byteArrayOf('W'.code.toByte(), 'K'.code.toByte(), 'J'.code.toByte(), 1)
+        private const val ID_BYTES = 16
+        private const val IV_BYTES = 12
+        private const val TAG_BITS = 128
+        private const val LENGTH_BYTES = 4
+        private val HEADER_BYTES = MAGIC.size + ID_BYTES + IV_BYTES + TAG_BITS / 8
+        private const val MIN_RECORD_BYTES = IV_BYTES + TAG_BITS / 8 + 1 + 4
+        private const val COMPACTION_SUFFIX = ".compact"
+        private const val DEFAULT_COMPACTION_MIN_BYTES = 256L * 1024
+
+        private const val OP_PUT: Byte = 1
+        private const val OP_REMOVE: Byte = 2
+        private const val OP_REMOVE_PREFIX: Byte = 3
+
+        /** `op | key length | key | value`, all UTF-8. */
+        private fun encode(entry: Entry): ByteArray {
+            val key = entry.key.encodeToByteArray()
+            val value = entry.value?.encodeToByteArray() ?: ByteArray(0)
+            return ByteBuffer.allocate(1 + 4 + key.size + value.size)
+                .put(entry.op)
+                .putInt(key.size)
+                .put(key)
+                .put(value)
+                .array()
+        }
+
+        private fun decode(plaintext: ByteArray): Entry {
+            val buffer = ByteBuffer.wrap(plaintext)
+            val op = buffer.get()
+            val keyLength = buffer.getInt()
+            val key = String(plaintext, 5, keyLength, Charsets.UTF_8)
+            val value = if (op == OP_PUT) {
+                String(plaintext, 5 + keyLength, plaintext.size - 5 - keyLength, Charsets.UTF_8)
+            } else {
+                null
+            }
+            return Entry(op, key, value)
+        }
+    }
+}
@@ -0,0 +1,245 @@
+/*
+ * Copyright (c) 2025 TonTech
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+package io.ton.walletkit.storage
+
+import android.content.Context
+import android.security.keystore.KeyGenParameterSpec
+import android.security.keystore.KeyProperties
+import io.ton.walletkit.exceptions.SecureStorageException
+import io.ton.walletkit.internal.constants.LogConstants
+import io.ton.walletkit.internal.constants.StorageConstants
+import io.ton.walletkit.internal.util.Logger
+import kotlinx.coroutines.Dispatchers
+import kotlinx.coroutines.sync.Mutex
+import kotlinx.coroutines.sync.withLock
+import kotlinx.coroutines.withContext
+import java.io.File
+import java.io.IOException
+import java.security.KeyStore
+import java.security.SecureRandom
+import javax.crypto.AEADBadTagException
+import javax.crypto.Cipher
+import javax.crypto.KeyGenerator
+import javax.crypto.SecretKey
+import javax.crypto.spec.GCMParameterSpec
+import javax.crypto.spec.SecretKeySpec
+
+/**
+ * BridgeStorageAdapter backed by an [EncryptedJournal].
+ *
+ * Writes append one encrypted record instead of re-encrypting a whole preferences file, and
+ * [clear] is a single prefix-removal record rather than a decrypt of every key.
+ *
+ * Security:
+ * - Every record is encrypted with AES-256-GCM under a data key kept only in memory
+ * - The data key is stored wrapped by a non-exportable Android Keystore key
+ * - Journal and key live in the no-backup directory, so they are never restored to a device
+ *   without the Keystore key
+ *
+ * Until an import has succeeded, bridge data already stored by [SecureBridgeStorageAdapter] is
+ * copied into the journal on open, so switching storage types keeps sessions.
+ *
+ * Keystore and I/O failures while opening surface as [SecureStorageException] and are retried on
+ * the next call. Only a data key that no longer authenticates starts a new journal, and the
+ * unreadable files are moved aside rather than deleted.
+ *
+ * @suppress This is an internal implementation class.
+ */
+internal class JournaledBridgeStorageAdapter(
+    context: Context,
+) : BridgeStorageAdapter {
+    private val appContext = context.applicationContext
+
+    private val openMutex = Mutex()
+
+    @Volatile private var opened: EncryptedJournal? = null
+
+    override suspend fun get(key: String): String? = withContext(Dispatchers.IO) {
+        try {
+            journal().get(bridgeKey(key))
+        } catch (e: Exception) {
+            Logger.e(TAG, ERROR_FAILED_GET_RAW_VALUE + key, e)
+            throw SecureStorageException.GetFailed(cause = e)
+        }
+    }
+
+    override suspend fun set(
+        key: String,
+        value: String,
+    ) {
+        withContext(Dispatchers.IO) {
+            try {
+                journal().put(bridgeKey(key), value)
+            } catch (e: Exception) {
+                Logger.e(TAG, ERROR_FAILED_SET_RAW_VALUE + key, e)
+                throw SecureStorageException.SaveFailed(cause = e)
+            }
+        }
+    }
+
+    override suspend fun remove(key: String) {
+        withContext(Dispatchers.IO) {
+            try {
+                journal().remove(bridgeKey(key))
+            } catch (e: Exception) {
+                Logger.e(TAG, ERROR_FAILED_REMOVE_RAW_VALUE + key, e)
+                throw SecureStorageException.DeleteFailed(cause = e)
+            }
+        }
+    }
+
+    override suspend fun clear() {
+        withContext(Dispatchers.IO) {
+            try {
+                val removed = journal().removePrefix(StorageConstants.KEY_PREFIX_BRIDGE)
+                Logger.d(TAG, "Cleared $removed bridge storage keys")
+            } catch (e: Exception) {
+                Logger.e(TAG, ERROR_FAILED_CLEAR_BRIDGE_DATA, e)
+                throw SecureStorageException.ClearFailed(cause = e)
+            }
+        }
+    }
+
+    override suspend fun getByPrefix(prefix: String): Map<String, String> = withContext(Dispatchers.IO) {
+        try {
+            val journal = journal()
+            buildMap {
+                for (key in journal.keys(bridgeKey(prefix))) {
+                    journal.get(key)?.let { put(key.removePrefix(StorageConstants.KEY_PREFIX_BRIDGE), it) }
+                }
+            }
+        } catch (e: Exception) {
+            Logger.e(TAG, ERROR_FAILED_GET_RAW_VALUE + prefix, e)
+            throw SecureStorageException.GetFailed(cause = e)
+        }
+    }
+
+    private fun bridgeKey(key: String) = StorageConstants.KEY_PREFIX_BRIDGE + key
+
+    private suspend fun journal(): EncryptedJournal =
+        opened ?: openMutex.withLock { opened ?: openJournal().also { opened = it } }
+
+    private suspend fun openJournal(): EncryptedJournal {
+        val directory = appContext.noBackupFilesDir
+        val file = File(directory, StorageConstants.BRIDGE_JOURNAL_FILE_NAME)
+        val keyFile = File(directory, StorageConstants.BRIDGE_JOURNAL_KEY_FILE_NAME)
+        // Only a key that provably no longer authenticates starts a new journal; anything else may be
+        // transient and is reported so the next call retries. Unreadable files are kept aside.
+        val dataKey = try {
+            loadOrCreateDataKey(keyFile)
+        } catch (e: AEADBadTagException) {
+            Logger.e(TAG, "Journal key no longer matches its Keystore key, starting a new journal", e)
+            moveAside(keyFile)
+            moveAside(file)
+            loadOrCreateDataKey(keyFile)
+        }
+        val journal = try {
+            EncryptedJournal(file, dataKey)
+        } catch (e: EncryptedJournal.WrongKeyException) {
+            Logger.e(TAG, "Journal does not match its key, starting a new one", e)
+            moveAside(file)
+            EncryptedJournal(file, dataKey)
+        }
+        try {
+            if (journal.get(StorageConstants.BRIDGE_JOURNAL_MIGRATED_KEY) == null) {
+                migrateFromSharedPreferences(journal)
+                journal.put(StorageConstants.BRIDGE_JOURNAL_MIGRATED_KEY, "1")
+            }
+        } catch (e: Exception) {
+            journal.close()
+            throw e
+        }
+        return journal
+    }
+
+    private fun moveAside(file: File) {
+        if (!file.exists()) return
+        val aside = File(file.path + ".unreadable-" + System.currentTimeMillis())
+        if (!file.renameTo(aside)) throw IOException("Failed to move ${file.name} aside")
+        Logger.w(TAG, "Moved ${file.name} to ${aside.name}")
+    }
+
+    /** Copies bridge data from encrypted preferences. Failures propagate so the import is retried. */
+    private suspend fun migrateFromSharedPreferences(journal: EncryptedJournal) {
+        val prefsFile = File(appContext.filesDir.parentFile, "shared_prefs/${StorageConstants.BRIDGE_STORAGE_NAME}.xml")
+        if (!prefsFile.exists()) return
+        val values = SecureWalletKitStorage(appContext, StorageConstants.BRIDGE_STORAGE_NAME)
+            .getRawValues(StorageConstants.KEY_PREFIX_BRIDGE)
+        values.forEach { (key, value) -> journal.put(key, value) }
+        Logger.d(TAG, "Migrated ${values.size} keys from encrypted preferences")
+    }
+
+    companion object {
+        private const val TAG = LogConstants.TAG_JOURNAL_STORAGE
+        private const val ANDROID_KEYSTORE = "AndroidKeyStore"
+        private const val WRAP_TRANSFORMATION = "AES/GCM/NoPadding"
+        private const val DATA_KEY_BYTES = 32
+
+        // Storage Errors
+        const val ERROR_FAILED_GET_RAW_VALUE = "Failed to get raw value: "
+        const val ERROR_FAILED_SET_RAW_VALUE = "Failed to set raw value: "
+        const val ERROR_FAILED_REMOVE_RAW_VALUE = "Failed to remove raw value: "
+        const val ERROR_FAILED_CLEAR_BRIDGE_DATA = "Failed to clear bridge data"
+
+        /**
+         * Returns the journal's data key, generating it on first use. [keyFile] holds
+         * `iv length | iv | wrapped key`, wrapped by the Keystore key.
+         */
+        private fun loadOrCreateDataKey(keyFile: File): SecretKey {
+            val wrappingKey = wrappingKey()
+            val cipher = Cipher.getInstance(WRAP_TRANSFORMATION)
+            if (keyFile.exists()) {
+                val stored = keyFile.readBytes()
+                val ivLength = stored[0].toInt()
+                cipher.init(Cipher.DECRYPT_MODE, wrappingKey, GCMParameterSpec(128, stored, 1, ivLength))
+                val raw = cipher.doFinal(stored, 1 + ivLength, stored.size - 1 - ivLength)
+                return SecretKeySpec(raw, KeyProperties.KEY_ALGORITHM_AES)
+            }
+
+            val raw = ByteArray(DATA_KEY_BYTES).also(SecureRandom()::nextBytes)
+            cipher.init(Cipher.ENCRYPT_MODE, wrappingKey)
+            val wrapped = cipher.doFinal(raw)
+            val iv = cipher.iv
+            val temp = File(keyFile.path + ".tmp")
+            temp.writeBytes(byteArrayOf(iv.size.toByte()) + iv + wrapped)
+            if (!temp.renameTo(keyFile)) throw IOException("Failed to store journal key")
+            return SecretKeySpec(raw, KeyProperties.KEY_ALGORITHM_AES)
+        }
+
+        private fun wrappingKey(): SecretKey {
+            val keyStore = KeyStore.getInstance(ANDROID_KEYSTORE).apply { load(null) }
+            (keyStore.getKey(StorageConstants.BRIDGE_JOURNAL_KEYSTORE_KEY, null) as? SecretKey)?.let { return it }
+            val generator = KeyGenerator.getInstance(KeyProperties.KEY_ALGORITHM_AES, ANDROID_KEYSTORE)
+            generator.init(
+                KeyGenParameterSpec.Builder(
+                    StorageConstants.BRIDGE_JOURNAL_KEYSTORE_KEY,
+                    KeyProperties.PURPOSE_ENCRYPT or KeyProperties.PURPOSE_DECRYPT,
+                )
+                    .setBlockModes(KeyProperties.BLOCK_MODE_GCM)
+                    .setEncryptionPaddings(KeyProperties.ENCRYPTION_PADDING_NONE)
+                    .setKeySize(256)
+                    .build(),
+            )
+            return generator.generateKey()
+        }
+    }
+}
@@ -58,6 +58,9 @@ internal class MemoryBridgeStorageAdapter : BridgeStorageAdapter {
         storage.clear()
     }
 
+    override suspend fun getByPrefix(prefix: String): Map<String, String> =
+        storage.filterKeys { it.startsWith(prefix) }
+
     private companion object {
         private const val TAG = LogConstants.TAG_MEMORY_STORAGE
     }
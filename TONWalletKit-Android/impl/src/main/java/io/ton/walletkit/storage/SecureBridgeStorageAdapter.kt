@@ -97,6 +97,38 @@ internal class SecureBridgeStorageAdapter(
         }
     }
 
+    override suspend fun setMany(values: Map<String, String>) {
+        withContext(Dispatchers.IO) {
+            try {
+                secureStorage.setRawValues(values.mapKeys { bridgeKey(it.key) })
+            } catch (e: Exception) {
+                Logger.e(TAG, ERROR_FAILED_SET_RAW_VALUE + values.keys, e)
+                throw SecureStorageException.SaveFailed(cause = e)
+            }
+        }
+    }
+
+    override suspend fun removeMany(keys: Collection<String>) {
+        withContext(Dispatchers.IO) {
+            try {
+                secureStorage.removeRawValues(keys.map(::bridgeKey))
+            } catch (e: Exception) {
+                Logger.e(TAG, ERROR_FAILED_REMOVE_RAW_VALUE + keys, e)
+                throw SecureStorageException.DeleteFailed(cause = e)
+            }
+        }
+    }
+
+    override suspend fun getByPrefix(prefix: String): Map<String, String> = withContext(Dispatchers.IO) {
+        try {
+            secureStorage.getRawValues(bridgeKey(prefix))
+                .mapKeys { it.key.removePrefix(StorageConstants.KEY_PREFIX_BRIDGE) }
+        } catch (e: Exception) {
+            Logger.e(TAG, ERROR_FAILED_GET_RAW_VALUE + prefix, e)
+            throw SecureStorageException.GetFailed(cause = e)
+        }
+    }
+
     private fun bridgeKey(key: String) = StorageConstants.KEY_PREFIX_BRIDGE + key
 
     companion object {
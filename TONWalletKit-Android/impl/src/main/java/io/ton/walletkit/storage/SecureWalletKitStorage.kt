@@ -123,6 +123,40 @@ internal class SecureWalletKitStorage(
         }
     }
 
+    /**
+     * Set several raw values in one encrypted-preferences commit.
+     * @param values Keys and the values to store
+     */
+    suspend fun setRawValues(values: Map<String, String>) {
+        withContext(Dispatchers.IO) {
+            try {
+                encryptedPrefs.edit {
+                    values.forEach { (key, value) -> putString(key, value) }
+                }
+            } catch (e: Exception) {
+                Logger.e(TAG, ERROR_FAILED_SET_RAW_VALUE + values.keys, e)
+                throw e
+            }
+        }
+    }
+
+    /**
+     * Remove several raw values in one encrypted-preferences commit.
+     * @param keys The storage keys to remove
+     */
+    suspend fun removeRawValues(keys: Collection<String>) {
+        withContext(Dispatchers.IO) {
+            try {
+                encryptedPrefs.edit {
+                    keys.forEach { remove(it) }
+                }
+            } catch (e: Exception) {
+                Logger.e(TAG, ERROR_FAILED_REMOVE_RAW_VALUE + keys, e)
+                throw e
+            }
+        }
+    }
+
     /**
      * Remove a raw value from encrypted storage (used by BridgeStorageAdapter).
      * @param key The storage key to remove
@@ -139,6 +173,18 @@ internal class SecureWalletKitStorage(
         }
     }
 
+    /**
+     * Read every raw value whose key starts with [prefix], e.g. to migrate them elsewhere.
+     * @param prefix Key prefix to match
+     * @return Matching keys and their values
+     */
+    suspend fun getRawValues(prefix: String): Map<String, String> = withContext(Dispatchers.IO) {
+        encryptedPrefs.all
+            .filterKeys { it.startsWith(prefix) }
+            .mapNotNull { (key, value) -> (value as? String)?.let { key to it } }
+            .toMap()
+    }
+
     /**
      * Clear all bridge-related data from storage (keys starting with bridge: prefix).
      */
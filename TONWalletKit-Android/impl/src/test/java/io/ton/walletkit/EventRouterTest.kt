@@ -27,6 +27,7 @@ import io.ton.walletkit.api.generated.TONDisconnectionEventPreview
 import io.ton.walletkit.engine.state.EventRouter
 import io.ton.walletkit.event.TONWalletKitEvent
 import io.ton.walletkit.listener.TONBridgeEventsHandler
+import kotlinx.coroutines.Dispatchers
 import kotlinx.coroutines.test.runTest
 import org.junit.Assert.*
 import org.junit.Before
@@ -62,7 +63,8 @@ class EventRouterTest {
 
     @Before
     fun setup() {
-        eventRouter = EventRouter()
+        // Unconfined delivers each posted event before post returns.
+        eventRouter = EventRouter(defaultDispatcher = Dispatchers.Unconfined)
         receivedEvents.clear()
     }
 
@@ -89,7 +91,7 @@ class EventRouterTest {
     // ===== Scenario 11: Duplicate event with same event ID =====
 
     @Test
-    fun `dispatchEvent - duplicate events with same ID both delivered`() = runTest {
+    fun `post - duplicate events with same ID both delivered`() = runTest {
         val handler = object : TONBridgeEventsHandler {
             val events = mutableListOf<TONWalletKitEvent>()
             override fun handle(event: TONWalletKitEvent) {
@@ -104,8 +106,8 @@ class EventRouterTest {
         val event2 = createDisconnectEvent("session-1")
 
         // Dispatch same event ID twice
-        eventRouter.dispatchEvent("event-1", "disconnect", event1)
-        eventRouter.dispatchEvent("event-1", "disconnect", event2)
+        eventRouter.post("event-1", "disconnect", event1)
+        eventRouter.post("event-1", "disconnect", event2)
 
         // Both should be delivered (no deduplication)
         assertEquals(2, handler.events.size)
@@ -114,7 +116,7 @@ class EventRouterTest {
     // ===== Scenario 12: Events arrive in rapid succession (flooding) =====
 
     @Test
-    fun `dispatchEvent - flooding with 100+ events handles all`() = runTest {
+    fun `post - flooding with 100+ events handles all`() = runTest {
         val counter = AtomicInteger(0)
         val handler = object : TONBridgeEventsHandler {
             override fun handle(event: TONWalletKitEvent) {
@@ -127,7 +129,7 @@ class EventRouterTest {
         // Flood with 200 events
         repeat(200) { i ->
             val event = createDisconnectEvent("session-$i")
-            eventRouter.dispatchEvent("event-$i", "disconnect", event)
+            eventRouter.post("event-$i", "disconnect", event)
         }
 
         // All 200 events should be processed
@@ -137,12 +139,12 @@ class EventRouterTest {
     // ===== Scenario 13: Event arrives before handler registered =====
 
     @Test
-    fun `dispatchEvent - event dispatched before any handler added`() = runTest {
+    fun `post - event dispatched before any handler added`() = runTest {
         // No handler registered yet
         val event = createDisconnectEvent("session-1")
 
         // Should not crash, just no-op
-        eventRouter.dispatchEvent("event-1", "disconnect", event)
+        eventRouter.post("event-1", "disconnect", event)
 
         // Now add handler
         eventRouter.addHandler(testHandler)
@@ -154,7 +156,7 @@ class EventRouterTest {
     // ===== Scenario 14: Event arrives after handler removed =====
 
     @Test
-    fun `dispatchEvent - after handler removed does not deliver`() = runTest {
+    fun `post - after handler removed does not deliver`() = runTest {
         eventRouter.addHandler(testHandler)
 
         // Remove handler immediately
@@ -162,7 +164,7 @@ class EventRouterTest {
 
         // Dispatch event
         val event = createDisconnectEvent("session-1")
-        eventRouter.dispatchEvent("event-1", "disconnect", event)
+        eventRouter.post("event-1", "disconnect", event)
 
         // Handler should not receive event
         assertEquals(0, receivedEvents.size)
@@ -171,7 +173,7 @@ class EventRouterTest {
     // ===== Scenario 15: Handler throws exception during event processing =====
 
     @Test
-    fun `dispatchEvent - handler exception is caught and logged`() = runTest {
+    fun `post - handler exception is caught and logged`() = runTest {
         val throwingHandler = object : TONBridgeEventsHandler {
             override fun handle(event: TONWalletKitEvent) {
                 throw RuntimeException("Handler crashed!")
@@ -183,7 +185,7 @@ class EventRouterTest {
         val event = createDisconnectEvent("session-1")
 
         // Should not propagate exception
-        eventRouter.dispatchEvent("event-1", "disconnect", event)
+        eventRouter.post("event-1", "disconnect", event)
 
         // No exception thrown - it's caught and logged
     }
@@ -191,7 +193,7 @@ class EventRouterTest {
     // ===== Scenario 16: Multiple handlers with one throwing exception =====
 
     @Test
-    fun `dispatchEvent - one handler fails but others still receive event`() = runTest {
+    fun `post - one handler fails but others still receive event`() = runTest {
         val handler1Events = mutableListOf<TONWalletKitEvent>()
         val handler2Events = mutableListOf<TONWalletKitEvent>()
         val handler3Events = mutableListOf<TONWalletKitEvent>()
@@ -220,7 +222,7 @@ class EventRouterTest {
 
         val event = createDisconnectEvent("session-1")
 
-        eventRouter.dispatchEvent("event-1", "disconnect", event)
+        eventRouter.post("event-1", "disconnect", event)
 
         // Handler 1 and 3 should receive event despite handler 2 throwing
         assertEquals(1, handler1Events.size)
@@ -234,7 +236,7 @@ class EventRouterTest {
     // ===== Scenario 20: Event arrives after SDK destroyed =====
 
     @Test
-    fun `dispatchEvent - after all handlers removed behaves gracefully`() = runTest {
+    fun `post - after all handlers removed behaves gracefully`() = runTest {
         eventRouter.addHandler(testHandler)
         eventRouter.removeHandler(testHandler)
 
@@ -242,7 +244,7 @@ class EventRouterTest {
         val event = createDisconnectEvent("session-1")
 
         // Should not crash, just no-op
-        eventRouter.dispatchEvent("event-1", "disconnect", event)
+        eventRouter.post("event-1", "disconnect", event)
 
         assertEquals(0, receivedEvents.size)
     }
@@ -264,7 +266,7 @@ class EventRouterTest {
 
         // Dispatch event - should only be called once
         val event = createDisconnectEvent("session-1")
-        eventRouter.dispatchEvent("event-1", "disconnect", event)
+        eventRouter.post("event-1", "disconnect", event)
 
         assertEquals(1, receivedEvents.size)
     }
@@ -307,7 +309,7 @@ class EventRouterTest {
 
         val event = createDisconnectEvent("session-1")
 
-        eventRouter.dispatchEvent("event-1", "disconnect", event)
+        eventRouter.post("event-1", "disconnect", event)
 
         assertEquals(1, events1.size)
         assertEquals(1, events2.size)
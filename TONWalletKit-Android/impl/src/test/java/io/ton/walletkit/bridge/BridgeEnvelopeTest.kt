@@ -0,0 +1,99 @@
+/*
+ * Copyright (c) 2025 TonTech
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+package io.ton.walletkit.bridge
+
+import kotlinx.serialization.Serializable
+import kotlinx.serialization.json.Json
+import kotlinx.serialization.json.double
+import kotlinx.serialization.json.jsonObject
+import kotlinx.serialization.json.jsonPrimitive
+import org.junit.Assert.assertEquals
+import org.junit.Assert.assertFalse
+import org.junit.Assert.assertNull
+import org.junit.Assert.assertTrue
+import org.junit.Test
+
+class BridgeEnvelopeTest {
+
+    @Serializable
+    data class Balance(val amount: String, val items: List<Int>)
+
+    @Test
+    fun parse_readsHeaderAndKeepsResultRaw() {
+        val text = """{ "kind":"response", "id": 42, "result" : {"amount":"1,}]\"x","items":[1,[2],{"a":3}]} }"""
+
+        val envelope = BridgeEnvelope.parse(text)
+
+        assertEquals("response", envelope.kind)
+        assertEquals(42, envelope.intId)
+        assertNull(envelope.method)
+        assertEquals("""{"amount":"1,}]\"x","items":[1,[2],{"a":3}]}""", envelope.rawValue("result"))
+        assertEquals(Json.parseToJsonElement(text).jsonObject, envelope.toJsonObject(Json))
+    }
+
+    @Test
+    fun parse_stringIdAndEscapedHeader() {
+        val envelope = BridgeEnvelope.parse("""{"kind":"request","id":"abc","method":"signWith","params":null}""")
+
+        assertEquals("abc", envelope.id)
+        assertNull(envelope.intId)
+        assertEquals("signWith", envelope.method)
+        assertEquals("null", envelope.rawValue("params"))
+        assertFalse(envelope.has("result"))
+    }
+
+    @Test
+    fun parse_literalValues() {
+        val envelope = BridgeEnvelope.parse("""{"a":true,"b":-1.5e3,"c":null,"bin":2}""")
+
+        assertEquals("true", envelope.rawValue("a"))
+        assertEquals(-1500.0, envelope.element("b", Json)!!.jsonPrimitive.double, 0.0)
+        assertEquals("2", envelope.rawValue("bin"))
+        assertNull(envelope.id)
+    }
+
+    @Test
+    fun parse_malformed_throwsIllegalArgument() {
+        listOf("", "[]", """{"kind":"response"""", """{"a":1}x""", """{"a":}""", """{"a" 1}""").forEach { text ->
+            val error = runCatching { BridgeEnvelope.parse(text) }.exceptionOrNull()
+            assertTrue("expected failure for '$text'", error is IllegalArgumentException)
+        }
+    }
+
+    @Test
+    fun decodeFromBridge_payloadText_decodesDirectly() {
+        val payload = BridgePayload.ofText(Json, """{"amount":"10","items":[1,2]}""")
+
+        assertEquals(Balance("10", listOf(1, 2)), Json.decodeFromBridge<Balance>(payload))
+        assertEquals("7", Json.decodeFromBridge<String>(BridgePayload.ofText(Json, "\"7\"")))
+        assertNull(Json.decodeFromBridgeOrNull<Balance>(BridgePayload.ofText(Json, "null")))
+        assertNull(Json.decodeFromBridgeOrNull<Balance>(BridgePayload.NULL))
+    }
+
+    @Test
+    fun decodeFromBridge_malformedText_throwsConversionError() {
+        val error = runCatching { Json.decodeFromBridge<Balance>(BridgePayload.ofText(Json, """{"amount":1""")) }
+            .exceptionOrNull()
+
+        assertTrue(error is BridgeConversionError.UnableToDecode)
+    }
+}
@@ -0,0 +1,70 @@
+/*
+ * Copyright (c) 2025 TonTech
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+package io.ton.walletkit.bridge.dispatch
+
+import kotlinx.coroutines.runBlocking
+import kotlinx.serialization.Serializable
+import kotlinx.serialization.json.Json
+import kotlinx.serialization.json.JsonPrimitive
+import kotlinx.serialization.json.buildJsonArray
+import kotlinx.serialization.json.buildJsonObject
+import kotlinx.serialization.json.put
+import org.junit.Assert.assertEquals
+import org.junit.Test
+
+class BridgeRequestRegistryTest {
+
+    @Serializable
+    data class EchoRequest(val value: String)
+
+    @Serializable
+    data class Quote(val amount: String, val hops: Int)
+
+    @Test
+    fun registerTypedJson_returnsStructuredResult() = runBlocking {
+        val registry = BridgeRequestRegistry(Json).apply {
+            registerTypedJson<EchoRequest, Quote>("quote") { Quote(it.value, 2) }
+            registerTypedJson<EchoRequest, String>("sign") { "0x" + it.value }
+        }
+        val params = buildJsonObject { put("value", "ab") }
+
+        assertEquals(
+            buildJsonObject {
+                put("amount", "ab")
+                put("hops", 2)
+            },
+            registry.dispatch("quote", params),
+        )
+        // Strings stay plain values rather than nested JSON text.
+        assertEquals(JsonPrimitive("0xab"), registry.dispatch("sign", params))
+    }
+
+    @Test
+    fun wrappedFunction_returnsStructuredResult() = runBlocking {
+        val functions = WrappedFunctionRegistry(Json)
+        val ref = functions.registerTyped<String, Quote> { Quote(it, 1) }
+
+        val result = functions.invoke(ref, buildJsonArray { add(JsonPrimitive("x")) })
+
+        assertEquals(Json.encodeToJsonElement(Quote.serializer(), Quote("x", 1)), result)
+    }
+}
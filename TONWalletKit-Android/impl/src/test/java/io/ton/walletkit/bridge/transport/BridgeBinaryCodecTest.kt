@@ -0,0 +1,70 @@
+/*
+ * Copyright (c) 2025 TonTech
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+package io.ton.walletkit.bridge.transport
+
+import org.junit.Assert.assertArrayEquals
+import org.junit.Assert.assertEquals
+import org.junit.Test
+
+/**
+ * Tests for [BridgeBinaryCodec]: header layout, round-trips, and truncated input.
+ */
+class BridgeBinaryCodecTest {
+
+    @Test
+    fun encodeDecode_roundTripsAttachments() {
+        val payloads = listOf(byteArrayOf(1, 2, 3), ByteArray(0), ByteArray(300) { it.toByte() })
+
+        val decoded = BridgeBinaryCodec.decode(BridgeBinaryCodec.encode("call-42", payloads))
+
+        assertEquals("call-42", decoded.id)
+        assertEquals(payloads.size, decoded.payloads.size)
+        payloads.indices.forEach { assertArrayEquals(payloads[it], decoded.payloads[it]) }
+    }
+
+    @Test
+    fun encode_writesBigEndianHeader() {
+        val message = BridgeBinaryCodec.encode("a", listOf(byteArrayOf(9, 8)))
+
+        assertArrayEquals(
+            byteArrayOf(BridgeBinaryCodec.MAGIC, 1, 'a'.code.toByte(), 1, 0, 0, 0, 2, 9, 8),
+            message,
+        )
+    }
+
+    @Test(expected = IllegalArgumentException::class)
+    fun encode_noAttachments_throws() {
+        BridgeBinaryCodec.encode("a", emptyList())
+    }
+
+    @Test(expected = IllegalArgumentException::class)
+    fun decode_wrongMagic_throws() {
+        BridgeBinaryCodec.decode(byteArrayOf(0, 1, 'a'.code.toByte(), 0))
+    }
+
+    @Test(expected = IllegalArgumentException::class)
+    fun decode_truncatedPayload_throws() {
+        val message = BridgeBinaryCodec.encode("a", listOf(ByteArray(16)))
+
+        BridgeBinaryCodec.decode(message.copyOf(message.size - 4))
+    }
+}
@@ -0,0 +1,102 @@
+/*
+ * Copyright (c) 2025 TonTech
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+package io.ton.walletkit.bridge.transport
+
+import org.junit.Assert.assertEquals
+import org.junit.Assert.assertFalse
+import org.junit.Assert.assertTrue
+import org.junit.Test
+
+/**
+ * Tests for [BridgeFrameCodec]: frame round-trips, budget-driven packing, and malformed input.
+ */
+class BridgeFrameCodecTest {
+
+    @Test
+    fun encodeDecode_roundTripsEnvelopes() {
+        val envelopes = listOf(
+            """{"kind":"response","id":"1","result":{}}""",
+            """{"kind":"event","event":{"type":"x","data":"a:b:c"}}""",
+            """{"kind":"response","id":"2","result":"ünïcødé ✓"}""",
+            "",
+        )
+
+        val frame = BridgeFrameCodec.encode(envelopes)
+        val decoded = mutableListOf<String>()
+        val count = BridgeFrameCodec.decode(frame) { decoded.add(it) }
+
+        assertTrue(BridgeFrameCodec.isFrame(frame))
+        assertEquals(envelopes.size, count)
+        assertEquals(envelopes, decoded)
+    }
+
+    @Test
+    fun isFrame_plainEnvelope_returnsFalse() {
+        assertFalse(BridgeFrameCodec.isFrame("""{"kind":"ready"}"""))
+        assertFalse(BridgeFrameCodec.isFrame(""))
+    }
+
+    @Test
+    fun pack_singleEnvelope_isSentUnframed() {
+        val envelope = """{"kind":"call","id":"1"}"""
+
+        assertEquals(listOf(envelope), BridgeFrameCodec.pack(listOf(envelope), 1024))
+    }
+
+    @Test
+    fun pack_splitsGroupsAtBudget() {
+        val envelope = "{" + "x".repeat(98) + "}"
+        val envelopes = List(10) { envelope }
+
+        val messages = BridgeFrameCodec.pack(envelopes, 350)
+
+        // Each record costs 108 units, so three fit per 350-unit frame.
+        assertEquals(4, messages.size)
+        assertTrue(messages.take(3).all { BridgeFrameCodec.isFrame(it) && it.length <= 350 })
+        assertEquals(envelope, messages.last())
+        val decoded = mutableListOf<String>()
+        messages.forEach { message ->
+            if (BridgeFrameCodec.isFrame(message)) BridgeFrameCodec.decode(message) { decoded.add(it) } else decoded.add(message)
+        }
+        assertEquals(envelopes, decoded)
+    }
+
+    @Test
+    fun pack_oversizedEnvelope_getsItsOwnMessage() {
+        val small = """{"a":1}"""
+        val large = "{" + "y".repeat(500) + "}"
+
+        val messages = BridgeFrameCodec.pack(listOf(small, large, small), 64)
+
+        assertEquals(listOf(small, large, small), messages)
+    }
+
+    @Test(expected = IllegalArgumentException::class)
+    fun decode_truncatedRecord_throws() {
+        BridgeFrameCodec.decode("\u001E10:{\"a\":1}") {}
+    }
+
+    @Test(expected = IllegalArgumentException::class)
+    fun decode_missingLength_throws() {
+        BridgeFrameCodec.decode("\u001E{\"a\":1}") {}
+    }
+}
@@ -0,0 +1,136 @@
+/*
+ * Copyright (c) 2025 TonTech
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+package io.ton.walletkit.core
+
+import io.mockk.coEvery
+import io.mockk.coVerifyOrder
+import io.mockk.every
+import io.mockk.mockk
+import io.ton.walletkit.ITONWalletKit
+import io.ton.walletkit.api.MAINNET
+import io.ton.walletkit.api.TESTNET
+import io.ton.walletkit.api.generated.TONDAppInfo
+import io.ton.walletkit.api.generated.TONDisconnectionEvent
+import io.ton.walletkit.api.generated.TONDisconnectionEventPreview
+import io.ton.walletkit.api.generated.TONNetwork
+import io.ton.walletkit.engine.WalletKitEngine
+import io.ton.walletkit.engine.model.WalletAccount
+import io.ton.walletkit.event.TONWalletKitEvent
+import io.ton.walletkit.listener.TONBridgeEventsHandler
+import io.ton.walletkit.model.TONUserFriendlyAddress
+import kotlinx.coroutines.test.runTest
+import org.junit.Assert.assertEquals
+import org.junit.Assert.assertNull
+import org.junit.Test
+
+/**
+ * Kits sharing one engine across networks see only their own wallets and events.
+ */
+class SharedEngineScopeTest {
+
+    private val walletNetworks = mapOf(
+        MAINNET_WALLET to TONNetwork.MAINNET,
+        TESTNET_WALLET to TONNetwork.TESTNET,
+    )
+
+    @Test
+    fun scopedHandler_dropsEventsOfOtherNetworksWallets() {
+        val received = mutableListOf<String?>()
+        val handler = NetworkScopedEventsHandler(
+            delegate = object : TONBridgeEventsHandler {
+                override fun handle(event: TONWalletKitEvent) {
+                    received.add((event as TONWalletKitEvent.Disconnect).event.walletId)
+                }
+            },
+            networks = setOf(TONNetwork.MAINNET),
+            networkOf = walletNetworks::get,
+        )
+
+        handler.handle(disconnect(MAINNET_WALLET))
+        handler.handle(disconnect(TESTNET_WALLET))
+        handler.handle(disconnect("unknown"))
+        handler.handle(disconnect(null))
+
+        assertEquals(listOf(MAINNET_WALLET, "unknown", null), received)
+    }
+
+    @Test
+    fun sharedKit_listsOnlyItsOwnNetworksWallets() = runTest {
+        val engine = mockk<WalletKitEngine>(relaxed = true)
+        coEvery { engine.getWallets() } returns walletNetworks.map { (id, network) -> account(id, network) }
+        coEvery { engine.getWallet(TESTNET_WALLET) } returns account(TESTNET_WALLET, TONNetwork.TESTNET)
+
+        val kit = kit(engine, setOf(TONNetwork.MAINNET))
+
+        assertEquals(listOf(MAINNET_WALLET), kit.getWallets().map { it.id })
+        assertNull(kit.getWallet(TESTNET_WALLET))
+    }
+
+    @Test
+    fun destroy_removesTheKitsHandlersBeforeReleasingTheEngine() = runTest {
+        val engine = mockk<WalletKitEngine>(relaxed = true)
+        val registered = mutableListOf<TONBridgeEventsHandler>()
+        coEvery { engine.addEventsHandler(any()) } answers { registered.add(firstArg()) }
+        every { engine.walletNetwork(any()) } answers { walletNetworks[firstArg()] }
+        val kit = kit(engine, setOf(TONNetwork.MAINNET))
+
+        kit.addEventsHandler(
+            object : TONBridgeEventsHandler {
+                override fun handle(event: TONWalletKitEvent) = Unit
+            },
+        )
+        kit.destroy()
+
+        coVerifyOrder {
+            engine.removeEventsHandler(registered.single())
+            engine.destroy()
+        }
+    }
+
+    private fun kit(engine: WalletKitEngine, networks: Set<TONNetwork>?): ITONWalletKit {
+        val constructor = TONWalletKit::class.java.getDeclaredConstructor(WalletKitEngine::class.java, Set::class.java)
+        constructor.isAccessible = true
+        return constructor.newInstance(engine, networks) as ITONWalletKit
+    }
+
+    private fun account(walletId: String, network: TONNetwork) = WalletAccount(
+        walletId = walletId,
+        address = TONUserFriendlyAddress("EQD4FPq-PRDieyQKkizFTRtSDyucUIqrj0v_zXJmqaDp6_0t"),
+        network = network,
+    )
+
+    private fun disconnect(walletId: String?) = TONWalletKitEvent.Disconnect(
+        TONDisconnectionEvent(
+            id = "event-$walletId",
+            preview = TONDisconnectionEventPreview(
+                reason = "Test disconnect",
+                dAppInfo = TONDAppInfo(name = "Test dApp", url = "https://test.com", description = null, iconUrl = null, manifestUrl = null),
+            ),
+            walletId = walletId,
+        ),
+    )
+
+    private companion object {
+        const val MAINNET_WALLET = "mainnet-wallet"
+        const val TESTNET_WALLET = "testnet-wallet"
+    }
+}
@@ -0,0 +1,82 @@
+/*
+ * Copyright (c) 2025 TonTech
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+package io.ton.walletkit.engine.infrastructure
+
+import org.junit.Assert.assertEquals
+import org.junit.Assert.assertTrue
+import org.junit.Test
+
+class BridgeCallMetricsTest {
+
+    @Test
+    fun histogram_percentilesWithinBucketResolution() {
+        val histogram = LatencyHistogram()
+        for (millis in 1..100) histogram.record(millis * 1_000_000L)
+
+        assertWithin(50.0, histogram.percentileMillis(0.50))
+        assertWithin(95.0, histogram.percentileMillis(0.95))
+        assertWithin(99.0, histogram.percentileMillis(0.99))
+        assertEquals(0.0, LatencyHistogram().percentileMillis(0.5), 0.0)
+    }
+
+    @Test
+    fun disabled_keepsCountersButNoMethodStats() {
+        val metrics = BridgeCallMetrics(detailed = false)
+
+        metrics.onCallStarted()
+        metrics.onCallStarted()
+        metrics.onCallFinished("getBalance", metrics.startTimer(), 10, 20, failed = false)
+        metrics.onReverseCallFinished("signWithCustomSigner", metrics.startTimer(), failed = false)
+
+        val snapshot = metrics.snapshot(outboundQueueDepth = 3)
+        assertEquals(2L, snapshot.callsStarted)
+        assertEquals(1, snapshot.inFlight)
+        assertEquals(3, snapshot.outboundQueueDepth)
+        assertTrue(snapshot.methods.isEmpty())
+        assertTrue(snapshot.reverseMethods.isEmpty())
+    }
+
+    @Test
+    fun detailed_recordsPerMethodStats() {
+        val metrics = BridgeCallMetrics(detailed = true)
+
+        repeat(3) {
+            metrics.onCallStarted()
+            metrics.onCallFinished("getBalance", metrics.startTimer(), 10, 20, failed = it == 0)
+        }
+        metrics.onReverseCallFinished("signWithCustomSigner", metrics.startTimer(), failed = false)
+
+        val snapshot = metrics.snapshot()
+        val balance = snapshot.methods.getValue("getBalance")
+        assertEquals(0, snapshot.inFlight)
+        assertEquals(3L, balance.calls)
+        assertEquals(1L, balance.failures)
+        assertEquals(30L, balance.requestBytes)
+        assertEquals(60L, balance.responseBytes)
+        assertTrue(balance.p50Millis <= balance.p99Millis)
+        assertEquals(1L, snapshot.reverseMethods.getValue("signWithCustomSigner").calls)
+    }
+
+    private fun assertWithin(expected: Double, actual: Double) {
+        assertTrue("expected ~$expected, got $actual", actual >= expected && actual <= expected * 1.25)
+    }
+}
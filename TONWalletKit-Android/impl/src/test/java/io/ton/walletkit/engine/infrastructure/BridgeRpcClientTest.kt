@@ -25,15 +25,27 @@ import io.mockk.coEvery
 import io.mockk.every
 import io.mockk.mockk
 import io.ton.walletkit.WalletKitBridgeException
+import io.ton.walletkit.WalletKitContextLostException
 import io.ton.walletkit.bridge.BridgeCodec
+import io.ton.walletkit.bridge.BridgeEnvelope
+import io.ton.walletkit.bridge.transport.BridgePriority
 import io.ton.walletkit.bridge.transport.BridgeTransport
+import io.ton.walletkit.config.TONWalletKitConfiguration
+import io.ton.walletkit.internal.constants.BridgeMethodConstants
 import kotlinx.coroutines.CompletableDeferred
+import kotlinx.coroutines.async
+import kotlinx.coroutines.cancelAndJoin
+import kotlinx.coroutines.launch
 import kotlinx.coroutines.runBlocking
+import kotlinx.coroutines.yield
 import kotlinx.serialization.json.Json
 import kotlinx.serialization.json.JsonObject
 import kotlinx.serialization.json.add
 import kotlinx.serialization.json.buildJsonArray
 import kotlinx.serialization.json.buildJsonObject
+import kotlinx.serialization.json.int
+import kotlinx.serialization.json.jsonObject
+import kotlinx.serialization.json.jsonPrimitive
 import kotlinx.serialization.json.put
 import org.junit.Assert.*
 import org.junit.Before
@@ -241,4 +253,177 @@ class BridgeRpcClientTest {
         // Should use default message "Bridge call failed"
         rpcClient.handleResponse("test-id", response)
     }
+
+    // --- Envelope and call-id routing ---
+
+    @Test
+    fun send_writesIntegerIdEnvelope_andRoutesResponseById() = runBlocking {
+        val sent = mutableListOf<JsonObject>()
+        every { webViewManager.transport.send(any(), any()) } answers {
+            val envelope = Json.parseToJsonElement(firstArg<String>()).jsonObject
+            sent.add(envelope)
+            rpcClient.handleResponse(
+                envelope["id"]!!.jsonPrimitive.int,
+                buildJsonObject { put("result", "ok-${sent.size}") },
+            )
+        }
+
+        val first = rpcClient.send(BridgeMethodConstants.METHOD_INIT, mapOf("q\"uote" to listOf(1, 2)))
+        val second = rpcClient.send(BridgeMethodConstants.METHOD_INIT)
+
+        assertEquals("ok-1", first.jsonPrimitive.content)
+        assertEquals("ok-2", second.jsonPrimitive.content)
+        assertEquals("call", sent[0]["kind"]!!.jsonPrimitive.content)
+        assertEquals(BridgeMethodConstants.METHOD_INIT, sent[0]["method"]!!.jsonPrimitive.content)
+        assertEquals(buildJsonArray { add(1); add(2) }, sent[0]["params"]!!.jsonObject["q\"uote"])
+        assertFalse(sent[1].containsKey("params"))
+        assertNotEquals(sent[0]["id"], sent[1]["id"])
+    }
+
+    @Test
+    fun sendPayload_envelopeResponse_keepsResultAsText() = runBlocking {
+        every { webViewManager.transport.send(any(), any()) } answers {
+            val id = Json.parseToJsonElement(firstArg<String>()).jsonObject["id"]!!.jsonPrimitive.int
+            rpcClient.handleResponse(BridgeEnvelope.parse("""{"kind":"response","id":$id,"result":{"value": "x"}}"""))
+        }
+
+        val payload = rpcClient.sendPayload(BridgeMethodConstants.METHOD_INIT)
+
+        assertEquals("""{"value": "x"}""", payload.text)
+        assertEquals("x", payload.element.jsonObject["value"]!!.jsonPrimitive.content)
+    }
+
+    @Test
+    fun failAll_completesPendingCallsExceptionally() = runBlocking {
+        every { webViewManager.transport.send(any(), any()) } answers {
+            rpcClient.failAll(WalletKitBridgeException("bridge gone"))
+        }
+
+        val error = runCatching { rpcClient.send(BridgeMethodConstants.METHOD_INIT) }.exceptionOrNull()
+
+        assertTrue(error is WalletKitBridgeException)
+    }
+
+    // --- Deadlines and cancellation ---
+
+    @Test
+    fun send_pastDeadline_failsAndSendsCancel() = runBlocking {
+        val client = BridgeRpcClient(
+            webViewManager = webViewManager,
+            codec = BridgeCodec(Json),
+            ensureInitialized = {},
+            json = Json,
+            callPolicy = BridgeCallPolicy(TONWalletKitConfiguration.CallDeadlines(networkMillis = 50)),
+        )
+        val sent = mutableListOf<JsonObject>()
+        every { webViewManager.transport.send(any(), any()) } answers {
+            sent.add(Json.parseToJsonElement(firstArg<String>()).jsonObject)
+        }
+
+        val error = runCatching { client.send(BridgeMethodConstants.METHOD_INIT) }.exceptionOrNull()
+
+        assertTrue(error is WalletKitBridgeException)
+        assertEquals(listOf("call", "cancel"), sent.map { it["kind"]!!.jsonPrimitive.content })
+        assertEquals(sent[0]["id"], sent[1]["id"])
+        assertEquals(1L, client.metrics.snapshot().deadlinesExceeded)
+        assertEquals(1L, client.metrics.snapshot().cancelsSent)
+    }
+
+    @Test
+    fun send_callerCancelled_removesPendingAndSendsCancel() = runBlocking {
+        val sent = mutableListOf<JsonObject>()
+        every { webViewManager.transport.send(any(), any()) } answers {
+            sent.add(Json.parseToJsonElement(firstArg<String>()).jsonObject)
+        }
+
+        val job = launch { rpcClient.send(BridgeMethodConstants.METHOD_INIT) }
+        while (sent.isEmpty()) yield()
+        job.cancelAndJoin()
+
+        assertEquals("cancel", sent.last()["kind"]!!.jsonPrimitive.content)
+        val metrics = rpcClient.metrics.snapshot()
+        assertEquals(1L, metrics.callsCancelled)
+        assertEquals(0L, metrics.deadlinesExceeded)
+        // A late response for the abandoned call is ignored.
+        rpcClient.handleResponse(sent.first()["id"]!!.jsonPrimitive.int, buildJsonObject { put("result", "late") })
+    }
+
+    @Test
+    fun send_interactiveMethod_usesInteractiveLaneAndHint() = runBlocking {
+        val lanes = mutableListOf<BridgePriority>()
+        val sent = mutableListOf<JsonObject>()
+        every { webViewManager.transport.send(any(), any()) } answers {
+            val envelope = Json.parseToJsonElement(firstArg<String>()).jsonObject
+            sent.add(envelope)
+            lanes.add(secondArg())
+            rpcClient.handleResponse(envelope["id"]!!.jsonPrimitive.int, buildJsonObject { put("result", true) })
+        }
+
+        rpcClient.send(BridgeMethodConstants.METHOD_APPROVE_TRANSACTION_REQUEST)
+        rpcClient.send(BridgeMethodConstants.METHOD_GET_BALANCE)
+        rpcClient.send(BridgeMethodConstants.METHOD_KOTLIN_PROVIDER_DISPATCH)
+
+        assertEquals(listOf(BridgePriority.INTERACTIVE, BridgePriority.FOREGROUND, BridgePriority.BACKGROUND), lanes)
+        assertEquals("interactive", sent[0]["priority"]!!.jsonPrimitive.content)
+        assertFalse(sent[1].containsKey("priority"))
+        assertEquals("background", sent[2]["priority"]!!.jsonPrimitive.content)
+    }
+
+    // --- Context loss ---
+
+    @Test
+    fun onContextLost_failsNonReplayableCalls_andReplaysReadsUnderSameId() = runBlocking {
+        val sent = mutableListOf<JsonObject>()
+        every { webViewManager.transport.send(any(), any()) } answers {
+            sent.add(Json.parseToJsonElement(firstArg<String>()).jsonObject)
+        }
+
+        val sign = async { runCatching { rpcClient.send(BridgeMethodConstants.METHOD_SIGN) } }
+        val balance = async { rpcClient.send(BridgeMethodConstants.METHOD_GET_BALANCE) }
+        while (sent.size < 2) yield()
+
+        val replayIds = rpcClient.onContextLost()
+
+        assertTrue(sign.await().exceptionOrNull() is WalletKitContextLostException)
+        val balanceCall = sent.single { it["method"]!!.jsonPrimitive.content == BridgeMethodConstants.METHOD_GET_BALANCE }
+        assertEquals(listOf(balanceCall["id"]!!.jsonPrimitive.int), replayIds)
+
+        rpcClient.replay(replayIds)
+
+        assertEquals(balanceCall, sent.last())
+        rpcClient.handleResponse(replayIds.single(), buildJsonObject { put("result", "42") })
+        assertEquals("42", balance.await().jsonPrimitive.content)
+        val metrics = rpcClient.metrics.snapshot()
+        assertEquals(1L, metrics.contextLosses)
+        assertEquals(1L, metrics.callsReplayed)
+        assertEquals(1L, metrics.callsFailedOnContextLoss)
+    }
+
+    @Test
+    fun onContextLost_resendsUndeliveredCall_evenWhenNotReplayable() = runBlocking {
+        val sent = mutableListOf<String>()
+        every { webViewManager.transport.send(any(), any()) } answers { sent.add(firstArg()) }
+
+        val sign = async { rpcClient.send(BridgeMethodConstants.METHOD_SIGN) }
+        while (sent.isEmpty()) yield()
+
+        // The envelope was still queued when the page reloaded, so JS never saw it.
+        val replayIds = rpcClient.onContextLost(undelivered = listOf(sent.single()))
+        rpcClient.replay(replayIds)
+
+        assertEquals(listOf(sent[0], sent[0]), sent)
+        rpcClient.handleResponse(replayIds.single(), buildJsonObject { put("result", "signed") })
+        assertEquals("signed", sign.await().jsonPrimitive.content)
+        assertEquals(0L, rpcClient.metrics.snapshot().callsFailedOnContextLoss)
+    }
+
+    @Test
+    fun callPolicy_classifiesMethods() {
+        val policy = BridgeCallPolicy(TONWalletKitConfiguration.CallDeadlines(localMillis = 1, networkMillis = 2, emulationMillis = null))
+
+        assertEquals(1L, policy.deadlineFor(BridgeMethodConstants.METHOD_SIGN))
+        assertEquals(2L, policy.deadlineFor(BridgeMethodConstants.METHOD_GET_BALANCE))
+        assertEquals(2L, policy.deadlineFor("someFutureMethod"))
+        assertNull(policy.deadlineFor(BridgeMethodConstants.METHOD_GET_TRANSACTION_PREVIEW))
+    }
 }
@@ -0,0 +1,60 @@
+/*
+ * Copyright (c) 2025 TonTech
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+package io.ton.walletkit.engine.infrastructure
+
+import org.junit.Assert.assertEquals
+import org.junit.Assert.assertNotEquals
+import org.junit.Test
+
+class BundleAssetHandlerTest {
+
+    @Test
+    fun versionScripts_appendsHashToRelativeScripts() {
+        val html = """
+            <script type="module" src="walletkit-android-bridge.mjs"></script>
+            <script src="https://cdn.example.com/lib.js"></script>
+            <script src="missing.js"></script>
+        """.trimIndent()
+
+        val versioned = BundleAssetHandler.versionScripts(html) { src ->
+            if (src == "walletkit-android-bridge.mjs") "abc123" else null
+        }
+
+        assertEquals(
+            """
+            <script type="module" src="walletkit-android-bridge.mjs?v=abc123"></script>
+            <script src="https://cdn.example.com/lib.js"></script>
+            <script src="missing.js"></script>
+            """.trimIndent(),
+            versioned,
+        )
+    }
+
+    @Test
+    fun contentHash_isStableAndContentDependent() {
+        val hash = BundleAssetHandler.contentHash("bundle".encodeToByteArray())
+
+        assertEquals(16, hash.length)
+        assertEquals(hash, BundleAssetHandler.contentHash("bundle".encodeToByteArray()))
+        assertNotEquals(hash, BundleAssetHandler.contentHash("bundle2".encodeToByteArray()))
+    }
+}
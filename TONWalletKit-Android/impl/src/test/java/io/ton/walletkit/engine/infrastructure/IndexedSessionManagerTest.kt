@@ -0,0 +1,183 @@
+/*
+ * Copyright (c) 2025 TonTech
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+package io.ton.walletkit.engine.infrastructure
+
+import io.ton.walletkit.api.generated.TONDAppInfo
+import io.ton.walletkit.internal.crypto.Ed25519
+import io.ton.walletkit.session.SessionFilter
+import io.ton.walletkit.session.TONConnectSession
+import io.ton.walletkit.session.TONConnectSessionChange
+import io.ton.walletkit.storage.MemoryBridgeStorageAdapter
+import kotlinx.coroutines.async
+import kotlinx.coroutines.flow.take
+import kotlinx.coroutines.flow.toList
+import kotlinx.coroutines.test.runCurrent
+import kotlinx.coroutines.test.runTest
+import kotlinx.serialization.encodeToString
+import kotlinx.serialization.json.Json
+import org.junit.Assert.assertEquals
+import org.junit.Assert.assertNull
+import org.junit.Assert.assertTrue
+import org.junit.Test
+import java.time.Instant
+
+class IndexedSessionManagerTest {
+
+    private val json = Json { ignoreUnknownKeys = true }
+    private val adapter = MemoryBridgeStorageAdapter()
+    private val storage = StorageManager(adapter) { true }
+
+    private fun manager() = IndexedSessionManager(storage, json, clock = { Instant.parse("2025-01-02T03:04:05Z") })
+
+    @Test
+    fun createSession_matchesBundleSessionShape() = runTest {
+        val session = manager().create("s1", "https://App.example.com/path", wallet = "w1")
+
+        assertEquals("app.example.com", session.domain)
+        assertEquals("2025-01-02T03:04:05.000Z", session.createdAt)
+        assertEquals(64, session.privateKey.length)
+        assertEquals(Ed25519.x25519PublicKey(hex(session.privateKey)).toHex(), session.publicKey)
+        assertEquals(1, session.schemaVersion)
+    }
+
+    @Test
+    fun createSession_rejectsDAppWithoutUrl() = runTest {
+        val result = runCatching { manager().createSession("s1", TONDAppInfo(name = "dApp"), "w1", ADDRESS, false) }
+
+        assertTrue(result.exceptionOrNull() is IllegalArgumentException)
+    }
+
+    @Test
+    fun getSessions_filtersByEveryCriterion() = runTest {
+        val manager = manager()
+        manager.create("a", "https://one.example", wallet = "w1", jsBridge = false)
+        manager.create("b", "https://two.example", wallet = "w1", jsBridge = true)
+        manager.create("c", "https://one.example", wallet = "w2", jsBridge = true)
+
+        assertEquals(listOf("a", "b", "c"), manager.getSessions(null).ids())
+        assertEquals(listOf("a", "b"), manager.getSessions(SessionFilter(walletId = "w1")).ids())
+        assertEquals(listOf("a", "c"), manager.getSessions(SessionFilter(domain = "https://one.example/connect")).ids())
+        assertEquals(listOf("c"), manager.getSessions(SessionFilter(domain = "one.example", isJsBridge = true)).ids())
+        assertEquals(emptyList<String>(), manager.getSessions(SessionFilter(walletId = "w3")).ids())
+    }
+
+    @Test
+    fun removeSessions_updatesIndexesAndStorage() = runTest {
+        val manager = manager()
+        manager.create("a", "https://one.example", wallet = "w1")
+        manager.create("b", "https://two.example", wallet = "w1")
+        manager.create("c", "https://one.example", wallet = "w2")
+
+        manager.removeSessions(SessionFilter(walletId = "w1"))
+
+        assertEquals(listOf("c"), manager.getSessions(SessionFilter(domain = "one.example")).ids())
+        assertEquals(emptyList<String>(), manager.getSessions(SessionFilter(domain = "two.example")).ids())
+        assertNull(adapter.get("session:a"))
+        assertEquals("[\"c\"]", adapter.get("session_index"))
+    }
+
+    @Test
+    fun sessions_surviveReload() = runTest {
+        val created = manager().create("a", "https://one.example", wallet = "w1")
+
+        val reloaded = manager()
+
+        assertEquals(created, reloaded.getSession("a"))
+        assertEquals(listOf("a"), reloaded.getSessions(SessionFilter(walletId = "w1")).ids())
+    }
+
+    @Test
+    fun firstLoad_importsBundleSessionList() = runTest {
+        val session = manager().create("a", "https://one.example", wallet = "w1")
+        adapter.clear()
+        // The bundle's list; the second entry predates walletAddress and is skipped.
+        adapter.set("sessions", "[${json.encodeToString(session)},{\"sessionId\":\"old\",\"walletId\":\"w1\"}]")
+
+        val manager = manager()
+
+        assertEquals(listOf("a"), manager.getSessions(null).ids())
+        assertEquals("[\"a\"]", adapter.get("session_index"))
+    }
+
+    @Test
+    fun changes_reportCreationsAndRemovals() = runTest {
+        val manager = manager()
+        val changes = async { manager.changes.take(2).toList() }
+        runCurrent()
+
+        val session = manager.create("a", "https://one.example", wallet = "w1")
+        manager.clearSessions()
+
+        assertEquals(
+            listOf(TONConnectSessionChange.Created(session), TONConnectSessionChange.Removed(listOf("a"))),
+            changes.await(),
+        )
+    }
+
+    @Test
+    fun changes_reportRecreatingAnIdAsReplaced() = runTest {
+        val manager = manager()
+        val changes = async { manager.changes.take(2).toList() }
+        runCurrent()
+
+        val first = manager.create("a", "https://one.example", wallet = "w1")
+        val second = manager.create("a", "https://two.example", wallet = "w1")
+
+        assertEquals(
+            listOf(TONConnectSessionChange.Created(first), TONConnectSessionChange.Replaced(second)),
+            changes.await(),
+        )
+        assertEquals(listOf("a"), manager.getSessions(SessionFilter(domain = "two.example")).ids())
+    }
+
+    @Test
+    fun storageClear_dropsLoadedSessionsAndKeepsThemCleared() = runTest {
+        val manager = manager()
+        manager.create("a", "https://one.example", wallet = "w1")
+        val changes = async { manager.changes.take(1).toList() }
+        runCurrent()
+
+        storage.clear()
+        manager.create("b", "https://two.example", wallet = "w1")
+
+        assertEquals(listOf(TONConnectSessionChange.Removed(listOf("a"))), changes.await())
+        assertEquals(listOf("b"), manager.getSessions(null).ids())
+        assertEquals("[\"b\"]", adapter.get("session_index"))
+    }
+
+    private suspend fun IndexedSessionManager.create(
+        id: String,
+        url: String,
+        wallet: String,
+        jsBridge: Boolean = false,
+    ) = createSession(id, TONDAppInfo(name = "dApp", url = url), wallet, ADDRESS, jsBridge)
+
+    private fun List<TONConnectSession>.ids() = map { it.sessionId }
+
+    private fun hex(value: String) = ByteArray(value.length / 2) { value.substring(it * 2, it * 2 + 2).toInt(16).toByte() }
+
+    private fun ByteArray.toHex() = joinToString("") { "%02x".format(it) }
+
+    private companion object {
+        const val ADDRESS = "EQCjk1hh952vWaE2-K7xfGRiCDOQnhFKT6yGLrNY6KzZP6O2"
+    }
+}
@@ -0,0 +1,115 @@
+/*
+ * Copyright (c) 2025 TonTech
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+package io.ton.walletkit.engine.infrastructure
+
+import android.content.Context
+import io.mockk.coEvery
+import io.mockk.coVerify
+import io.mockk.mockk
+import io.mockk.slot
+import io.ton.walletkit.api.ChainIds
+import io.ton.walletkit.api.generated.TONNetwork
+import io.ton.walletkit.config.TONWalletKitConfiguration
+import io.ton.walletkit.internal.constants.BridgeMethodConstants
+import io.ton.walletkit.storage.TONWalletKitStorageType
+import kotlinx.coroutines.runBlocking
+import kotlinx.serialization.json.JsonNull
+import kotlinx.serialization.json.JsonObject
+import kotlinx.serialization.json.jsonArray
+import kotlinx.serialization.json.jsonObject
+import kotlinx.serialization.json.jsonPrimitive
+import org.junit.Assert.assertEquals
+import org.junit.Assert.assertTrue
+import org.junit.Before
+import org.junit.Test
+
+class InitializationManagerTest {
+
+    private val mainnet = TONNetwork(chainId = ChainIds.MAINNET)
+    private val testnet = TONNetwork(chainId = ChainIds.TESTNET)
+
+    private lateinit var rpcClient: BridgeRpcClient
+    private lateinit var manager: InitializationManager
+
+    @Before
+    fun setup() {
+        rpcClient = mockk(relaxed = true)
+        coEvery { rpcClient.send(any(), any()) } returns JsonNull
+        manager = InitializationManager(mockk<Context>(relaxed = true), rpcClient)
+    }
+
+    @Test
+    fun addNetworks_registersOnlyNewNetworksWithRunningBridge() = runBlocking {
+        manager.initialize(config(mainnet))
+        val payload = slot<Any>()
+        coEvery { rpcClient.send(BridgeMethodConstants.METHOD_ADD_NETWORKS, capture(payload)) } returns JsonNull
+
+        val added = manager.addNetworks(config(mainnet, testnet))
+
+        assertEquals(listOf(testnet), added)
+        val sent = (payload.captured as JsonObject)["networkConfigurations"]!!.jsonArray
+        val sentChainIds = sent.map { it.jsonObject["network"]!!.jsonObject["chainId"]!!.jsonPrimitive.content }
+        assertEquals(listOf(ChainIds.TESTNET), sentChainIds)
+        assertEquals(
+            setOf(mainnet, testnet),
+            manager.getConfiguration()!!.networkConfigurations.map { it.network }.toSet(),
+        )
+
+        assertTrue(manager.addNetworks(config(testnet)).isEmpty())
+        coVerify(exactly = 1) { rpcClient.send(BridgeMethodConstants.METHOD_ADD_NETWORKS, any()) }
+    }
+
+    @Test
+    fun invalidate_replaysMergedNetworks() = runBlocking {
+        manager.initialize(config(mainnet))
+        manager.addNetworks(config(testnet))
+        val payload = slot<Any>()
+        coEvery { rpcClient.send(BridgeMethodConstants.METHOD_INIT, capture(payload)) } returns JsonNull
+
+        manager.invalidate()
+        manager.ensureInitialized()
+
+        val networks = (payload.captured as JsonObject)["networkConfigurations"]!!.jsonArray
+        assertEquals(2, networks.size)
+    }
+
+    private fun config(vararg networks: TONNetwork) = TONWalletKitConfiguration(
+        networkConfigurations = networks.map {
+            TONWalletKitConfiguration.NetworkConfiguration(
+                network = it,
+                apiClientConfiguration = TONWalletKitConfiguration.APIClientConfiguration(key = ""),
+            )
+        }.toSet(),
+        walletManifest = TONWalletKitConfiguration.Manifest(
+            name = "Test Wallet",
+            appName = "Wallet",
+            imageUrl = "https://example.com/icon.png",
+            aboutUrl = "https://example.com",
+            universalLink = "https://example.com/tc",
+            bridgeUrl = "https://bridge.tonapi.io/bridge",
+        ),
+        bridge = TONWalletKitConfiguration.Bridge(bridgeUrl = "https://bridge.tonapi.io/bridge"),
+        features = emptyList(),
+        storageType = TONWalletKitStorageType.Memory,
+        engineOptions = TONWalletKitConfiguration.EngineOptions(shareAcrossNetworks = true),
+    )
+}
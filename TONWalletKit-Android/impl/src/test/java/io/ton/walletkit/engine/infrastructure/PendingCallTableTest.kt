@@ -0,0 +1,99 @@
+/*
+ * Copyright (c) 2025 TonTech
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+package io.ton.walletkit.engine.infrastructure
+
+import org.junit.Assert.assertEquals
+import org.junit.Assert.assertFalse
+import org.junit.Assert.assertNull
+import org.junit.Assert.assertTrue
+import org.junit.Test
+
+/**
+ * Tests for [PendingCallTable]: id allocation, slot reuse, and overflow when slots are busy.
+ */
+class PendingCallTableTest {
+
+    @Test
+    fun register_returnsDistinctPositiveIds() {
+        val table = PendingCallTable<String>(capacity = 4)
+
+        val ids = List(10) { table.register("call-$it") }
+
+        assertEquals(ids.size, ids.toSet().size)
+        assertTrue(ids.all { it > 0 })
+    }
+
+    @Test
+    fun remove_returnsValueOnce() {
+        val table = PendingCallTable<String>()
+        val id = table.register("a")
+
+        assertTrue(table.contains(id))
+        assertEquals("a", table.remove(id))
+        assertNull(table.remove(id))
+        assertFalse(table.contains(id))
+    }
+
+    @Test
+    fun busySlot_spillsIntoOverflow() {
+        val table = PendingCallTable<String>(capacity = 2)
+        // More in-flight calls than slots: later ids collide with still-pending ones.
+        val ids = List(6) { table.register("call-$it") }
+
+        ids.forEachIndexed { index, id -> assertEquals("call-$index", table.remove(id)) }
+    }
+
+    @Test
+    fun freedSlot_isReused() {
+        val table = PendingCallTable<String>(capacity = 2)
+        val first = table.register("first")
+        table.remove(first)
+        table.register("filler")
+
+        val reused = table.register("reused")
+
+        assertEquals(first and 1, reused and 1)
+        assertTrue(table.contains(reused))
+        assertEquals("reused", table.remove(reused))
+    }
+
+    @Test
+    fun drain_visitsSlotsAndOverflow() {
+        val table = PendingCallTable<String>(capacity = 2)
+        val values = List(5) { "call-$it" }
+        val ids = values.map { table.register(it) }
+
+        val drained = mutableListOf<String>()
+        table.drain { drained.add(it) }
+
+        assertEquals(values.toSet(), drained.toSet())
+        ids.forEach { assertFalse(table.contains(it)) }
+    }
+
+    @Test
+    fun unknownId_isIgnored() {
+        val table = PendingCallTable<String>()
+
+        assertNull(table.remove(0))
+        assertNull(table.remove(12345))
+    }
+}
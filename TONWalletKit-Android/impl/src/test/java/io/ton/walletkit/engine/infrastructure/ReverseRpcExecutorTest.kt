@@ -0,0 +1,140 @@
+/*
+ * Copyright (c) 2025 TonTech
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+package io.ton.walletkit.engine.infrastructure
+
+import kotlinx.coroutines.CancellationException
+import kotlinx.coroutines.CompletableDeferred
+import kotlinx.coroutines.Dispatchers
+import kotlinx.coroutines.awaitCancellation
+import kotlinx.coroutines.runBlocking
+import kotlinx.coroutines.withTimeout
+import kotlinx.coroutines.yield
+import org.junit.Assert.assertEquals
+import org.junit.Assert.assertFalse
+import org.junit.Assert.assertTrue
+import org.junit.Test
+import java.util.Collections
+import java.util.concurrent.atomic.AtomicInteger
+
+class ReverseRpcExecutorTest {
+
+    @Test
+    fun submit_appliesPerMethodLimit() = runBlocking {
+        val metrics = BridgeCallMetrics()
+        val executor = ReverseRpcExecutor(metrics, limits = mapOf("watch" to 2), dispatcher = Dispatchers.Default)
+        val release = CompletableDeferred<Unit>()
+        val running = AtomicInteger()
+
+        repeat(5) { executor.submit("watch") { running.incrementAndGet(); release.await() } }
+        executor.submit("other") { running.incrementAndGet(); release.await() }
+
+        withTimeout(5_000) { while (running.get() < 3) yield() }
+        val busy = metrics.snapshot()
+        assertEquals(3, busy.reverseInFlight)
+        assertEquals(3, busy.reverseQueued)
+
+        release.complete(Unit)
+        withTimeout(5_000) { while (executor.pendingCount > 0) yield() }
+        assertEquals(6, running.get())
+        assertEquals(0, metrics.snapshot().reverseInFlight)
+        assertTrue(metrics.snapshot().reverseQueuedPeak >= 3)
+        executor.shutdown()
+    }
+
+    @Test
+    fun submit_refusesWhenSaturated() = runBlocking {
+        val metrics = BridgeCallMetrics()
+        val executor = ReverseRpcExecutor(metrics, maxPending = 2, dispatcher = Dispatchers.Default)
+        val release = CompletableDeferred<Unit>()
+
+        assertTrue(executor.submit("a") { release.await() })
+        assertTrue(executor.submit("a") { release.await() })
+        assertFalse(executor.submit("a") { release.await() })
+        assertEquals(1L, metrics.snapshot().reverseRejected)
+
+        release.complete(Unit)
+        withTimeout(5_000) { while (executor.pendingCount > 0) yield() }
+        assertTrue(executor.submit("a") {})
+        executor.shutdown()
+    }
+
+    @Test
+    fun submitOrdered_runsLaneInSubmissionOrderPastTheLimit() = runBlocking {
+        val metrics = BridgeCallMetrics()
+        val executor = ReverseRpcExecutor(metrics, maxPending = 2, dispatcher = Dispatchers.Default)
+        val order = Collections.synchronizedList(mutableListOf<Int>())
+        val running = AtomicInteger()
+        val maxRunning = AtomicInteger()
+
+        repeat(20) { index ->
+            val accepted = executor.submitOrdered("storage") {
+                maxRunning.accumulateAndGet(running.incrementAndGet(), ::maxOf)
+                yield()
+                order += index
+                running.decrementAndGet()
+            }
+            assertTrue(accepted)
+        }
+
+        withTimeout(5_000) { while (executor.pendingCount > 0) yield() }
+        assertEquals((0 until 20).toList(), order)
+        assertEquals(1, maxRunning.get())
+        assertEquals(0L, metrics.snapshot().reverseRejected)
+        executor.shutdown()
+        assertFalse(executor.submitOrdered("storage") {})
+    }
+
+    @Test
+    fun submitOrdered_keepsLaneRunningAfterBlockThrows() = runBlocking {
+        val executor = ReverseRpcExecutor(BridgeCallMetrics(), dispatcher = Dispatchers.Default)
+        val ran = CompletableDeferred<Unit>()
+
+        executor.submitOrdered("storage") { throw CancellationException("adapter timed out") }
+        executor.submitOrdered("storage") { throw AssertionError("handler bug") }
+        executor.submitOrdered("storage") { ran.complete(Unit) }
+
+        withTimeout(5_000) { ran.await() }
+        withTimeout(5_000) { while (executor.pendingCount > 0) yield() }
+        executor.shutdown()
+    }
+
+    @Test
+    fun shutdown_cancelsRunningWorkAndRefusesNew() = runBlocking {
+        val executor = ReverseRpcExecutor(BridgeCallMetrics(), dispatcher = Dispatchers.Default)
+        val cancelled = CompletableDeferred<Unit>()
+        val started = CompletableDeferred<Unit>()
+
+        executor.submit("a") {
+            try {
+                started.complete(Unit)
+                awaitCancellation()
+            } finally {
+                cancelled.complete(Unit)
+            }
+        }
+        withTimeout(5_000) { started.await() }
+        executor.shutdown()
+
+        withTimeout(5_000) { cancelled.await() }
+        assertFalse(executor.submit("a") {})
+    }
+}
@@ -0,0 +1,61 @@
+/*
+ * Copyright (c) 2025 TonTech
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+package io.ton.walletkit.engine.infrastructure
+
+import org.junit.Assert.assertEquals
+import org.junit.Assert.assertFalse
+import org.junit.Assert.assertNull
+import org.junit.Assert.assertTrue
+import org.junit.Test
+
+class StartupTimelineTest {
+
+    @Test
+    fun mark_recordsFirstOccurrenceOnly() {
+        var now = 5_000_000L
+        val timeline = StartupTimeline(prewarmed = true) { now }
+
+        now += 12_000_000L
+        timeline.mark(StartupPhase.WEBVIEW_CREATED)
+        now += 300_000_000L
+        timeline.mark(StartupPhase.JS_READY)
+        now += 1_000_000_000L
+        timeline.mark(StartupPhase.JS_READY)
+
+        val timings = timeline.snapshot()
+        assertTrue(timings.prewarmed)
+        assertEquals(12L, timings.webViewCreatedMillis)
+        assertEquals(312L, timings.jsReadyMillis)
+        assertNull(timings.initDoneMillis)
+    }
+
+    @Test
+    fun snapshot_emptyTimeline_hasNoPhases() {
+        val timings = StartupTimeline().snapshot()
+
+        assertFalse(timings.prewarmed)
+        assertNull(timings.webViewCreatedMillis)
+        assertNull(timings.pageFinishedMillis)
+        assertNull(timings.portReadyMillis)
+        assertNull(timings.configBoundMillis)
+    }
+}
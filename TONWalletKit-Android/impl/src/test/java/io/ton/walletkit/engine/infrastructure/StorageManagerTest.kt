@@ -0,0 +1,250 @@
+/*
+ * Copyright (c) 2025 TonTech
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+package io.ton.walletkit.engine.infrastructure
+
+import io.ton.walletkit.config.TONWalletKitConfiguration
+import io.ton.walletkit.storage.BridgeStorageAdapter
+import kotlinx.coroutines.CompletableDeferred
+import kotlinx.coroutines.ExperimentalCoroutinesApi
+import kotlinx.coroutines.async
+import kotlinx.coroutines.test.StandardTestDispatcher
+import kotlinx.coroutines.test.TestScope
+import kotlinx.coroutines.test.advanceTimeBy
+import kotlinx.coroutines.test.advanceUntilIdle
+import kotlinx.coroutines.test.runCurrent
+import kotlinx.coroutines.test.runTest
+import org.junit.Assert.assertEquals
+import org.junit.Assert.assertNull
+import org.junit.Test
+import java.io.IOException
+
+@OptIn(ExperimentalCoroutinesApi::class)
+class StorageManagerTest {
+
+    private val adapter = RecordingStorageAdapter()
+
+    @Test
+    fun set_coalescesWritesToOneKeyUntilWritesPause() = runTest {
+        val manager = manager(TONWalletKitConfiguration.StorageWriteBehind())
+
+        repeat(100) { manager.set("bridge_last_event_id", "event-$it") }
+        assertEquals("event-99", manager.get("bridge_last_event_id"))
+        assertEquals(emptyList<String>(), adapter.writes)
+
+        advanceUntilIdle()
+        assertEquals(listOf("set bridge_last_event_id=event-99"), adapter.writes)
+        assertEquals(1L, manager.adapterWrites)
+        assertEquals(99L, manager.coalescedWrites)
+        assertEquals(0, adapter.reads)
+    }
+
+    @Test
+    fun set_flushesWithinMaxDelayUnderSteadyWrites() = runTest {
+        val manager = manager(TONWalletKitConfiguration.StorageWriteBehind(flushDelayMillis = 1_000, maxFlushDelayMillis = 5_000))
+
+        repeat(20) {
+            manager.set("sessions", "v$it")
+            advanceTimeBy(500)
+        }
+        runCurrent()
+
+        // Writes every 500ms never leave a 1s pause, so only the 5s cap flushes them.
+        assertEquals(listOf("set sessions=v10"), adapter.writes)
+        advanceUntilIdle()
+        assertEquals(listOf("set sessions=v10", "set sessions=v19"), adapter.writes)
+    }
+
+    @Test
+    fun set_flushesOnceMaxPendingKeysAreQueued() = runTest {
+        val manager = manager(TONWalletKitConfiguration.StorageWriteBehind(maxPendingKeys = 3))
+
+        manager.set("a", "1")
+        manager.remove("b")
+        assertEquals(emptyList<String>(), adapter.writes)
+        manager.set("c", "3")
+
+        // The flush reaches the adapter as one multi-key write plus one removal.
+        assertEquals(listOf("setMany a=1,c=3", "remove b"), adapter.writes)
+        assertEquals(2L, manager.adapterWrites)
+    }
+
+    @Test
+    fun getMany_readsUncachedKeysInOneCall() = runTest {
+        adapter.values["a"] = "1"
+        adapter.values["b"] = "2"
+        val manager = manager(TONWalletKitConfiguration.StorageWriteBehind())
+
+        assertEquals("1", manager.get("a"))
+        manager.set("c", "3")
+        assertEquals(mapOf("a" to "1", "b" to "2", "c" to "3"), manager.getMany(listOf("a", "b", "c", "d")))
+        assertEquals(mapOf("b" to "2"), manager.getMany(listOf("b", "d")))
+
+        assertEquals(listOf(listOf("a"), listOf("b", "d")), adapter.readBatches)
+    }
+
+    @Test
+    fun flush_writesQueuedValuesAndClearDropsThem() = runTest {
+        val manager = manager(TONWalletKitConfiguration.StorageWriteBehind())
+
+        manager.set("wallets", "[1]")
+        manager.flush()
+        assertEquals(listOf("set wallets=[1]"), adapter.writes)
+
+        manager.set("wallets", "[1,2]")
+        manager.clear()
+        advanceUntilIdle()
+        assertEquals(listOf("set wallets=[1]", "clear"), adapter.writes)
+        assertNull(manager.get("wallets"))
+    }
+
+    @Test
+    fun flush_requeuesWritesTheAdapterRejectsAndRetriesThem() = runTest {
+        val manager = manager(TONWalletKitConfiguration.StorageWriteBehind())
+        adapter.failingWrites = 1
+
+        manager.set("wallets", "[1]")
+        manager.remove("sessions")
+        manager.flush()
+        assertEquals(listOf("remove sessions"), adapter.writes)
+        assertEquals("[1]", manager.get("wallets"))
+
+        advanceUntilIdle()
+        assertEquals(listOf("remove sessions", "set wallets=[1]"), adapter.writes)
+        assertEquals(0, adapter.reads)
+    }
+
+    @Test
+    fun flush_failedWriteDoesNotOverwriteANewerQueuedValue() = runTest {
+        val manager = manager(TONWalletKitConfiguration.StorageWriteBehind())
+        adapter.failingWrites = 1
+        adapter.onFailedWrite = { manager.set("wallets", "[1,2]") }
+
+        manager.set("wallets", "[1]")
+        manager.flush()
+        assertEquals("[1,2]", manager.get("wallets"))
+
+        advanceUntilIdle()
+        assertEquals(listOf("set wallets=[1,2]"), adapter.writes)
+    }
+
+    @Test
+    fun get_readThatRacesClearIsNotCached() = runTest {
+        adapter.values["wallets"] = "[1]"
+        val manager = manager(TONWalletKitConfiguration.StorageWriteBehind())
+        val gate = CompletableDeferred<Unit>()
+        adapter.readGate = gate
+
+        val read = async { manager.get("wallets") }
+        runCurrent()
+        manager.clear()
+        gate.complete(Unit)
+
+        assertNull(read.await())
+        assertNull(manager.get("wallets"))
+        assertEquals(2, adapter.reads)
+    }
+
+    @Test
+    fun get_readsEachKeyFromTheAdapterOnce() = runTest {
+        adapter.values["sessions"] = "[]"
+        val manager = manager(TONWalletKitConfiguration.StorageWriteBehind())
+
+        assertEquals("[]", manager.get("sessions"))
+        assertEquals("[]", manager.get("sessions"))
+        assertNull(manager.get("missing"))
+        assertNull(manager.get("missing"))
+
+        assertEquals(2, adapter.reads)
+    }
+
+    @Test
+    fun withoutWriteBehind_everyCallReachesTheAdapter() = runTest {
+        val manager = manager(null)
+
+        manager.set("key", "1")
+        manager.set("key", "2")
+        manager.get("key")
+
+        assertEquals(listOf("set key=1", "set key=2"), adapter.writes)
+        assertEquals(1, adapter.reads)
+    }
+
+    private fun TestScope.manager(options: TONWalletKitConfiguration.StorageWriteBehind?) =
+        StorageManager(adapter, options, StandardTestDispatcher(testScheduler)) { true }
+
+    private class RecordingStorageAdapter : BridgeStorageAdapter {
+        val values = HashMap<String, String>()
+        val writes = mutableListOf<String>()
+        val readBatches = mutableListOf<List<String>>()
+        var reads = 0
+
+        // Reads suspend on this until it completes, then return the value stored when they began.
+        var readGate: CompletableDeferred<Unit>? = null
+
+        // The next this many set calls throw after running [onFailedWrite].
+        var failingWrites = 0
+        var onFailedWrite: suspend () -> Unit = {}
+
+        override suspend fun get(key: String): String? {
+            reads++
+            readBatches += listOf(key)
+            val value = values[key]
+            readGate?.await()
+            return value
+        }
+
+        override suspend fun getMany(keys: Collection<String>): Map<String, String> {
+            reads++
+            readBatches += keys.toList()
+            return keys.mapNotNull { key -> values[key]?.let { key to it } }.toMap()
+        }
+
+        override suspend fun setMany(values: Map<String, String>) {
+            failIfRequested()
+            writes += "setMany " + values.entries.joinToString(",") { "${it.key}=${it.value}" }
+            this.values.putAll(values)
+        }
+
+        override suspend fun set(key: String, value: String) {
+            failIfRequested()
+            writes += "set $key=$value"
+            values[key] = value
+        }
+
+        override suspend fun remove(key: String) {
+            writes += "remove $key"
+            values.remove(key)
+        }
+
+        override suspend fun clear() {
+            writes += "clear"
+            values.clear()
+        }
+
+        private suspend fun failIfRequested() {
+            if (failingWrites == 0) return
+            failingWrites--
+            onFailedWrite()
+            throw IOException("disk full")
+        }
+    }
+}
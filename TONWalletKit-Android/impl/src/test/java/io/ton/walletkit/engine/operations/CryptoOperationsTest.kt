@@ -22,8 +22,11 @@
 package io.ton.walletkit.engine.operations
 
 import io.mockk.coEvery
+import io.mockk.every
 import io.ton.walletkit.WalletKitBridgeException
 import io.ton.walletkit.bridge.BridgeConversionError
+import io.ton.walletkit.engine.infrastructure.BridgeRpcClient
+import io.ton.walletkit.engine.operations.requests.BinarySignRequest
 import kotlinx.coroutines.runBlocking
 import kotlinx.serialization.json.JsonArray
 import kotlinx.serialization.json.JsonPrimitive
@@ -221,4 +224,29 @@ class CryptoOperationsTest : OperationsTestBase() {
             }
         }
     }
+
+    @Test
+    fun sign_binaryLane_sendsAttachmentsAndReturnsBinaryResult() = runBlocking {
+        val data = byteArrayOf(1, 2, 3)
+        val secretKey = ByteArray(64) { it.toByte() }
+        val signature = ByteArray(64) { (it * 3).toByte() }
+        var sentAttachments: List<ByteArray>? = null
+        var sentParams: Any? = null
+        every { rpcClient.supportsBinary } returns true
+        coEvery { rpcClient.sendWithAttachments(any(), any(), any()) } coAnswers {
+            sentParams = secondArg()
+            sentAttachments = thirdArg()
+            BridgeRpcClient.AttachedResult(
+                raw = buildJsonObject { put("__bin", 0) },
+                attachments = listOf(signature),
+            )
+        }
+
+        val result = rpcClient.sign(data, secretKey)
+
+        assertArrayEquals(signature, result)
+        assertTrue(sentParams is BinarySignRequest)
+        assertArrayEquals(data, sentAttachments!![0])
+        assertArrayEquals(secretKey, sentAttachments!![1])
+    }
 }
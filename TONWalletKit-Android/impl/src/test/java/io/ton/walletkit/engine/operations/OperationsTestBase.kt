@@ -25,6 +25,7 @@ import io.mockk.coEvery
 import io.mockk.every
 import io.mockk.mockk
 import io.ton.walletkit.bridge.BridgeCodec
+import io.ton.walletkit.bridge.BridgePayload
 import io.ton.walletkit.engine.infrastructure.BridgeRpcClient
 import kotlinx.serialization.json.Json
 import kotlinx.serialization.json.JsonElement
@@ -95,6 +96,13 @@ abstract class OperationsTestBase {
             capturedParams = null
             mockRawResponse
         }
+        // Typed calls read the result as text, the way it arrives from the port.
+        coEvery { rpcClient.sendPayload(any(), any()) } coAnswers {
+            BridgePayload.ofText(json, rpcClient.send(firstArg(), secondArg()).toString())
+        }
+        coEvery { rpcClient.sendPayload(any()) } coAnswers {
+            BridgePayload.ofText(json, rpcClient.send(firstArg()).toString())
+        }
     }
 
     protected fun encodeCapturedParams(): JsonElement = BridgeCodec(json).encode(capturedParams)
@@ -22,6 +22,9 @@
 package io.ton.walletkit.engine.operations
 
 import io.ton.walletkit.api.WalletVersions
+import io.ton.walletkit.api.generated.TONNetwork
+import io.ton.walletkit.engine.operations.requests.WalletImportEntry
+import io.ton.walletkit.internal.constants.BridgeMethodConstants
 import kotlinx.coroutines.runBlocking
 import kotlinx.serialization.json.JsonArray
 import kotlinx.serialization.json.JsonObject
@@ -172,4 +175,58 @@ class WalletOperationsTest : OperationsTestBase() {
         assertEquals("0xnewkey", response.wallet?.publicKey)
         assertEquals(WalletVersions.V5R1, response.wallet?.version)
     }
+
+    // --- addWallets ---
+
+    @Test
+    fun addWallets_encodesEntriesAndDecodesPerWalletResults() = runBlocking {
+        givenBridgeReturnsRaw(
+            buildJsonArray {
+                add(
+                    buildJsonObject {
+                        put("walletId", "-239:$TEST_ADDRESS_1")
+                        put(
+                            "wallet",
+                            buildJsonObject {
+                                put("publicKey", "0xbatchkey")
+                                put("version", WalletVersions.V4R2)
+                            },
+                        )
+                        put("address", TEST_ADDRESS_1)
+                    },
+                )
+                add(buildJsonObject { put("error", "Invalid mnemonic") })
+            },
+        )
+
+        val response = rpcClient.addWallets(
+            listOf(
+                WalletImportEntry(
+                    secretKey = "00".repeat(32),
+                    version = WalletVersions.V4R2,
+                    network = TONNetwork(chainId = "-239"),
+                    workchain = 0,
+                    walletId = 698983191L,
+                ),
+                WalletImportEntry(
+                    mnemonic = listOf("word1", "word2"),
+                    mnemonicType = "bip39",
+                    version = WalletVersions.V5R1,
+                    network = TONNetwork(chainId = "-239"),
+                    workchain = 0,
+                    walletId = 2147483409L,
+                ),
+            ),
+        )
+
+        assertEquals(BridgeMethodConstants.METHOD_ADD_WALLETS, capturedMethod)
+        val wallets = (encodeCapturedParams() as JsonObject)["wallets"] as JsonArray
+        assertEquals(2, wallets.size)
+        assertEquals(2, response.size)
+        assertEquals(TEST_ADDRESS_1, response[0].address)
+        assertEquals("0xbatchkey", response[0].wallet?.publicKey)
+        assertNull(response[0].error)
+        assertEquals("Invalid mnemonic", response[1].error)
+        assertNull(response[1].walletId)
+    }
 }
@@ -26,10 +26,13 @@ import io.ton.walletkit.api.generated.TONDisconnectionEvent
 import io.ton.walletkit.api.generated.TONDisconnectionEventPreview
 import io.ton.walletkit.event.TONWalletKitEvent
 import io.ton.walletkit.listener.TONBridgeEventsHandler
+import kotlinx.coroutines.Dispatchers
+import kotlinx.coroutines.asCoroutineDispatcher
 import kotlinx.coroutines.async
 import kotlinx.coroutines.awaitAll
 import kotlinx.coroutines.delay
 import kotlinx.coroutines.runBlocking
+import kotlinx.coroutines.withTimeout
 import org.junit.Assert.*
 import org.junit.Before
 import org.junit.Test
@@ -37,6 +40,9 @@ import org.junit.runner.RunWith
 import org.robolectric.RobolectricTestRunner
 import org.robolectric.annotation.Config
 import java.util.concurrent.CopyOnWriteArrayList
+import java.util.concurrent.CountDownLatch
+import java.util.concurrent.Executors
+import java.util.concurrent.TimeUnit
 import java.util.concurrent.atomic.AtomicInteger
 
 /**
@@ -70,7 +76,8 @@ class EventRouterTest {
 
     @Before
     fun setup() {
-        router = EventRouter()
+        // Unconfined delivers each posted event before post returns.
+        router = EventRouter(defaultDispatcher = Dispatchers.Unconfined)
     }
 
     // --- Add Handler Tests ---
@@ -184,10 +191,10 @@ class EventRouterTest {
         assertFalse("Should not contain handler never added", contains)
     }
 
-    // --- Dispatch Event Tests ---
+    // --- Post Tests ---
 
     @Test
-    fun dispatchEvent_singleHandler_receivesEvent() = runBlocking {
+    fun post_singleHandler_receivesEvent() = runBlocking {
         val receivedEvents = mutableListOf<TONWalletKitEvent>()
         val handler = object : TONBridgeEventsHandler {
             override fun handle(event: TONWalletKitEvent) {
@@ -197,14 +204,14 @@ class EventRouterTest {
         router.addHandler(handler)
 
         val event = createDisconnectEvent("test-session")
-        router.dispatchEvent("event-1", "disconnect", event)
+        router.post("event-1", "disconnect", event)
 
         assertEquals("Handler should receive 1 event", 1, receivedEvents.size)
         assertEquals("Handler should receive correct event", event, receivedEvents[0])
     }
 
     @Test
-    fun dispatchEvent_multipleHandlers_allReceiveEvent() = runBlocking {
+    fun post_multipleHandlers_allReceiveEvent() = runBlocking {
         val received1 = mutableListOf<TONWalletKitEvent>()
         val received2 = mutableListOf<TONWalletKitEvent>()
         val received3 = mutableListOf<TONWalletKitEvent>()
@@ -226,7 +233,7 @@ class EventRouterTest {
         })
 
         val event = createDisconnectEvent("test-session")
-        router.dispatchEvent("event-1", "disconnect", event)
+        router.post("event-1", "disconnect", event)
 
         assertEquals("Handler 1 should receive event", 1, received1.size)
         assertEquals("Handler 2 should receive event", 1, received2.size)
@@ -234,7 +241,7 @@ class EventRouterTest {
     }
 
     @Test
-    fun dispatchEvent_handlerThrows_otherHandlersContinue() = runBlocking {
+    fun post_handlerThrows_otherHandlersContinue() = runBlocking {
         val received1 = mutableListOf<TONWalletKitEvent>()
         val received2 = mutableListOf<TONWalletKitEvent>()
 
@@ -255,18 +262,18 @@ class EventRouterTest {
         })
 
         val event = createDisconnectEvent("test-session")
-        router.dispatchEvent("event-1", "disconnect", event)
+        router.post("event-1", "disconnect", event)
 
         assertEquals("Handler 1 should receive event", 1, received1.size)
         assertEquals("Handler 3 should receive event despite handler 2 throwing", 1, received2.size)
     }
 
     @Test
-    fun dispatchEvent_noHandlers_doesNotThrow() = runBlocking {
+    fun post_noHandlers_doesNotThrow() = runBlocking {
         val event = createDisconnectEvent("test-session")
 
         // Should not throw
-        router.dispatchEvent("event-1", "disconnect", event)
+        router.post("event-1", "disconnect", event)
     }
 
     // --- Concurrent Operations Tests ---
@@ -307,7 +314,7 @@ class EventRouterTest {
         val jobs = (1..10).map { i ->
             async {
                 val event = createDisconnectEvent("session-$i")
-                router.dispatchEvent("event-$i", "disconnect", event)
+                router.post("event-$i", "disconnect", event)
             }
         }
 
@@ -316,6 +323,52 @@ class EventRouterTest {
         assertEquals("Handler should receive all 10 events", 10, eventCount.get())
     }
 
+    // --- Async Delivery Tests ---
+
+    @Test
+    fun post_slowHandlerDoesNotBlockOthers_andOrderIsKept() = runBlocking {
+        val slowExecutor = Executors.newSingleThreadExecutor()
+        val fastExecutor = Executors.newSingleThreadExecutor()
+        try {
+            val release = CountDownLatch(1)
+            val fastReceived = CopyOnWriteArrayList<String?>()
+            val slowReceived = CopyOnWriteArrayList<String?>()
+            val fastDone = CountDownLatch(3)
+            router.addHandler(
+                object : TONBridgeEventsHandler {
+                    override fun handle(event: TONWalletKitEvent) {
+                        release.await()
+                        slowReceived.add((event as TONWalletKitEvent.Disconnect).event.sessionId)
+                    }
+                },
+                dispatcher = slowExecutor.asCoroutineDispatcher(),
+            )
+            router.addHandler(
+                object : TONBridgeEventsHandler {
+                    override fun handle(event: TONWalletKitEvent) {
+                        fastReceived.add((event as TONWalletKitEvent.Disconnect).event.sessionId)
+                        fastDone.countDown()
+                    }
+                },
+                dispatcher = fastExecutor.asCoroutineDispatcher(),
+            )
+
+            (1..3).forEach { router.post("event-$it", "disconnect", createDisconnectEvent("s$it")) }
+
+            assertTrue("Fast handler should not wait for the slow one", fastDone.await(5, TimeUnit.SECONDS))
+            assertEquals(listOf("s1", "s2", "s3"), fastReceived)
+            assertTrue(slowReceived.isEmpty())
+
+            release.countDown()
+            withTimeout(5_000) { while (slowReceived.size < 3) delay(5) }
+            assertEquals(listOf("s1", "s2", "s3"), slowReceived)
+        } finally {
+            router.close()
+            slowExecutor.shutdown()
+            fastExecutor.shutdown()
+        }
+    }
+
     // --- Helper ---
 
     private fun createHandler(): TONBridgeEventsHandler = object : TONBridgeEventsHandler {
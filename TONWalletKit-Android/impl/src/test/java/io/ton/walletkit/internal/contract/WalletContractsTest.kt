@@ -0,0 +1,122 @@
+/*
+ * Copyright (c) 2025 TonTech
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+package io.ton.walletkit.internal.contract
+
+import io.ton.walletkit.api.WalletVersions
+import org.junit.Assert.assertArrayEquals
+import org.junit.Assert.assertEquals
+import org.junit.Assert.assertThrows
+import org.junit.Test
+
+/**
+ * Native wallet contract derivation against addresses and state inits produced by the bridge
+ * bundle's WalletV4R2Adapter and WalletV5R1Adapter for fixed inputs.
+ */
+class WalletContractsTest {
+
+    private val publicKey = hex("5d8ab3ce7a1a53e4e5b3e6a5c37e7ee0b9e8c1d4f6a7b8c9d0e1f2a3b4c5d6e7")
+
+    @Test
+    fun codeCells_hashToPublishedCodeHashes() {
+        assertEquals(
+            "feb5ff6820e2ff0d9483e7e0d62c817d846789fb4ae580c878866d959dabd5c0",
+            codeHash(WalletVersions.V4R2),
+        )
+        assertEquals(
+            "20834b7b72b112147e1b2fb457b84e74d1a30f04f737d4f62a668e9552d2b72f",
+            codeHash(WalletVersions.V5R1),
+        )
+    }
+
+    @Test
+    fun address_matchesJsAdapters() {
+        assertEquals(
+            "UQApgKw9CWXe38n7zE5l_WTHeh00RCRkdbI-ApAtSHtNs3-8",
+            WalletContracts.address(WalletVersions.V5R1, publicKey, 0, 2147483409L).value,
+        )
+        assertEquals(
+            "0QApgKw9CWXe38n7zE5l_WTHeh00RCRkdbI-ApAtSHtNs8Q2",
+            WalletContracts.address(WalletVersions.V5R1, publicKey, 0, 2147483409L, testnet = true).value,
+        )
+        assertEquals(
+            "Uf9D0ouvuWxkuzk77xKhNHyTfPpYi_dblXNWz4ctVkzS7FsW",
+            WalletContracts.address(WalletVersions.V5R1, publicKey, -1, 7L).value,
+        )
+        assertEquals(
+            "UQDPE_1sG18hqRS-Y5ON9B_rkU6bswKBo7mSGzFIbWW9QTsD",
+            WalletContracts.address(WalletVersions.V4R2, publicKey, 0, 698983191L).value,
+        )
+        assertEquals(
+            "UQAwFR7fXxpGXskH4GOUegXzWQ1belpBQSAqszAJQYXeTInf",
+            WalletContracts.address(WalletVersions.V4R2, publicKey, 0, 42L).value,
+        )
+    }
+
+    @Test
+    fun stateInitBoc_isByteIdenticalToJs() {
+        val expected =
+            "te6cckECFgEAArEAAgE0ARUBFP8A9KQT9LzyyAsCAgEgAw4CAUgEBQLc0CDXScEgkVuPYyDXCx8gghBleHRuvSGCEHNpbnS9" +
+            "sJJfA+CCEGV4dG66jrSAINchAdB01yH6QDD6RPgo+kQwWL2RW+DtRNCBAUHXIfQFgwf0Dm+hMZEw4YBA1yFwf9s84DEg10mB" +
+            "AoC5kTDgcOIREAIBIAYNAgEgBwoCAW4ICQAZrc52omhAIOuQ64X/wAAZrx32omhAEOuQ64WPwAIBSAsMABezJftRNBx1yHXC" +
+            "x+AAEbJi+1E0NcKAIAAZvl8PaiaECAoOuQ+gLAEC8g8BHiDXCx+CEHNpZ2668uCKfxAB5o7w7aLt+yGDCNciAoMI1yMggCDX" +
+            "IdMf0x/TH+1E0NIA0x8g0x/T/9cKAAr5AUDM+RCaKJRfCtsx4fLAh98Cs1AHsPLQhFEluvLghVA2uvLghvgju/LQiCKS+ADe" +
+            "AaR/yMoAyx8BzxbJ7VQgkvgP3nDbPNgRA/btou37AvQEIW6SbCGOTAIh1zkwcJQhxwCzji0B1yggdh5DbCDXScAI8uCTINdK" +
+            "wALy4JMg1x0GxxLCAFIwsPLQiddM1zkwAaTobBKEB7vy4JPXSsAA8uCT7VXi0gABwACRW+Dr1ywIFCCRcJYB1ywIHBLiUhCx" +
+            "4w8g10oSExQAlgH6QAH6RPgo+kQwWLry4JHtRNCBAUHXGPQFBJ1/yMoAQASDB/RT8uCLjhQDgwf0W/LgjCLXCgAhbgGzsPLQ" +
+            "kOLIUAPPFhL0AMntVAByMNcsCCSOLSHy4JLSAO1E0NIAURO68tCPVFAwkTGcAYEBQNch1woA8uCO4sjKAFjPFsntVJPywI3i" +
+            "ABCTW9sx4ddM0ABRgAAAAD///4iuxVnnPQ0p8nLZ81Lhvz9wXPRg6ntT3GTocPlR2mLrc6AXVGXw"
+
+        assertEquals(expected, WalletContracts.stateInitBoc(WalletVersions.V5R1, publicKey, 2147483409L).value)
+    }
+
+    @Test
+    fun bagOfCells_roundTripsStateInit() {
+        val stateInit = WalletContracts.stateInit(WalletVersions.V4R2, publicKey, 698983191L)
+
+        val parsed = BagOfCells.parse(BagOfCells.serialize(stateInit))
+
+        assertArrayEquals(stateInit.hash(), parsed.hash())
+        assertEquals(stateInit.depth, parsed.depth)
+    }
+
+    @Test
+    fun address_rejectsBadInput() {
+        assertThrows(IllegalArgumentException::class.java) {
+            WalletContracts.address("v3r2", publicKey, 0, 1L)
+        }
+        assertThrows(IllegalArgumentException::class.java) {
+            WalletContracts.address(WalletVersions.V5R1, publicKey.copyOf(31), 0, 1L)
+        }
+        assertThrows(IllegalArgumentException::class.java) {
+            WalletContracts.address(WalletVersions.V5R1, publicKey, 0, 1L shl 32)
+        }
+    }
+
+    private fun codeHash(version: String): String {
+        val stateInit = WalletContracts.stateInit(version, publicKey, 1L)
+        return stateInit.refs[0].hash().toHex()
+    }
+
+    private fun hex(value: String): ByteArray = ByteArray(value.length / 2) { value.substring(it * 2, it * 2 + 2).toInt(16).toByte() }
+
+    private fun ByteArray.toHex(): String = joinToString("") { "%02x".format(it) }
+}
@@ -0,0 +1,157 @@
+/*
+ * Copyright (c) 2025 TonTech
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+package io.ton.walletkit.internal.crypto
+
+import io.ton.walletkit.WalletKitBridgeException
+import org.junit.Assert.assertArrayEquals
+import org.junit.Assert.assertEquals
+import org.junit.Assert.assertFalse
+import org.junit.Assert.assertThrows
+import org.junit.Assert.assertTrue
+import org.junit.Test
+import java.security.SecureRandom
+
+/**
+ * Native crypto against results of the bridge bundle's `@ton/crypto` and `tweetnacl` code paths,
+ * recorded for fixed inputs.
+ */
+class NativeCryptoParityTest {
+
+    @Test
+    fun ed25519_matchesRfc8032Vector() {
+        val seed = hex("9d61b19deffd5a60ba844af492ec2cc44449c5697b326919703bac031cae7f60")
+
+        val secretKey = Ed25519.secretKeyFromSeed(seed)
+
+        assertEquals("d75a980182b10ab7d54bfed3c964073a0ee172f3daa62325af021a68f707511a", secretKey.copyOfRange(32, 64).toHex())
+        assertEquals(
+            "e5564300c360ac729086e2cc806e828a84877f1eb8e5d974d873e065224901555fb8821590a33bacc61e39701cf9b46bd25bf5f0595bbe24655141438e7a100b",
+            Ed25519.sign(ByteArray(0), secretKey).toHex(),
+        )
+    }
+
+    @Test
+    fun x25519PublicKey_matchesRfc7748Vector() {
+        val secretKey = hex("77076d0a7318a57d3c16c17251b26645df4c2f87ebc0992ab177fba51db92c2a")
+
+        assertEquals(
+            "8520f0098930a754748b7ddcb43ef75a0dbf3a0d26381af4eba4a98eaa9b4e6a",
+            Ed25519.x25519PublicKey(secretKey).toHex(),
+        )
+    }
+
+    @Test
+    fun x25519PublicKey_matchesBundleBoxKeyPair() {
+        // nacl.box.keyPair.fromSecretKey in the bundle, which TON Connect session keys come from.
+        assertEquals(
+            "8f40c5adb68f25624ae5b214ea767a6ec94d829d3d7b5e1ad1ba6f3e2138285f",
+            Ed25519.x25519PublicKey(ByteArray(32) { it.toByte() }).toHex(),
+        )
+        // Every bit set, so clamping decides the result.
+        assertEquals(
+            "847c0d2c375234f365e660955187a3735a0f7613d1609d3a6a4d8c53aeaa5a22",
+            Ed25519.x25519PublicKey(ByteArray(32) { -1 }).toHex(),
+        )
+    }
+
+    @Test
+    fun mnemonicToKeyPair_matchesJs() {
+        val keyPair = TonMnemonic.toKeyPair(MNEMONIC_24)
+
+        assertEquals("56fa63d02de2cc73ad4680678f563ccfbfa6ff9b4e20cd8882c4ad361c396f96", keyPair.publicKey.toHex())
+        assertEquals(
+            "757a202215856fcdbab3004bc43fdd88fe0a83737ef7e042c59904c32fa0d7ef" + keyPair.publicKey.toHex(),
+            keyPair.secretKey.toHex(),
+        )
+        assertEquals(
+            "fd2d4dd402a81a1ff6a922f04df86e9c78e78208dbe445e9add3b950cbcf7b8f",
+            TonMnemonic.toKeyPair(MNEMONIC_24.take(12)).publicKey.toHex(),
+        )
+    }
+
+    @Test
+    fun mnemonicToKeyPair_normalizesWordsLikeJs() {
+        val messy = MNEMONIC_24.map { " ${it.uppercase()} " }
+
+        assertArrayEquals(TonMnemonic.toKeyPair(MNEMONIC_24).secretKey, TonMnemonic.toKeyPair(messy).secretKey)
+    }
+
+    @Test
+    fun mnemonicToKeyPair_rejectsOtherLengths() {
+        val error = assertThrows(WalletKitBridgeException::class.java) { TonMnemonic.toKeyPair(MNEMONIC_24.take(18)) }
+        assertEquals("Invalid mnemonic length: expected 12 or 24 words, got 18", error.message)
+    }
+
+    @Test
+    fun sign_matchesJsForFullKeyAndSeed() {
+        val secretKey = TonMnemonic.toKeyPair(MNEMONIC_24).secretKey
+        val message = "TON parity message".encodeToByteArray()
+        val expected = "ca7d758493b744c8070280d29844e5796a34a450140b038f40086ad45494fc2b" +
+            "1909af9967775bf54a288bb117cbc50bd00b088a45c461214372650a5019e501"
+
+        assertEquals(expected, Ed25519.sign(message, secretKey).toHex())
+        assertEquals(expected, Ed25519.sign(message, secretKey.copyOf(32)).toHex())
+    }
+
+    @Test
+    fun isBasicSeed_matchesJs() {
+        assertFalse(TonMnemonic.isBasicSeed(TonMnemonic.toEntropy(MNEMONIC_24)))
+        assertTrue(TonMnemonic.isBasicSeed(TonMnemonic.toEntropy(BASIC_MNEMONIC)))
+    }
+
+    @Test
+    fun generate_returnsBasicMnemonicsOfRequestedLength() {
+        val random = SecureRandom()
+        listOf(12, 24).forEach { count ->
+            val words = TonMnemonic.generate(count, random)
+
+            assertEquals(count, words.size)
+            assertTrue(words.all { it in Bip39Wordlist.words })
+            assertTrue(TonMnemonic.isBasicSeed(TonMnemonic.toEntropy(words)))
+        }
+    }
+
+    @Test
+    fun pbkdf2_matchesReferenceOutput() {
+        assertEquals(
+            "e1d9c16aa681708a45f5c7c4e215ceb66e011a2e9f0040713f18aefdb866d53c" +
+                "f76cab2868a39b9f7840edce4fef5a82be67335c77a6068e04112754f27ccf4e",
+            TonMnemonic.pbkdf2Sha512("password".encodeToByteArray(), "salt".encodeToByteArray(), 2).toHex(),
+        )
+    }
+
+    private fun hex(value: String) = ByteArray(value.length / 2) { value.substring(it * 2, it * 2 + 2).toInt(16).toByte() }
+
+    private fun ByteArray.toHex() = joinToString("") { "%02x".format(it) }
+
+    private companion object {
+        val MNEMONIC_24 = (
+            "abstract army blame car coin decade dry excite fly govern ice kitten major muscle original pond " +
+                "real safe since stairs term tunnel volcano absorb"
+            ).split(" ")
+
+        val BASIC_MNEMONIC = (
+            "gate apple relax garage antenna reflect future angry rebuild frozen amount raven fresh already " +
+                "ranch fossil alien radar force air quit focus afraid puzzle"
+            ).split(" ")
+    }
+}
@@ -86,9 +86,10 @@ internal object TestWalletKitFactory {
         // Wrap in TONWalletKit (accessing internal constructor via reflection)
         val constructor = TONWalletKit::class.java.getDeclaredConstructor(
             WalletKitEngine::class.java,
+            Set::class.java,
         )
         constructor.isAccessible = true
-        val sdk = constructor.newInstance(mockEngine) as ITONWalletKit
+        val sdk = constructor.newInstance(mockEngine, null) as ITONWalletKit
 
         // Add events handler if provided
         if (eventsHandler != null) {
@@ -0,0 +1,192 @@
+/*
+ * Copyright (c) 2025 TonTech
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+package io.ton.walletkit.storage
+
+import org.junit.Assert.assertEquals
+import org.junit.Assert.assertFalse
+import org.junit.Assert.assertNull
+import org.junit.Assert.assertTrue
+import org.junit.Rule
+import org.junit.Test
+import org.junit.rules.TemporaryFolder
+import java.io.File
+import java.io.RandomAccessFile
+import java.nio.ByteBuffer
+import javax.crypto.KeyGenerator
+import javax.crypto.SecretKey
+
+class EncryptedJournalTest {
+
+    @get:Rule
+    val folder = TemporaryFolder()
+
+    private val key = newKey()
+
+    private val file: File
+        get() = File(folder.root, "journal")
+
+    @Test
+    fun values_surviveReopen() {
+        EncryptedJournal(file, key).use { journal ->
+            assertTrue(journal.isNew)
+            journal.put("bridge:sessions", "[1]")
+            journal.put("bridge:sessions", "[1,2]")
+            journal.put("bridge:wallets", "{}")
+            journal.remove("bridge:wallets")
+        }
+
+        EncryptedJournal(file, key).use { journal ->
+            assertFalse(journal.isNew)
+            assertEquals("[1,2]", journal.get("bridge:sessions"))
+            assertNull(journal.get("bridge:wallets"))
+            assertEquals(listOf("bridge:sessions"), journal.keys())
+        }
+    }
+
+    @Test
+    fun recordsAreNotStoredInPlaintext() {
+        EncryptedJournal(file, key).use { it.put("bridge:secret", "mnemonic words") }
+
+        val bytes = file.readBytes().decodeToString()
+        assertFalse(bytes.contains("mnemonic"))
+        assertFalse(bytes.contains("bridge:secret"))
+    }
+
+    @Test
+    fun tornTail_isDroppedAndLaterWritesAppendCleanly() {
+        EncryptedJournal(file, key).use { journal ->
+            journal.put("a", "1")
+            journal.put("b", "2")
+        }
+        val intact = file.length()
+        EncryptedJournal(file, key).use { it.put("c", "3") }
+        // A crash mid-write leaves only part of the last record on disk.
+        RandomAccessFile(file, "rw").use { it.setLength(intact + (file.length() - intact) / 2) }
+
+        EncryptedJournal(file, key).use { journal ->
+            assertEquals(intact, file.length())
+            assertEquals("1", journal.get("a"))
+            assertEquals("2", journal.get("b"))
+            assertNull(journal.get("c"))
+            journal.put("d", "4")
+        }
+        EncryptedJournal(file, key).use { assertEquals("4", it.get("d")) }
+    }
+
+    @Test
+    fun corruptedTail_failsAuthenticationAndIsDropped() {
+        EncryptedJournal(file, key).use { journal ->
+            journal.put("a", "1")
+            journal.put("b", "2")
+        }
+        RandomAccessFile(file, "rw").use { raf ->
+            raf.seek(raf.length() - 1)
+            val last = raf.read()
+            raf.seek(raf.length() - 1)
+            raf.write(last xor 0xFF)
+        }
+
+        EncryptedJournal(file, key).use { journal ->
+            assertEquals("1", journal.get("a"))
+            assertNull(journal.get("b"))
+        }
+    }
+
+    @Test
+    fun damagedBytesMidJournal_keepRecordsWrittenAfterThem() {
+        EncryptedJournal(file, key).use { it.put("a", "1") }
+        val firstRecordEnd = file.length().toInt()
+        EncryptedJournal(file, key).use { journal ->
+            journal.put("b", "2")
+            journal.put("a", "3")
+        }
+        // A partial frame from a failed write, with later records appended behind it.
+        val bytes = file.readBytes()
+        val garbage = ByteBuffer.allocate(34).putInt(200).put(ByteArray(30) { 9 }).array()
+        file.writeBytes(bytes.copyOfRange(0, firstRecordEnd) + garbage + bytes.copyOfRange(firstRecordEnd, bytes.size))
+
+        EncryptedJournal(file, key).use { journal ->
+            assertEquals("3", journal.get("a"))
+            assertEquals("2", journal.get("b"))
+        }
+        // Rewritten without the damage.
+        assertTrue(file.length() < bytes.size)
+        EncryptedJournal(file, key).use { journal ->
+            assertEquals("3", journal.get("a"))
+            assertEquals("2", journal.get("b"))
+        }
+    }
+
+    @Test
+    fun leftoverCompactionFile_isIgnored() {
+        EncryptedJournal(file, key).use { it.put("a", "1") }
+        // A crash during compaction leaves the half-written copy next to the intact journal.
+        File(file.path + ".compact").writeBytes(ByteArray(100) { 7 })
+
+        EncryptedJournal(file, key).use { assertEquals("1", it.get("a")) }
+        assertFalse(File(file.path + ".compact").exists())
+    }
+
+    @Test
+    fun compaction_keepsLiveRecordsOnly() {
+        EncryptedJournal(file, key, compactionMinBytes = 4 * 1024).use { journal ->
+            repeat(500) { journal.put("bridge:last_event_id", "event-$it") }
+            journal.put("bridge:sessions", "[]")
+
+            assertTrue(journal.sizeBytes < 4 * 1024 + 1024)
+            assertEquals("event-499", journal.get("bridge:last_event_id"))
+        }
+        EncryptedJournal(file, key).use { journal ->
+            assertEquals("event-499", journal.get("bridge:last_event_id"))
+            assertEquals("[]", journal.get("bridge:sessions"))
+        }
+    }
+
+    @Test
+    fun removePrefix_dropsOnlyMatchingKeys() {
+        EncryptedJournal(file, key).use { journal ->
+            journal.put("bridge:a", "1")
+            journal.put("bridge:b", "2")
+            journal.put("wallet:c", "3")
+            assertEquals(2, journal.removePrefix("bridge:"))
+            journal.put("bridge:d", "4")
+        }
+
+        EncryptedJournal(file, key).use { journal ->
+            assertEquals(listOf("bridge:d"), journal.keys("bridge:"))
+            assertEquals("3", journal.get("wallet:c"))
+        }
+    }
+
+    @Test(expected = EncryptedJournal.WrongKeyException::class)
+    fun wrongKey_isRejectedWithoutTouchingTheJournal() {
+        EncryptedJournal(file, key).use { it.put("a", "1") }
+        val length = file.length()
+        try {
+            EncryptedJournal(file, newKey())
+        } finally {
+            assertEquals(length, file.length())
+        }
+    }
+
+    private fun newKey(): SecretKey = KeyGenerator.getInstance("AES").apply { init(256) }.generateKey()
+}
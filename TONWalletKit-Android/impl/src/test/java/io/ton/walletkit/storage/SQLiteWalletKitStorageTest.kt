@@ -0,0 +1,96 @@
+/*
+ * Copyright (c) 2025 TonTech
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+package io.ton.walletkit.storage
+
+import androidx.test.core.app.ApplicationProvider
+import kotlinx.coroutines.test.runTest
+import org.junit.After
+import org.junit.Assert.assertEquals
+import org.junit.Assert.assertNull
+import org.junit.Test
+import org.junit.runner.RunWith
+import org.robolectric.RobolectricTestRunner
+import org.robolectric.annotation.Config
+
+@RunWith(RobolectricTestRunner::class)
+@Config(manifest = Config.NONE, sdk = [28])
+class SQLiteWalletKitStorageTest {
+    private val storage = SQLiteWalletKitStorage(ApplicationProvider.getApplicationContext(), databaseName = null)
+
+    @After
+    fun tearDown() {
+        storage.close()
+    }
+
+    @Test
+    fun singleKeyOperations_roundTrip() = runTest {
+        storage.set("sessions", "[1]")
+        storage.set("sessions", "[1,2]")
+        assertEquals("[1,2]", storage.get("sessions"))
+
+        storage.remove("sessions")
+        assertNull(storage.get("sessions"))
+    }
+
+    @Test
+    fun batchOperations_touchOnlyTheGivenKeys() = runTest {
+        storage.setMany(mapOf("a" to "1", "b" to "2", "c" to "3"))
+
+        assertEquals(mapOf("a" to "1", "c" to "3"), storage.getMany(listOf("a", "c", "missing")))
+
+        storage.removeMany(listOf("a", "b"))
+        assertEquals(mapOf("c" to "3"), storage.getMany(listOf("a", "b", "c")))
+    }
+
+    @Test
+    fun getMany_handlesMoreKeysThanOneQueryBinds() = runTest {
+        val values = (0 until 1_200).associate { "key$it" to "value$it" }
+        storage.setMany(values)
+
+        assertEquals(values, storage.getMany(values.keys))
+    }
+
+    @Test
+    fun getByPrefix_matchesLiterally() = runTest {
+        storage.setMany(
+            mapOf(
+                "session:1" to "a",
+                "session:2" to "b",
+                "session_x" to "c",
+                "wallets" to "d",
+            ),
+        )
+
+        assertEquals(mapOf("session:1" to "a", "session:2" to "b"), storage.getByPrefix("session:"))
+        // Wildcard characters in the prefix are not patterns.
+        assertEquals(emptyMap<String, String>(), storage.getByPrefix("session%"))
+    }
+
+    @Test
+    fun clear_removesEverything() = runTest {
+        storage.setMany(mapOf("a" to "1", "b" to "2"))
+
+        storage.clear()
+
+        assertEquals(emptyMap<String, String>(), storage.getByPrefix(""))
+    }
+}